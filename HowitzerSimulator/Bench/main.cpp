@@ -0,0 +1,305 @@
+/**********************************************************************
+ * Source File:
+ *    Bench
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Time the physics, vector and angle primitives and whole
+ *    trajectories without opening a window.
+ *    Usage: bench [--counters] [output name] [earlier results.csv]
+ *    Writes <output name>.csv, and compares with the earlier results
+ *    if there are any. With --counters, the hardware counts cycles,
+ *    instructions and misses too, where it can
+ ************************************************************************/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "perfCounters.h"
+#include "physics.h"
+#include "velocity.h"
+#include "acceleration.h"
+#include "position.h"
+#include "angle.h"
+#include "projectile.h"
+#include "firingTable.h"
+#include "dormandPrince.h"
+
+using namespace std;
+
+/*********************************
+ * LEVEL GROUND
+ * A surface at sea level everywhere
+ *********************************/
+struct LevelGround
+{
+   double getElevationMeters(const Position&) const { return 0.0; }
+};
+
+/*********************************
+ * The primitives the integrators lean on.
+ * Each takes a new input every call so the
+ * compiler cannot hoist the work out of the loop
+ *********************************/
+void benchPrimitives(Benchmark& bench)
+{
+   const Mapping mapping[] =
+   {
+      { 0.300, 0.1629 }, { 0.500, 0.1659 }, { 0.700, 0.2031 }, { 0.890, 0.2597 },
+      { 0.920, 0.3010 }, { 0.960, 0.3287 }, { 0.980, 0.4002 }, { 1.000, 0.4258 },
+      { 1.020, 0.4335 }, { 1.060, 0.4483 }, { 1.240, 0.4064 }, { 1.530, 0.3663 },
+      { 1.990, 0.2897 }, { 2.870, 0.2297 }, { 2.890, 0.2306 }, { 5.000, 0.2656 }
+   };
+   const int numMapping = sizeof(mapping) / sizeof(mapping[0]);
+
+   double mach = 0.3;
+   bench.run("linearInterpolation", [&]()
+   {
+      mach = (mach > 5.0) ? 0.3 : mach + 0.0137;
+      return linearInterpolation(mapping, numMapping, mach);
+   });
+
+   double altitude = 0.0;
+   bench.run("densityFromAltitude", [&]()
+   {
+      altitude = (altitude > 80000.0) ? 0.0 : altitude + 37.0;
+      return densityFromAltitude(altitude);
+   });
+
+   mach = 0.3;
+   bench.run("dragFromMach", [&]()
+   {
+      mach = (mach > 5.0) ? 0.3 : mach + 0.0137;
+      return dragFromMach(mach);
+   });
+
+   Velocity v(120.0, 310.0);
+   bench.run("Velocity::getSpeed", [&]()
+   {
+      v.setDX(v.getDX() + 0.5);
+      return v.getSpeed();
+   });
+
+   // normalize() is private: setRadians() is its thinnest caller
+   Angle angle;
+   double radians = -20.0;
+   bench.run("Angle::normalize", [&]()
+   {
+      radians = (radians > 20.0) ? -20.0 : radians + 0.731;
+      angle.setRadians(radians);
+      return angle.getRadians();
+   });
+
+   Position pos;
+   Acceleration a(-1.5, -9.8);
+   bench.run("Position::add", [&]()
+   {
+      pos.add(a, v, 0.01);
+      return pos.getMetersX();
+   });
+}
+
+/*********************************
+ * KINEMATIC STEPS
+ * How many 0.01 s steps a shell fired at 45
+ * degrees takes to come down
+ *********************************/
+int kinematicSteps(const LevelGround& ground)
+{
+   Projectile shell;
+   shell.setFlightPathCapacity(64, true /*keepLatestOnly*/);
+   shell.fire(Position(), Angle(45.0), DEFAULT_MUZZLE_VELOCITY, 0.0);
+   int numSteps = 0;
+   for (double time = 0.01; shell.isFlying() && time < MAX_FLIGHT_TIME; time += 0.01)
+   {
+      shell.advance(time, ground);
+      numSteps++;
+   }
+   return numSteps;
+}
+
+/*********************************
+ * ADAPTIVE STEPS
+ * How many steps FiringTable::fire() takes for
+ * the same shell: it steps until one crosses
+ * the ground
+ *********************************/
+int adaptiveSteps()
+{
+   ShellDynamics dynamics(DEFAULT_PROJECTILE_WEIGHT, DEFAULT_PROJECTILE_RADIUS);
+   Velocity v;
+   v.set(Angle(45.0), DEFAULT_MUZZLE_VELOCITY);
+   DormandPrince stepper;
+   stepper.start(BallisticState{ 0.0, 0.0, v.getDX(), v.getDY() }, 0.0, dynamics);
+   do
+      stepper.step(dynamics);
+   while (stepper.getState().y > 0.0 && stepper.getTime() < MAX_FLIGHT_TIME);
+   return stepper.getNumAccepted();
+}
+
+/*********************************
+ * One step of a shell, and the whole flight
+ * with each integrator
+ *********************************/
+void benchTrajectories(Benchmark& bench)
+{
+   Projectile projectile;
+   projectile.setFlightPathCapacity(64, true /*keepLatestOnly*/);
+   double t = 0.0;
+   bench.run("Projectile::advance", [&]()
+   {
+      if (!projectile.isFlying())
+      {
+         t = 0.0;
+         projectile.fire(Position(), Angle(45.0), DEFAULT_MUZZLE_VELOCITY, t);
+      }
+      t += 0.01;
+      projectile.advance(t);
+   });
+
+   LevelGround ground;
+   bench.run("trajectory_kinematic", [&]()
+   {
+      Projectile shell;
+      shell.setFlightPathCapacity(64, true /*keepLatestOnly*/);
+      shell.fire(Position(), Angle(45.0), DEFAULT_MUZZLE_VELOCITY, 0.0);
+      double time = 0.0;
+      while (shell.isFlying() && time < MAX_FLIGHT_TIME)
+      {
+         time += 0.01;
+         shell.advance(time, ground);
+      }
+      return shell.getPosition().getMetersX();
+   }, kinematicSteps(ground));
+
+   bench.run("trajectory_adaptive", [&]()
+   {
+      return FiringTable::fire(45.0, DEFAULT_MUZZLE_VELOCITY).range;
+   }, adaptiveSteps());
+}
+
+/*********************************
+ * How to run us, for --help and for
+ * anything we do not understand
+ *********************************/
+void usage(ostream& out)
+{
+   out << "Usage: bench [--counters] [output name] [earlier results.csv]\n"
+       << "  --counters  count cycles, instructions and misses too, where the\n"
+       << "              hardware lets us\n"
+       << "Writes <output name>.csv, bench.csv by default\n";
+}
+
+/*********************************
+ * Run every benchmark, print and save
+ * the results, and compare with a
+ * previous run if we were given one
+ *********************************/
+int main(int argc, char** argv)
+{
+   // --counters may come anywhere; the rest are in order. Any other
+   // option is a mistake, not a file name
+   bool isCounting = false;
+   vector<string> args;
+   for (int i = 1; i < argc; i++)
+   {
+      string arg = argv[i];
+      if (arg == "--counters")
+         isCounting = true;
+      else if (arg == "--help" || arg == "-h")
+      {
+         usage(cout);
+         return 0;
+      }
+      else if (arg.compare(0, 2, "--") == 0)
+      {
+         cerr << "Unknown option " << arg << "\n";
+         usage(cerr);
+         return 1;
+      }
+      else
+         args.push_back(arg);
+   }
+   if (args.size() > 2)
+   {
+      usage(cerr);
+      return 1;
+   }
+
+   string name = (args.size() > 0) ? args[0] : "bench";
+   Benchmark baseline;
+   bool isComparing = (args.size() > 1);
+   if (isComparing && !baseline.readCSV(args[1]))
+   {
+      cerr << "Unable to read " << args[1] << "\n";
+      return 1;
+   }
+
+   // without the counters, fall back to timing alone
+   PerfCounters counters;
+   if (isCounting && !counters.isAvailable())
+   {
+      cerr << "Hardware counters are not available here: timing only\n";
+      isCounting = false;
+   }
+
+   Benchmark bench;
+   if (isCounting)
+      bench.setCounters(&counters);
+   benchPrimitives(bench);
+   benchTrajectories(bench);
+
+   cout << left << setw(24) << "benchmark" << right
+        << setw(14) << "median ns" << setw(14) << "p99 ns"
+        << setw(14) << "min ns" << setw(12) << "iterations";
+   if (isComparing)
+      cout << setw(10) << "change";
+   if (isCounting)
+      cout << setw(8) << "IPC" << setw(12) << "L1D/step"
+           << setw(12) << "LLC/step" << setw(12) << "branch/step";
+   cout << "\n" << fixed << setprecision(2);
+
+   for (const BenchmarkResult& r : bench.getResults())
+   {
+      cout << left << setw(24) << r.name << right
+           << setw(14) << r.median << setw(14) << r.p99
+           << setw(14) << r.minimum << setw(12) << r.iterations;
+      const BenchmarkResult* before = baseline.find(r.name);
+      if (isComparing)
+      {
+         if (before && before->median > 0.0)
+            cout << setw(9) << showpos << 100.0 * (r.median / before->median - 1.0)
+                 << noshowpos << '%';
+         else
+            cout << setw(10) << "";
+      }
+      if (isCounting)
+      {
+         // misses per step of the integration, or per call for the rest
+         PerfCounts perStep = r.counts / r.stepsPerOp;
+         if (r.counts.getIPC() >= 0.0)
+            cout << setw(8) << setprecision(2) << r.counts.getIPC();
+         else
+            cout << setw(8) << "-";
+         cout << setprecision(4);
+         for (PerfEvent event : { PERF_L1D_MISSES, PERF_LLC_MISSES, PERF_BRANCH_MISSES })
+            if (perStep.isCounted(event))
+               cout << setw(12) << perStep.value[event];
+            else
+               cout << setw(12) << "-";
+         cout << setprecision(2);
+      }
+      cout << "\n";
+   }
+
+   if (!bench.writeCSV(name + ".csv"))
+   {
+      cerr << "Unable to write " << name << ".csv\n";
+      return 1;
+   }
+
+   cout << "Wrote " << name << ".csv\n";
+   return 0;
+}
@@ -0,0 +1,53 @@
+/**********************************************************************
+ * Source File:
+ *    Firing Table
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Build the M777 firing tables without opening a window.
+ *    Usage: firingtable [output name] [angle step in degrees]
+ *    Writes <output name>.bin and <output name>.csv
+ ************************************************************************/
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include "firingTable.h"
+
+using namespace std;
+
+/*********************************
+ * Sweep every charge and angle on all cores
+ * and save the table in both formats
+ *********************************/
+int main(int argc, char** argv)
+{
+   string name = (argc > 1) ? argv[1] : "firingtable";
+   double angleStep = (argc > 2) ? atof(argv[2]) : DEFAULT_ANGLE_STEP;
+   if (angleStep <= 0.0)
+   {
+      cerr << "The angle step must be positive\n";
+      return 1;
+   }
+
+   FiringTable table(angleStep);
+
+   auto start = chrono::steady_clock::now();
+   table.compute();
+   chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+   cout << table.getNumCharges() * table.getNumAngles() << " trajectories on "
+        << thread::hardware_concurrency() << " threads in "
+        << elapsed.count() << " s\n";
+
+   if (!table.writeBinary(name + ".bin") || !table.writeCSV(name + ".csv"))
+   {
+      cerr << "Unable to write " << name << ".bin or " << name << ".csv\n";
+      return 1;
+   }
+
+   cout << "Wrote " << name << ".bin and " << name << ".csv\n";
+   return 0;
+}
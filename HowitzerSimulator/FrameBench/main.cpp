@@ -0,0 +1,238 @@
+/**********************************************************************
+ * Source File:
+ *    Frame Bench
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Play a scripted game for thousands of frames without opening a
+ *    window and time each part of a frame: the input, the physics and
+ *    the drawing, which goes to a stream that only counts.
+ *    Usage: framebench [output name] [frames] [earlier results.csv]
+ *    Writes <output name>.csv, and compares with the earlier results
+ *    if there are any
+ ************************************************************************/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "benchmark.h"
+#include "uiInteract.h"
+#include "uiDraw.h"
+#include "simulation.h"
+#include "viewport.h"
+
+#ifdef __APPLE__
+#define GL_SILENCE_DEPRECATION
+#include <GLUT/glut.h>    // for the GLUT_KEY_ codes
+#endif // __APPLE__
+
+#ifdef __linux__
+#include <GL/glut.h>      // for the GLUT_KEY_ codes
+#endif // __linux__
+
+using namespace std;
+
+#define DEFAULT_FRAMES 10000   // frames timed
+#define WARMUP_FRAMES  100     // frames played before the timing starts
+#define SCRIPT_LENGTH  400     // frames before the script starts over
+#define BENCH_SEED     1       // the same terrain every run
+
+/*********************************
+ * KEY EVENT
+ * On this frame of the script, press or
+ * release this key
+ *********************************/
+struct KeyEvent
+{
+   int frame;
+   int key;
+   bool isDown;
+};
+
+// One round of play: aim, fire, speed up every other shot, and wait
+// for the shell to come down. At 0.5 s a frame the longest flight is
+// well inside the round
+const KeyEvent SCRIPT[] =
+{
+   {   0, GLUT_KEY_RIGHT, true  },
+   {  40, GLUT_KEY_RIGHT, false },
+   {  40, GLUT_KEY_LEFT,  true  },
+   {  55, GLUT_KEY_LEFT,  false },
+   {  60, GLUT_KEY_UP,    true  },
+   {  80, GLUT_KEY_UP,    false },
+   {  90, ' ',            true  },
+   { 150, 'w',            true  },
+   { 200, GLUT_KEY_DOWN,  true  },
+   { 220, GLUT_KEY_DOWN,  false },
+   { 230, ' ',            true  },
+   { 250, 'w',            true  },
+   { 252, 'w',            true  },
+   { 254, 'w',            true  }
+};
+const int SCRIPT_SIZE = sizeof(SCRIPT) / sizeof(SCRIPT[0]);
+
+/*********************************
+ * PRESS KEYS
+ * Whatever the script says for this frame
+ *********************************/
+void pressKeys(Interface& ui, int frame)
+{
+   frame %= SCRIPT_LENGTH;
+   for (int i = 0; i < SCRIPT_SIZE; i++)
+      if (SCRIPT[i].frame == frame)
+         ui.keyEvent(SCRIPT[i].key, SCRIPT[i].isDown);
+}
+
+/*********************************
+ * FRAME TIMES
+ * Nanoseconds spent in each part of every frame
+ *********************************/
+struct FrameTimes
+{
+   vector<double> input;
+   vector<double> update;
+   vector<double> draw;
+   vector<double> total;
+};
+
+/*********************************
+ * Nanoseconds between two moments
+ *********************************/
+inline double nanoseconds(Benchmark::Clock::time_point begin,
+                          Benchmark::Clock::time_point end)
+{
+   return chrono::duration<double, nano>(end - begin).count();
+}
+
+/*********************************
+ * PLAY
+ * Run the frames the way the game loop does,
+ * only with the physics on this thread, one
+ * step per frame as at 30 frames per second
+ *********************************/
+void play(Simulator& sim, Interface& ui, ogstreamCounter& gout,
+          int numFrames, FrameTimes* pTimes)
+{
+   typedef Benchmark::Clock Clock;
+   const Viewport& viewport = sim.getViewport();
+   Position posText = viewport.toPosition(10.0, viewport.getHeightPixels() - 20.0);
+
+   for (int frame = 0; frame < numFrames; frame++)
+   {
+      pressKeys(ui, frame);
+
+      Clock::time_point start = Clock::now();
+      sim.handleInput(&ui);
+      ui.keyEvent();
+
+      Clock::time_point input = Clock::now();
+      sim.update(TIME_STEP);
+      sim.publish();
+
+      Clock::time_point update = Clock::now();
+      gout.setPosition(posText);
+      sim.draw(gout);
+      gout.flush();
+
+      Clock::time_point end = Clock::now();
+      if (pTimes)
+      {
+         pTimes->input.push_back(nanoseconds(start, input));
+         pTimes->update.push_back(nanoseconds(input, update));
+         pTimes->draw.push_back(nanoseconds(update, end));
+         pTimes->total.push_back(nanoseconds(start, end));
+      }
+   }
+}
+
+/*********************************
+ * Play the scripted game, print and save
+ * the frame times, and compare with a
+ * previous run if we were given one
+ *********************************/
+int main(int argc, char** argv)
+{
+   string name = (argc > 1) ? argv[1] : "framebench";
+   int numFrames = (argc > 2) ? atoi(argv[2]) : DEFAULT_FRAMES;
+   if (numFrames <= 0)
+   {
+      cerr << "The number of frames must be positive\n";
+      return 1;
+   }
+
+   Benchmark baseline;
+   bool isComparing = (argc > 3);
+   if (isComparing && !baseline.readCSV(argv[3]))
+   {
+      cerr << "Unable to read " << argv[3] << "\n";
+      return 1;
+   }
+
+   // The same window as the game, but it is never opened
+   Viewport viewport(40.0, 700.0, 500.0);
+   Interface ui;
+   Simulator sim(viewport, BENCH_SEED);
+   ogstreamCounter gout(viewport, Position());
+
+   FrameTimes times;
+   times.input.reserve(numFrames);
+   times.update.reserve(numFrames);
+   times.draw.reserve(numFrames);
+   times.total.reserve(numFrames);
+
+   play(sim, ui, gout, WARMUP_FRAMES, NULL);
+   gout.resetCounts();
+   play(sim, ui, gout, numFrames, &times);
+   DrawCounts counts = gout.getCounts();
+
+   Benchmark bench;
+   bench.record("frame_input",  1, times.input);
+   bench.record("frame_update", 1, times.update);
+   bench.record("frame_draw",   1, times.draw);
+   bench.record("frame_total",  1, times.total);
+
+   cout << numFrames << " frames, " << sim.getShotsAttempted() << " shots, "
+        << sim.getScore() << " hits\n";
+   cout << left << setw(16) << "phase" << right
+        << setw(12) << "median ns" << setw(12) << "p99 ns"
+        << setw(12) << "min ns" << setw(12) << "mean ns";
+   if (isComparing)
+      cout << setw(10) << "change";
+   cout << "\n" << fixed << setprecision(1);
+
+   for (const BenchmarkResult& r : bench.getResults())
+   {
+      cout << left << setw(16) << r.name << right
+           << setw(12) << r.median << setw(12) << r.p99
+           << setw(12) << r.minimum << setw(12) << r.mean;
+      const BenchmarkResult* before = baseline.find(r.name);
+      if (isComparing && before && before->median > 0.0)
+         cout << setw(9) << showpos << 100.0 * (r.median / before->median - 1.0)
+              << noshowpos << '%';
+      cout << "\n";
+   }
+
+   // what each frame asked to have drawn
+   double perFrame = 1.0 / (double)numFrames;
+   cout << setprecision(2) << "per frame: "
+        << counts.lines * perFrame       << " lines, "
+        << counts.rectangles * perFrame  << " rectangles, "
+        << counts.meshes * perFrame      << " meshes of "
+        << counts.vertices * perFrame    << " vertices, "
+        << counts.projectiles * perFrame << " projectiles, "
+        << counts.howitzers * perFrame   << " howitzers, "
+        << counts.targets * perFrame     << " targets, "
+        << counts.texts * perFrame       << " lines of text in "
+        << counts.textBytes * perFrame   << " bytes\n";
+
+   if (!bench.writeCSV(name + ".csv"))
+   {
+      cerr << "Unable to write " << name << ".csv\n";
+      return 1;
+   }
+
+   cout << "Wrote " << name << ".csv\n";
+   return 0;
+}
@@ -0,0 +1,209 @@
+/***********************************************************************
+ * Source File:
+ *    BENCHMARK
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Time small pieces of the simulator in nanoseconds per operation,
+ *    with enough repetitions that the numbers can be compared from
+ *    one build to the next
+ ************************************************************************/
+
+#include "benchmark.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <cstdlib>
+#include <cassert>
+
+using namespace std;
+
+/*********************************************
+ * BENCHMARK : CONSTRUCTOR
+ *********************************************/
+Benchmark::Benchmark(int numSamples, int numWarmup, double sampleSeconds) :
+   numSamples(numSamples), numWarmup(numWarmup), sampleSeconds(sampleSeconds),
+   pCounters(NULL)
+{
+   assert(numSamples > 0);
+   assert(numWarmup >= 0);
+   assert(sampleSeconds >= 0.0);
+}
+
+/*********************************************
+ * BENCHMARK : PERCENTILE
+ * Nearest rank: the smallest sample that at
+ * least percent of the samples do not exceed
+ *********************************************/
+double Benchmark::percentile(const vector<double>& sorted, double percent)
+{
+   if (sorted.empty())
+      return 0.0;
+   size_t rank = (size_t)ceil(percent / 100.0 * (double)sorted.size());
+   rank = min(max(rank, (size_t)1), sorted.size());
+   return sorted[rank - 1];
+}
+
+/*********************************************
+ * BENCHMARK : SUMMARIZE
+ *********************************************/
+BenchmarkResult Benchmark::summarize(const string& name, uint64_t iterations,
+                                     vector<double> nsPerOp)
+{
+   BenchmarkResult result;
+   result.name = name;
+   result.iterations = iterations;
+   result.numSamples = (int)nsPerOp.size();
+   if (nsPerOp.empty())
+      return result;
+
+   sort(nsPerOp.begin(), nsPerOp.end());
+   size_t middle = nsPerOp.size() / 2;
+   result.median = (nsPerOp.size() % 2) ? nsPerOp[middle]
+                                        : 0.5 * (nsPerOp[middle - 1] + nsPerOp[middle]);
+   result.p99 = percentile(nsPerOp, 99.0);
+   result.minimum = nsPerOp.front();
+   result.mean = accumulate(nsPerOp.begin(), nsPerOp.end(), 0.0) / (double)nsPerOp.size();
+   return result;
+}
+
+/*********************************************
+ * BENCHMARK : RECORD
+ *********************************************/
+const BenchmarkResult& Benchmark::record(const string& name, uint64_t iterations,
+                                         vector<double> nsPerOp)
+{
+   results.push_back(summarize(name, iterations, std::move(nsPerOp)));
+   return results.back();
+}
+
+/*********************************************
+ * BENCHMARK : FIND
+ * The result with this name, or NULL
+ *********************************************/
+const BenchmarkResult* Benchmark::find(const string& name) const
+{
+   for (const BenchmarkResult& result : results)
+      if (result.name == name)
+         return &result;
+   return NULL;
+}
+
+/*********************************************
+ * BENCHMARK : WRITE CSV
+ * Hardware counts are per operation, and left
+ * empty where they were not counted
+ *********************************************/
+void Benchmark::writeCSV(ostream& out) const
+{
+   out << "name,iterations,samples,median_ns,p99_ns,min_ns,mean_ns,steps_per_op";
+   for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      out << ',' << PerfCounters::getName((PerfEvent)i);
+   out << '\n';
+
+   for (const BenchmarkResult& r : results)
+   {
+      out << fixed << setprecision(3)
+          << r.name << ','
+          << r.iterations << ','
+          << r.numSamples << ','
+          << r.median << ','
+          << r.p99 << ','
+          << r.minimum << ','
+          << r.mean << ','
+          << defaultfloat << setprecision(6)
+          << r.stepsPerOp;
+      for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      {
+         out << ',';
+         if (r.counts.isCounted((PerfEvent)i))
+            out << r.counts.value[i];
+      }
+      out << '\n';
+   }
+}
+
+bool Benchmark::writeCSV(const string& filename) const
+{
+   ofstream fout(filename);
+   if (!fout)
+      return false;
+   writeCSV(fout);
+   return fout.good();
+}
+
+/*********************************************
+ * PARSE NUMBER
+ * A whole field of the CSV as a number
+ *********************************************/
+static bool parseNumber(const string& field, double& value)
+{
+   char* pEnd = NULL;
+   value = strtod(field.c_str(), &pEnd);
+   return !field.empty() && *pEnd == '\0';
+}
+
+/*********************************************
+ * BENCHMARK : READ CSV
+ * Replace the results with those written by an
+ * earlier run, to compare against. Files from
+ * before the hardware counts have only the
+ * first seven columns
+ *********************************************/
+bool Benchmark::readCSV(istream& in)
+{
+   string line;
+   if (!getline(in, line) || line.rfind("name,", 0) != 0)
+      return false;
+
+   vector<BenchmarkResult> read;
+   while (getline(in, line))
+   {
+      if (line.empty())
+         continue;
+
+      // split the line at the commas
+      vector<string> fields;
+      istringstream sin(line);
+      string field;
+      while (getline(sin, field, ','))
+         fields.push_back(field);
+      if (!line.empty() && line.back() == ',')
+         fields.push_back("");
+      if (fields.size() < 7)
+         return false;
+
+      BenchmarkResult r;
+      double number[7];
+      for (int i = 1; i < 7; i++)
+         if (!parseNumber(fields[i], number[i]))
+            return false;
+      r.name       = fields[0];
+      r.iterations = (uint64_t)number[1];
+      r.numSamples = (int)number[2];
+      r.median     = number[3];
+      r.p99        = number[4];
+      r.minimum    = number[5];
+      r.mean       = number[6];
+      if (fields.size() > 7 && !parseNumber(fields[7], r.stepsPerOp))
+         return false;
+      for (int i = 0; i < PERF_NUM_EVENTS && 8 + i < (int)fields.size(); i++)
+         if (!fields[8 + i].empty() && !parseNumber(fields[8 + i], r.counts.value[i]))
+            return false;
+      read.push_back(r);
+   }
+
+   results = read;
+   return true;
+}
+
+bool Benchmark::readCSV(const string& filename)
+{
+   ifstream fin(filename);
+   if (!fin)
+      return false;
+   return readCSV(fin);
+}
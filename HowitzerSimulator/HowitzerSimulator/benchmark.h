@@ -0,0 +1,206 @@
+/***********************************************************************
+ * Header File:
+ *    BENCHMARK
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Time small pieces of the simulator in nanoseconds per operation,
+ *    with enough repetitions that the numbers can be compared from
+ *    one build to the next
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include "perfCounters.h"
+
+// Forward declaration for the unit tests
+class TestBenchmark;
+
+#define BENCH_SAMPLES        101     // timed samples per benchmark
+#define BENCH_WARMUP         5       // untimed samples before those
+#define BENCH_SAMPLE_SECONDS 0.001   // each sample runs at least this long
+
+/*********************************************
+ * DO NOT OPTIMIZE
+ * Pretend to read a value so the compiler cannot
+ * throw away the work that produced it
+ *********************************************/
+template <class T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   asm volatile("" : : "r,m"(value) : "memory");
+#else
+   static volatile const void* sink;
+   sink = &value;
+#endif
+}
+
+/*********************************************
+ * BENCHMARK RESULT
+ * One line of the report. Times are in
+ * nanoseconds per operation, and so are the
+ * hardware counts when they were taken
+ *********************************************/
+struct BenchmarkResult
+{
+   std::string name;
+   uint64_t iterations = 0;   // operations in each sample
+   int numSamples = 0;        // samples timed
+   double median = 0.0;       // the typical sample
+   double p99 = 0.0;          // 99% of samples were this fast or faster
+   double minimum = 0.0;      // the fastest sample
+   double mean = 0.0;         // average over all samples
+   double stepsPerOp = 1.0;   // integration steps in each operation
+   PerfCounts counts;         // cycles, misses and so on per operation
+};
+
+/*********************************************
+ * BENCHMARK
+ * First the number of operations per sample is
+ * calibrated, doubling until one sample takes at
+ * least sampleSeconds, so that the clock's
+ * resolution is lost in the noise. Then a few
+ * warm-up samples fill the caches and settle the
+ * branch predictors, and numSamples more are
+ * timed. The median and the 99th percentile of
+ * those are reported rather than the mean alone,
+ * because the odd sample interrupted by the OS
+ * pulls the mean up without saying anything
+ * about the code. Given PerfCounters, the timed
+ * samples are also counted by the hardware
+ *********************************************/
+class Benchmark
+{
+public:
+   friend ::TestBenchmark;
+
+   typedef std::chrono::steady_clock Clock;
+
+   Benchmark(int numSamples = BENCH_SAMPLES, int numWarmup = BENCH_WARMUP,
+             double sampleSeconds = BENCH_SAMPLE_SECONDS);
+
+   // Time an operation and add it to the results. The operation may
+   // return a value, which is kept from the optimizer. A trajectory
+   // says how many steps it takes so counts can be given per step
+   template <class Op>
+   const BenchmarkResult& run(const std::string& name, Op op, double stepsPerOp = 1.0);
+
+   // Count with the hardware as well as time, or NULL to stop. Counters
+   // that are not available are the same as NULL
+   void setCounters(PerfCounters* pCounters) { this->pCounters = pCounters; }
+
+   // Add samples timed somewhere else, such as one per frame
+   const BenchmarkResult& record(const std::string& name, uint64_t iterations,
+                                 std::vector<double> nsPerOp);
+
+   // Median, 99th percentile, minimum and mean of a set of samples
+   static BenchmarkResult summarize(const std::string& name, uint64_t iterations,
+                                    std::vector<double> nsPerOp);
+
+   // Everything run so far
+   const std::vector<BenchmarkResult>& getResults() const { return results; }
+   const BenchmarkResult* find(const std::string& name) const;
+
+   // Comma-separated values with a header row, one line per benchmark
+   void writeCSV(std::ostream& out) const;
+   bool writeCSV(const std::string& filename) const;
+   bool readCSV(std::istream& in);
+   bool readCSV(const std::string& filename);
+
+private:
+   // Seconds to run the operation so many times, counting just those
+   // runs with pCounters if there are any
+   template <class Op>
+   static double time(Op& op, uint64_t iterations, PerfCounters* pCounters = NULL);
+
+   // Operations needed for one sample to last sampleSeconds
+   template <class Op>
+   uint64_t calibrate(Op& op) const;
+
+   // The value at percent of the way through sorted samples
+   static double percentile(const std::vector<double>& sorted, double percent);
+
+   int numSamples;                          // timed per benchmark
+   int numWarmup;                           // untimed first
+   double sampleSeconds;                    // shortest sample
+   PerfCounters* pCounters;                 // NULL when only timing
+   std::vector<BenchmarkResult> results;    // in the order they were run
+};
+
+/*********************************************
+ * BENCHMARK : RUN
+ *********************************************/
+template <class Op>
+const BenchmarkResult& Benchmark::run(const std::string& name, Op op, double stepsPerOp)
+{
+   uint64_t iterations = calibrate(op);
+
+   for (int i = 0; i < numWarmup; i++)
+      time(op, iterations);
+
+   PerfCounters* pCounting = (pCounters && pCounters->isAvailable()) ? pCounters : NULL;
+   if (pCounting)
+      pCounting->reset();
+
+   std::vector<double> nsPerOp;
+   nsPerOp.reserve(numSamples);
+   for (int i = 0; i < numSamples; i++)
+      nsPerOp.push_back(time(op, iterations, pCounting) * 1e9 / (double)iterations);
+
+   PerfCounts counts;
+   if (pCounting)
+      counts = pCounting->read();
+
+   record(name, iterations, std::move(nsPerOp));
+   BenchmarkResult& result = results.back();
+   result.stepsPerOp = stepsPerOp;
+   if (counts.isAnyCounted())
+      result.counts = counts / ((double)iterations * (double)numSamples);
+   return result;
+}
+
+/*********************************************
+ * BENCHMARK : TIME
+ * The counters run inside the clock, around the
+ * loop alone, so they see none of the clock or
+ * the bookkeeping between samples. The clock
+ * sees the two calls that switch them, a few
+ * microseconds against a sample of a millisecond
+ * or more
+ *********************************************/
+template <class Op>
+double Benchmark::time(Op& op, uint64_t iterations, PerfCounters* pCounters)
+{
+   Clock::time_point start = Clock::now();
+   if (pCounters)
+      pCounters->resume();
+   for (uint64_t i = 0; i < iterations; i++)
+   {
+      if constexpr (std::is_void_v<decltype(op())>)
+         op();
+      else
+         doNotOptimize(op());
+   }
+   if (pCounters)
+      pCounters->pause();
+   return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/*********************************************
+ * BENCHMARK : CALIBRATE
+ *********************************************/
+template <class Op>
+uint64_t Benchmark::calibrate(Op& op) const
+{
+   uint64_t iterations = 1;
+   while (iterations < (uint64_t(1) << 40) && time(op, iterations) < sampleSeconds)
+      iterations *= 2;
+   return iterations;
+}
@@ -0,0 +1,126 @@
+/***********************************************************************
+ * Source File:
+ *    DISPERSION
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Fire the same shot many times with small random errors and
+ *    measure how the impacts spread out around the target
+ ************************************************************************/
+
+#include "dispersion.h"
+#include "firingTable.h"
+#include "ground.h"
+#include "random.h"
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+using namespace std;
+
+/*********************************************
+ * DISPERSION : CONSTRUCTOR
+ *********************************************/
+Dispersion::Dispersion(double angle, double muzzleVelocity,
+                       double targetRange, double targetElevation) :
+   angle(angle), muzzleVelocity(muzzleVelocity),
+   targetRange(targetRange), targetElevation(targetElevation),
+   hitTolerance(HIT_TOLERANCE)
+{
+}
+
+/*********************************************
+ * DISPERSION : FIRE
+ * Draw this round's errors and fly it. The
+ * simulation is two dimensional, so an error in
+ * azimuth swings the whole trajectory sideways.
+ * The round number picks the Philox stream
+ *********************************************/
+Impact Dispersion::fire(size_t shot, uint64_t seed) const
+{
+   Philox random(seed, shot);
+   double n[6];
+   fillNormal(random, n, 6);
+
+   double azimuth = errors.azimuth * n[2] * M_PI / 180.0;
+   ShellDynamics dynamics(DEFAULT_PROJECTILE_WEIGHT + errors.mass * n[3],
+                          DEFAULT_PROJECTILE_RADIUS + errors.radius * n[4],
+                          max(0.0, 1.0 + errors.densityScale * n[5]));
+   FiringSolution s = FiringTable::fire(angle + errors.elevation * n[0],
+                                        muzzleVelocity + errors.muzzleVelocity * n[1],
+                                        targetElevation, dynamics);
+
+   if (s.timeOfFlight <= 0.0)
+      return Impact{ numeric_limits<float>::quiet_NaN(), 0.0f };
+   return Impact{ (float)(s.range * cos(azimuth)), (float)(s.range * sin(azimuth)) };
+}
+
+/*********************************************
+ * DISPERSION : RUN
+ *********************************************/
+DispersionResult Dispersion::run(size_t numShots, uint64_t seed, ThreadPool& pool)
+{
+   impacts.resize(numShots);
+   pool.parallelFor(numShots, DISPERSION_GRAIN, [&](size_t begin, size_t end)
+   {
+      for (size_t i = begin; i < end; i++)
+         impacts[i] = fire(i, seed);
+   });
+   return summarize();
+}
+
+/*********************************************
+ * DISPERSION : SUMMARIZE
+ * Sums run in round order and the medians come
+ * from nth_element, so the result depends only
+ * on the impacts, never on the threads
+ *********************************************/
+DispersionResult Dispersion::summarize() const
+{
+   DispersionResult result = { impacts.size(), 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+   size_t numHits = 0;
+   for (const Impact& impact : impacts)
+   {
+      if (isnan(impact.range))
+         continue;
+      result.numLanded++;
+      result.meanRange += impact.range;
+      result.meanDeflection += impact.deflection;
+      double dRange = impact.range - targetRange;
+      if (sqrt(dRange * dRange + (double)impact.deflection * impact.deflection) < hitTolerance)
+         numHits++;
+   }
+   if (result.numLanded == 0)
+      return result;
+
+   result.meanRange /= (double)result.numLanded;
+   result.meanDeflection /= (double)result.numLanded;
+   result.hitProbability = (double)numHits / (double)result.numShots;
+
+   // half the rounds fall closer to the mean point than the median
+   vector<double> radial, range, deflection;
+   radial.reserve(result.numLanded);
+   range.reserve(result.numLanded);
+   deflection.reserve(result.numLanded);
+   for (const Impact& impact : impacts)
+      if (!isnan(impact.range))
+      {
+         double dRange = impact.range - result.meanRange;
+         double dDeflection = impact.deflection - result.meanDeflection;
+         radial.push_back(sqrt(dRange * dRange + dDeflection * dDeflection));
+         range.push_back(fabs(dRange));
+         deflection.push_back(fabs(dDeflection));
+      }
+
+   auto median = [](vector<double>& values)
+   {
+      auto middle = values.begin() + values.size() / 2;
+      nth_element(values.begin(), middle, values.end());
+      return *middle;
+   };
+   result.cep = median(radial);
+   result.rangeErrorProbable = median(range);
+   result.deflectionErrorProbable = median(deflection);
+   return result;
+}
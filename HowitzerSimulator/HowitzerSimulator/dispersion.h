@@ -0,0 +1,130 @@
+/***********************************************************************
+ * Header File:
+ *    DISPERSION
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Fire the same shot many times with small random errors and
+ *    measure how the impacts spread out around the target
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "threadPool.h"
+
+// Forward declaration for the unit tests
+class TestDispersion;
+
+// One standard deviation of each error, roughly those of an M777
+#define DEFAULT_SIGMA_MUZZLE_VELOCITY  1.5      // m/s, round to round
+#define DEFAULT_SIGMA_ELEVATION        0.05     // degrees, about one mil of laying error
+#define DEFAULT_SIGMA_AZIMUTH          0.05     // degrees
+#define DEFAULT_SIGMA_MASS             0.1      // kg
+#define DEFAULT_SIGMA_RADIUS           0.0001   // m
+#define DEFAULT_SIGMA_DENSITY          0.01     // fraction of standard air density
+
+#define DISPERSION_GRAIN 256   // shots per chunk handed to a thread
+
+/*********************************************
+ * DISPERSION ERRORS
+ * The standard deviation of each thing that
+ * varies from one round to the next. Each is
+ * drawn from a normal distribution
+ *********************************************/
+struct DispersionErrors
+{
+   DispersionErrors() :
+      muzzleVelocity(DEFAULT_SIGMA_MUZZLE_VELOCITY),
+      elevation(DEFAULT_SIGMA_ELEVATION),
+      azimuth(DEFAULT_SIGMA_AZIMUTH),
+      mass(DEFAULT_SIGMA_MASS),
+      radius(DEFAULT_SIGMA_RADIUS),
+      densityScale(DEFAULT_SIGMA_DENSITY) {}
+
+   double muzzleVelocity;   // m/s
+   double elevation;        // degrees
+   double azimuth;          // degrees left or right of the line of fire
+   double mass;             // kg
+   double radius;           // m
+   double densityScale;     // fraction of the standard atmosphere
+};
+
+/*********************************************
+ * IMPACT
+ * Where one round came down. Floats are plenty
+ * for meters and halve the memory of a 10^7 run.
+ * A round that never came down has NaN range
+ *********************************************/
+struct Impact
+{
+   float range;        // meters down the line of fire
+   float deflection;   // meters to the right of it
+};
+
+/*********************************************
+ * DISPERSION RESULT
+ * The spread of a run. The probable errors are
+ * medians, so half the rounds fall inside them
+ *********************************************/
+struct DispersionResult
+{
+   size_t numShots;
+   size_t numLanded;                 // rounds that came down at the target elevation
+   double meanRange;                 // mean point of impact, meters down range
+   double meanDeflection;            // and meters to the right
+   double cep;                       // circular error probable about the mean point
+   double rangeErrorProbable;        // REP: median range error about the mean point
+   double deflectionErrorProbable;   // DEP: median deflection error
+   double hitProbability;            // fraction within the hit tolerance of the target
+};
+
+/*********************************************
+ * DISPERSION
+ * A Monte Carlo run of one firing solution. Every
+ * round draws its errors from its own stream of
+ * random numbers, fixed by the seed and the round
+ * number, and writes its impact to its own slot.
+ * Nothing depends on which thread flew which
+ * round, so a seed gives the same answer on any
+ * number of threads
+ *********************************************/
+class Dispersion
+{
+public:
+   friend ::TestDispersion;
+
+   // Aim: angle from vertical in degrees, and a target this many meters
+   // down range and this many meters above the gun
+   Dispersion(double angle, double muzzleVelocity,
+              double targetRange, double targetElevation = 0.0);
+
+   void setErrors(const DispersionErrors& errors) { this->errors = errors; }
+   const DispersionErrors& getErrors() const { return errors; }
+
+   // A round is a hit if it lands within this many meters of the target
+   void setHitTolerance(double hitTolerance) { this->hitTolerance = hitTolerance; }
+
+   // Fire numShots rounds across the pool
+   DispersionResult run(size_t numShots, uint64_t seed, ThreadPool& pool);
+
+   // Where each round of the last run came down
+   const std::vector<Impact>& getImpacts() const { return impacts; }
+
+private:
+   // Fly round number shot of a run with this seed
+   Impact fire(size_t shot, uint64_t seed) const;
+
+   // Reduce the impacts to the statistics
+   DispersionResult summarize() const;
+
+   double angle;             // degrees from vertical
+   double muzzleVelocity;    // m/s
+   double targetRange;       // meters down range
+   double targetElevation;   // meters above the gun
+   double hitTolerance;      // meters
+   DispersionErrors errors;
+   std::vector<Impact> impacts;   // one per round, in round order
+};
@@ -0,0 +1,76 @@
+/***********************************************************************
+ * Source File:
+ *    DORMAND PRINCE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    An adaptive integrator that picks its own step size to meet an
+ *    error tolerance and can report the state at any time inside its
+ *    most recent step
+ ************************************************************************/
+
+#include "dormandPrince.h"
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+/*********************************************
+ * DORMAND PRINCE : INTERPOLATE
+ * Evaluate the dense output polynomial of the last
+ * step. Exact at both ends of the step and fourth
+ * order in between
+ *********************************************/
+BallisticState DormandPrince::interpolate(double time) const
+{
+   assert(isStarted);
+
+   double span = t - tPrevious;
+   if (span <= 0.0)
+      return state;
+
+   double theta = (time - tPrevious) / span;
+   double theta1 = 1.0 - theta;
+
+   // y0 + θ(Δ + (1-θ)(b + θ(c + (1-θ)d)))
+   BallisticState r;
+   r.x  = dense[0].x  + theta * (dense[1].x  + theta1 * (dense[2].x  + theta * (dense[3].x  + theta1 * dense[4].x)));
+   r.y  = dense[0].y  + theta * (dense[1].y  + theta1 * (dense[2].y  + theta * (dense[3].y  + theta1 * dense[4].y)));
+   r.dx = dense[0].dx + theta * (dense[1].dx + theta1 * (dense[2].dx + theta * (dense[3].dx + theta1 * dense[4].dx)));
+   r.dy = dense[0].dy + theta * (dense[1].dy + theta1 * (dense[2].dy + theta * (dense[3].dy + theta1 * dense[4].dy)));
+   return r;
+}
+
+/*********************************************
+ * DORMAND PRINCE : ERROR NORM
+ * Root-mean-square of each component's error
+ * divided by what that component is allowed.
+ * A step is kept when this is at most one
+ *********************************************/
+double DormandPrince::errorNorm(const BallisticState& error,
+                                const BallisticState& s0,
+                                const BallisticState& s1) const
+{
+   double ex  = error.x  / (absTolerance + relTolerance * max(fabs(s0.x),  fabs(s1.x)));
+   double ey  = error.y  / (absTolerance + relTolerance * max(fabs(s0.y),  fabs(s1.y)));
+   double edx = error.dx / (absTolerance + relTolerance * max(fabs(s0.dx), fabs(s1.dx)));
+   double edy = error.dy / (absTolerance + relTolerance * max(fabs(s0.dy), fabs(s1.dy)));
+   return sqrt(0.25 * (ex * ex + ey * ey + edx * edx + edy * edy));
+}
+
+/*********************************************
+ * DORMAND PRINCE : INITIAL STEP
+ * One percent of the time it would take the state
+ * to change by its own size. The controller fixes
+ * a poor guess within a step or two
+ *********************************************/
+double DormandPrince::initialStep() const
+{
+   double size = sqrt(state.x * state.x + state.y * state.y +
+                      state.dx * state.dx + state.dy * state.dy);
+   double rate = sqrt(k1.x * k1.x + k1.y * k1.y + k1.dx * k1.dx + k1.dy * k1.dy);
+
+   double guess = (size < 1e-5 || rate < 1e-5) ? 1e-6 : 0.01 * size / rate;
+   return min(max(guess, 1e-6), maxStep);
+}
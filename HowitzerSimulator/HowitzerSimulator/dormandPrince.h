@@ -0,0 +1,282 @@
+/***********************************************************************
+ * Header File:
+ *    DORMAND PRINCE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    An adaptive integrator that picks its own step size to meet an
+ *    error tolerance and can report the state at any time inside its
+ *    most recent step
+ ************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+#include "integrator.h"
+
+// Default tolerances. Positions are in meters and velocities in m/s, so
+// the absolute tolerance is about a millimeter or a millimeter per second
+#define DEFAULT_ABSOLUTE_TOLERANCE 1e-3
+#define DEFAULT_RELATIVE_TOLERANCE 1e-6
+#define DEFAULT_MAX_STEP           10.0    // seconds
+
+// Forward declaration for the unit tests
+class TestIntegrator;
+
+/*********************************************************
+ * DORMAND-PRINCE
+ * The embedded Runge-Kutta 5(4) pair of Dormand and Prince.
+ * Each step costs six new evaluations (the seventh is reused
+ * as the first of the next step) and produces a fifth-order
+ * answer plus a fourth-order one. Their difference estimates
+ * the error, which sets the size of the next step: large in
+ * the thin, smooth upper atmosphere and small through the
+ * transonic drag spike.
+ *
+ * After each step, interpolate(t) returns a fourth-order
+ * estimate of the state anywhere between getPreviousTime()
+ * and getTime() at no extra cost (dense output).
+ *********************************************************/
+class DormandPrince
+{
+public:
+   friend ::TestIntegrator;
+
+   DormandPrince(double absTolerance = DEFAULT_ABSOLUTE_TOLERANCE,
+                 double relTolerance = DEFAULT_RELATIVE_TOLERANCE) :
+      absTolerance(absTolerance), relTolerance(relTolerance),
+      maxStep(DEFAULT_MAX_STEP), h(0.0), t(0.0), tPrevious(0.0),
+      isStarted(false), wasRejected(false),
+      numEvaluations(0), numAccepted(0), numRejected(0)
+   {
+      assert(absTolerance > 0.0 || relTolerance > 0.0);
+   }
+
+   // Set how accurate each step must be
+   void setTolerance(double absTolerance, double relTolerance)
+   {
+      assert(absTolerance > 0.0 || relTolerance > 0.0);
+      this->absTolerance = absTolerance;
+      this->relTolerance = relTolerance;
+   }
+
+   // Never take a step longer than this many seconds
+   void setMaxStep(double maxStep)
+   {
+      assert(maxStep > 0.0);
+      this->maxStep = maxStep;
+   }
+
+   // Begin integrating from a state at a given time
+   template <class Dynamics>
+   void start(const BallisticState& s, double time, const Dynamics& accel);
+
+   // Forget the current integration; the next start() begins afresh
+   void stop() { isStarted = false; }
+
+   // Take one accepted step, shrinking and retrying as often as the
+   // error estimate requires. Returns the new time
+   template <class Dynamics>
+   double step(const Dynamics& accel);
+
+   // Step until the given time has been reached or passed
+   template <class Dynamics>
+   void advanceTo(double time, const Dynamics& accel)
+   {
+      while (t < time)
+         step(accel);
+   }
+
+   // The state at any time inside the most recent step
+   BallisticState interpolate(double time) const;
+
+   // When an event went from g0 > 0 at t0 to g1 <= 0 at t1, both inside
+   // the most recent step, find when it crossed zero. See integrator.h
+   template <class Event>
+   double locate(double t0, double g0, double t1, double g1, const Event& g) const
+   {
+      return locateEvent(t0, g0, t1, g1,
+                         [this](double time) { return interpolate(time); }, g);
+   }
+
+   // Is a time inside the most recent step?
+   bool covers(double time) const
+   {
+      return isStarted && tPrevious <= time && time <= t;
+   }
+
+   // Getters
+   bool hasStarted() const { return isStarted; }
+   const BallisticState& getState() const { return state; }
+   const BallisticState& getPreviousState() const { return statePrevious; }
+   double getTime() const { return t; }
+   double getPreviousTime() const { return tPrevious; }
+   double getStepSize() const { return h; }
+   int getNumEvaluations() const { return numEvaluations; }
+   int getNumAccepted() const { return numAccepted; }
+   int getNumRejected() const { return numRejected; }
+
+private:
+   // The derivative of a state: velocity and acceleration
+   template <class Dynamics>
+   BallisticState derivative(const BallisticState& s, const Dynamics& accel)
+   {
+      numEvaluations++;
+      Acceleration a = accel(s);
+      return BallisticState{ s.dx, s.dy, a.getDDX(), a.getDDY() };
+   }
+
+   // Scaled root-mean-square error of one trial step
+   double errorNorm(const BallisticState& error,
+                    const BallisticState& s0, const BallisticState& s1) const;
+
+   // A reasonable first step from the size of the state and its derivative
+   double initialStep() const;
+
+   double absTolerance;            // absolute error allowed per step
+   double relTolerance;            // error allowed relative to the state
+   double maxStep;                 // longest step allowed
+   double h;                       // size of the next step to try
+   double t;                       // time of the current state
+   double tPrevious;               // time at the start of the last step
+   BallisticState state;           // current state
+   BallisticState statePrevious;   // state at the start of the last step
+   BallisticState k1;              // derivative at the current state
+   BallisticState dense[5];        // interpolation coefficients of the last step
+   bool isStarted;                 // has start() been called?
+   bool wasRejected;               // was the last trial step rejected?
+   int numEvaluations;             // calls to the dynamics so far
+   int numAccepted;                // steps kept
+   int numRejected;                // steps thrown away and retried
+};
+
+/*********************************************************
+ * STATE ARITHMETIC
+ * a + h * (c1*k1 + c2*k2 + ...) for the stage formulas
+ *********************************************************/
+inline BallisticState combine(const BallisticState& a, double h,
+                              double c1, const BallisticState& k1,
+                              double c2 = 0.0, const BallisticState& k2 = BallisticState(),
+                              double c3 = 0.0, const BallisticState& k3 = BallisticState(),
+                              double c4 = 0.0, const BallisticState& k4 = BallisticState(),
+                              double c5 = 0.0, const BallisticState& k5 = BallisticState(),
+                              double c6 = 0.0, const BallisticState& k6 = BallisticState())
+{
+   BallisticState r;
+   r.x  = a.x  + h * (c1 * k1.x  + c2 * k2.x  + c3 * k3.x  + c4 * k4.x  + c5 * k5.x  + c6 * k6.x);
+   r.y  = a.y  + h * (c1 * k1.y  + c2 * k2.y  + c3 * k3.y  + c4 * k4.y  + c5 * k5.y  + c6 * k6.y);
+   r.dx = a.dx + h * (c1 * k1.dx + c2 * k2.dx + c3 * k3.dx + c4 * k4.dx + c5 * k5.dx + c6 * k6.dx);
+   r.dy = a.dy + h * (c1 * k1.dy + c2 * k2.dy + c3 * k3.dy + c4 * k4.dy + c5 * k5.dy + c6 * k6.dy);
+   return r;
+}
+
+/*********************************************
+ * DORMAND PRINCE : START
+ * Remember the initial state and pick a first step
+ *********************************************/
+template <class Dynamics>
+void DormandPrince::start(const BallisticState& s, double time, const Dynamics& accel)
+{
+   state = statePrevious = s;
+   t = tPrevious = time;
+   k1 = derivative(s, accel);
+   for (int i = 0; i < 5; i++)
+      dense[i] = BallisticState();
+   dense[0] = s;
+   isStarted = true;
+   wasRejected = false;
+   h = initialStep();
+}
+
+/*********************************************
+ * DORMAND PRINCE : STEP
+ * One accepted step of the 5(4) pair. The Butcher
+ * tableau and the dense output weights are those
+ * published by Dormand and Prince (1980) and
+ * Shampine (1986)
+ *********************************************/
+template <class Dynamics>
+double DormandPrince::step(const Dynamics& accel)
+{
+   assert(isStarted);
+
+   while (true)
+   {
+      h = std::min(h, maxStep);
+
+      // the six new stages
+      BallisticState s2 = combine(state, h, 1.0 / 5.0, k1);
+      BallisticState k2 = derivative(s2, accel);
+      BallisticState s3 = combine(state, h, 3.0 / 40.0, k1, 9.0 / 40.0, k2);
+      BallisticState k3 = derivative(s3, accel);
+      BallisticState s4 = combine(state, h, 44.0 / 45.0, k1, -56.0 / 15.0, k2,
+                                  32.0 / 9.0, k3);
+      BallisticState k4 = derivative(s4, accel);
+      BallisticState s5 = combine(state, h, 19372.0 / 6561.0, k1, -25360.0 / 2187.0, k2,
+                                  64448.0 / 6561.0, k3, -212.0 / 729.0, k4);
+      BallisticState k5 = derivative(s5, accel);
+      BallisticState s6 = combine(state, h, 9017.0 / 3168.0, k1, -355.0 / 33.0, k2,
+                                  46732.0 / 5247.0, k3, 49.0 / 176.0, k4,
+                                  -5103.0 / 18656.0, k5);
+      BallisticState k6 = derivative(s6, accel);
+
+      // the fifth-order answer, and the derivative there (reused next step)
+      BallisticState next = combine(state, h, 35.0 / 384.0, k1, 500.0 / 1113.0, k3,
+                                    125.0 / 192.0, k4, -2187.0 / 6784.0, k5,
+                                    11.0 / 84.0, k6);
+      BallisticState k7 = derivative(next, accel);
+
+      // difference between the fifth- and fourth-order answers
+      BallisticState zero = BallisticState();
+      BallisticState error = combine(zero, h, 71.0 / 57600.0, k1, -71.0 / 16695.0, k3,
+                                     71.0 / 1920.0, k4, -17253.0 / 339200.0, k5,
+                                     22.0 / 525.0, k6);
+      error = combine(error, h, -1.0 / 40.0, k7);
+      double norm = errorNorm(error, state, next);
+
+      // the next step grows or shrinks with the fifth root of the error
+      double factor = 0.9 * pow(std::max(norm, 1e-10), -0.2);
+      factor = std::max(0.2, std::min(10.0, factor));
+
+      if (norm > 1.0)
+      {
+         // too much error: shrink and try again
+         h *= factor;
+         wasRejected = true;
+         numRejected++;
+         continue;
+      }
+
+      // dense output coefficients for interpolate()
+      BallisticState rise = combine(next, -1.0, 1.0, state);
+      BallisticState bspl = combine(rise, -h, 1.0, k1);
+      bspl = combine(zero, -1.0, 1.0, bspl);
+      dense[0] = state;
+      dense[1] = rise;
+      dense[2] = bspl;
+      dense[3] = combine(rise, -h, 1.0, k7);
+      dense[3] = combine(dense[3], -1.0, 1.0, bspl);
+      dense[4] = combine(zero, h,
+                         -12715105075.0 / 11282082432.0, k1,
+                         87487479700.0 / 32700410799.0, k3,
+                         -10690763975.0 / 1880347072.0, k4,
+                         701980252875.0 / 199316789632.0, k5,
+                         -1453857185.0 / 822651844.0, k6);
+      dense[4] = combine(dense[4], h, 69997945.0 / 29380423.0, k7);
+
+      // accept the step
+      statePrevious = state;
+      tPrevious = t;
+      state = next;
+      t += h;
+      k1 = k7;
+      numAccepted++;
+
+      // do not grow right after a rejection
+      h = std::min(h * (wasRejected ? std::min(1.0, factor) : factor), maxStep);
+      wasRejected = false;
+      return t;
+   }
+}
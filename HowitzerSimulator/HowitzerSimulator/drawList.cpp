@@ -0,0 +1,297 @@
+/***********************************************************************
+ * Source File:
+ *    DRAW LIST
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    A frame's worth of draw commands, recorded rather than drawn, and
+ *    then batched into a few large meshes
+ ************************************************************************/
+
+#include "drawList.h"
+#include <cmath>
+#include <cassert>
+
+using namespace std;
+
+/*********************************************
+ * DRAW LIST : ADD
+ * Append a command with its first corner and
+ * color; the caller fills in the rest
+ *********************************************/
+DrawCommand& DrawList::add(DrawKind kind, const PT& pt,
+                           double red, double green, double blue)
+{
+   commands.emplace_back();
+   DrawCommand& command = commands.back();
+   command.kind = kind;
+   command.segment = segment;
+   command.x = (float)pt.x;
+   command.y = (float)pt.y;
+   command.red = (float)red;
+   command.green = (float)green;
+   command.blue = (float)blue;
+   return command;
+}
+
+/*********************************************
+ * DRAW LIST : ADD LINE
+ *********************************************/
+void DrawList::addLine(const PT& begin, const PT& end,
+                       double red, double green, double blue)
+{
+   DrawCommand& command = add(DRAW_LINE, begin, red, green, blue);
+   command.end = { (float)end.x, (float)end.y };
+}
+
+/*********************************************
+ * DRAW LIST : ADD RECTANGLE
+ *********************************************/
+void DrawList::addRectangle(const PT& begin, const PT& end,
+                            double red, double green, double blue)
+{
+   DrawCommand& command = add(DRAW_RECTANGLE, begin, red, green, blue);
+   command.end = { (float)end.x, (float)end.y };
+}
+
+/*********************************************
+ * DRAW LIST : ADD HOWITZER
+ *********************************************/
+void DrawList::addHowitzer(const PT& pt, double angle, double age)
+{
+   DrawCommand& command = add(DRAW_HOWITZER, pt);
+   command.howitzer = { (float)angle, (float)age };
+}
+
+/*********************************************
+ * DRAW LIST : ADD TEXT
+ * The characters go in the text arena with
+ * their terminator, so getText() can hand them
+ * straight to a C string function
+ *********************************************/
+void DrawList::addText(const PT& pt, const char* text)
+{
+   assert(text != nullptr);
+   DrawCommand& command = add(DRAW_TEXT, pt);
+   command.text.iBegin = (uint32_t)this->text.size();
+   this->text.append(text);
+   command.text.length = (uint32_t)this->text.size() - command.text.iBegin;
+   this->text.push_back('\0');
+}
+
+/*********************************************
+ * DRAW LIST : ADD MESH
+ * A mesh ends the segment: nothing recorded
+ * after it is drawn before it
+ *********************************************/
+void DrawList::addMesh(const Mesh& mesh)
+{
+   DrawCommand& command = add(DRAW_MESH, PT());
+   command.pMesh = &mesh;
+   segment++;
+}
+
+/*********************************************
+ * DRAW LIST : CLEAR
+ * Empty the arenas without giving back their
+ * memory
+ *********************************************/
+void DrawList::clear()
+{
+   commands.clear();
+   text.clear();
+   batches.clear();
+   segment = 0;
+}
+
+/*********************************************
+ * DRAW LIST : GET TEXT
+ *********************************************/
+const char* DrawList::getText(const DrawCommand& command) const
+{
+   assert(command.kind == DRAW_TEXT);
+   assert(command.text.iBegin + command.text.length < text.size());
+   return text.data() + command.text.iBegin;
+}
+
+/*********************************************
+ * DRAW LIST : BUILD
+ * One pass, in order, dropping each shape into
+ * the triangle or line bucket of its segment.
+ * The buckets of a segment are drawn before the
+ * mesh that ends it, triangles before lines. A
+ * bucket sort, so shapes in the same bucket keep
+ * the order they were recorded in
+ *********************************************/
+const vector<const Mesh*>& DrawList::build()
+{
+   // two buckets for each segment, reusing last frame's
+   size_t numBuckets = 2 * ((size_t)segment + 1);
+   while (buckets.size() < numBuckets)
+   {
+      buckets.emplace_back(Mesh::TRIANGLES);
+      buckets.emplace_back(Mesh::LINES);
+   }
+   for (size_t i = 0; i < numBuckets; i++)
+      buckets[i].clear();
+   batches.clear();
+
+   // the buckets of a segment, then what ends it
+   auto finish = [this](uint32_t iSegment, const Mesh* pMesh)
+   {
+      if (!buckets[2 * iSegment].empty())
+         batches.push_back(&buckets[2 * iSegment]);
+      if (!buckets[2 * iSegment + 1].empty())
+         batches.push_back(&buckets[2 * iSegment + 1]);
+      if (pMesh != nullptr && !pMesh->empty())
+         batches.push_back(pMesh);
+   };
+
+   for (const DrawCommand& command : commands)
+   {
+      Mesh& triangles = buckets[2 * command.segment];
+      Mesh& lines = buckets[2 * command.segment + 1];
+      PT pt(command.x, command.y);
+
+      switch (command.kind)
+      {
+         case DRAW_LINE:
+            lines.addLine(pt, PT(command.end.x, command.end.y),
+                          command.red, command.green, command.blue);
+            break;
+         case DRAW_RECTANGLE:
+            triangles.addRectangle(pt, PT(command.end.x, command.end.y),
+                                   command.red, command.green, command.blue);
+            break;
+         case DRAW_HOWITZER:
+            tessellateHowitzer(triangles, lines, pt,
+                               command.howitzer.angle, command.howitzer.age);
+            break;
+         case DRAW_MESH:
+            finish(command.segment, command.pMesh);
+            break;
+         case DRAW_TEXT:
+            break;
+      }
+   }
+   finish(segment, nullptr);
+
+   return batches;
+}
+
+/************************************************************************
+ * ROTATE
+ * Rotate a given point (point) around a given origin (center) by a given
+ * number of degrees (angle).
+ *    INPUT  origin   The center point we will rotate around, in pixels
+ *           x,y      Offset from center that we will be rotating
+ *           rotation Rotation in degrees
+ *    OUTPUT point    The new point, in pixels
+ *************************************************************************/
+static PT rotatePosition(const PT& origin, double x, double y, double rotation)
+{
+   // because sine and cosine are expensive, we want to call them only once
+   double cosA = cos(rotation);
+   double sinA = sin(rotation);
+
+   // find the new values
+   return PT(origin.x + x * cosA + y * sinA,
+             origin.y + y * cosA - x * sinA);
+}
+
+/*************************************************************************
+ * QUAD
+ * Four points and a color
+ *************************************************************************/
+struct Quad
+{
+   PT pt1;
+   PT pt2;
+   PT pt3;
+   PT pt4;
+   double r;
+   double g;
+   double b;
+};
+
+/************************************************************************
+ * ADD QUAD
+ * Add a quad, rotated about a point, to a mesh of triangles
+ *   INPUT  quad       The corners, relative to ptRotate
+ *          ptRotate   in pixels
+ *          angle
+ *************************************************************************/
+static void addQuad(Mesh& triangles, const Quad& quad, const PT& ptRotate, double angle)
+{
+   triangles.addQuad(rotatePosition(ptRotate, quad.pt1.x, quad.pt1.y, angle),
+                     rotatePosition(ptRotate, quad.pt2.x, quad.pt2.y, angle),
+                     rotatePosition(ptRotate, quad.pt3.x, quad.pt3.y, angle),
+                     rotatePosition(ptRotate, quad.pt4.x, quad.pt4.y, angle),
+                     quad.r, quad.g, quad.b);
+}
+
+/***********************************************************************
+ * TESSELLATE HOWITZER
+ * The outline of a howitzer as triangles, and its muzzle flash as lines
+ *    pt       The position of the Howitzer on the screen, in pixels
+ *    angle    The angle of the barrel where 0 is straight up
+ *    age      Seconds since the howitzer was fired
+ ***********************************************************************/
+void tessellateHowitzer(Mesh& triangles, Mesh& lines,
+                        const PT& pt, double angle, double age)
+{
+   // outline for the Muzzle, the Base, and the muzzle flash
+   static const Quad muzzle[] =
+   {
+      { {-2.0, 8.0}, {2.0, 8.0}, {2.0, 6.5}, {-2.0, 6.5},
+        0.07, 0.08, 0.03},    // aiming stuff
+      { {-0.5, 0.0}, {0.5, 0.0}, {0.5, 18.0}, {-0.8, 18.0},
+        0.14, 0.16, 0.06},    // barrel
+      { {-1.5, 0.0}, {1.5, 0.0}, {1.5, 10.0}, {-1.5, 10.0},
+        0.29, 0.32, 0.12},    // recoil
+   };
+   static const Quad baseRight[] =
+   {
+      {{ 10.0, 0.0}, {-3.0, 0.0}, {-3.0, 2.0}, {7.0, 2.0},
+        0.29, 0.32, 0.12},      // footing
+      {{5.0, 0.0}, {4.0, 0.0}, {1.0, 5.0}, {1.0, 5.0},
+        0.29, 0.32, 0.12},      // muzzle brace
+      {{-3.0, 0.0}, {-3.0, 3.0}, {-2.0, 3.0}, {-2.0, 0.0},
+        0.0, 0.0, 0.0}          // rear brace
+   };
+   static const PT pointsMuzzleFlash[10][2] =
+   {
+      { {-11,21}, {11,21} },      // least intense
+      { {-11,19}, {11,19} },
+      { {-15,20}, {15,20} },
+      { { -7,21}, { 7,21} },
+      { { -7,19}, { 7,19} },
+      { {-10,20}, {10,20} },
+      { { -2,21}, { 2,21} },
+      { { -2,19}, { 2,19} },
+      { { -5,20}, { 5,20} },
+      { { -2,20}, { 2,20} }      // most intense
+   };
+
+   // Draw the base - Since howitzer only rotates from 0° (up) to 85° (right), always use right base
+   for (const Quad& quad : baseRight)
+      addQuad(triangles, quad, pt, 0.0);
+
+   // Draw the muzzle
+   for (const Quad& quad : muzzle)
+      addQuad(triangles, quad, pt, angle);
+
+   // Now for the muzzle flash
+   if (age >= 0.0 && age < 2.0) // flash duration in seconds
+   {
+      for (int i = 0; i < 10; i++)
+      {
+         double color = (10.0 - (double)i) / 10.0;
+         lines.addLine(rotatePosition(pt, pointsMuzzleFlash[i][0].x,
+                                          pointsMuzzleFlash[i][0].y, angle),
+                       rotatePosition(pt, pointsMuzzleFlash[i][1].x,
+                                          pointsMuzzleFlash[i][1].y, angle),
+                       1.0 /* red % */, color /* green % */, color /* blue % */);
+      }
+   }
+}
@@ -0,0 +1,115 @@
+/***********************************************************************
+ * Header File:
+ *    DRAW LIST
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    A frame's worth of draw commands, recorded rather than drawn, and
+ *    then batched into a few large meshes
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include "position.h"   // for PT
+#include "mesh.h"       // for Mesh
+
+// Forward declaration for the unit tests
+class TestDrawList;
+
+/*********************************************
+ * DRAW COMMAND
+ * One recorded call, in pixels. What the
+ * fields after the first corner mean depends on
+ * the kind, so they share the space
+ *********************************************/
+enum DrawKind : uint8_t { DRAW_LINE, DRAW_RECTANGLE, DRAW_HOWITZER, DRAW_TEXT, DRAW_MESH };
+
+struct DrawCommand
+{
+   struct Corner   { float x; float y; };
+   struct Howitzer { float angle; float age; };
+   struct Text     { uint32_t iBegin; uint32_t length; };
+
+   DrawKind kind;
+   uint32_t segment;        // meshes and the commands either side keep their order
+   float x;                 // first corner, or where the howitzer or the text is
+   float y;
+   float red;
+   float green;
+   float blue;
+   union
+   {
+      Corner   end;         // DRAW_LINE, DRAW_RECTANGLE
+      Howitzer howitzer;    // DRAW_HOWITZER
+      Text     text;        // DRAW_TEXT: where it is in the text arena
+      const Mesh * pMesh;   // DRAW_MESH: owned by the caller until clear()
+   };
+};
+
+/*********************************************
+ * DRAW LIST
+ * Everything drawn in a frame is appended here
+ * instead of going to OpenGL a shape at a time.
+ * The commands and their text live in two
+ * arenas that clear() empties but never frees,
+ * so after the first few frames recording
+ * allocates nothing. build() then buckets the
+ * shapes by primitive: every triangle goes into
+ * one mesh and every line into another, to be
+ * drawn with one call each. The color is part
+ * of each vertex, so it costs nothing to mix
+ * them and is not part of the bucket. A mesh
+ * someone else built already is one call; it
+ * is kept where it is and the shapes are not
+ * moved across it, which keeps the ground
+ * behind what is drawn on it. Text is left in
+ * order for the renderer to draw last. None of
+ * this touches OpenGL, so the same list can be
+ * checked in a unit test or counted in a
+ * benchmark
+ *********************************************/
+class DrawList
+{
+public:
+   friend ::TestDrawList;
+
+   DrawList() : segment(0) {}
+
+   // Record
+   void addLine(const PT& begin, const PT& end,
+                double red = 0.0, double green = 0.0, double blue = 0.0);
+   void addRectangle(const PT& begin, const PT& end,
+                     double red = 0.0, double green = 0.0, double blue = 0.0);
+   void addHowitzer(const PT& pt, double angle, double age);
+   void addText(const PT& pt, const char* text);
+   void addMesh(const Mesh& mesh);
+
+   // Start the next frame, keeping all the memory
+   void clear();
+
+   // What was recorded, in order
+   const std::vector<DrawCommand>& getCommands() const { return commands; }
+   const char* getText(const DrawCommand& command) const;
+
+   // Bucket everything but the text into as few meshes as possible.
+   // They stay valid until the next build() or clear()
+   const std::vector<const Mesh*>& build();
+
+private:
+   DrawCommand& add(DrawKind kind, const PT& pt,
+                    double red = 0.0, double green = 0.0, double blue = 0.0);
+
+   std::vector<DrawCommand> commands;   // arena of commands
+   std::string text;                    // arena of the text, each ends in '\0'
+   uint32_t segment;                    // bumped by every addMesh()
+   std::vector<Mesh> buckets;           // triangles then lines, each segment
+   std::vector<const Mesh*> batches;    // what build() returns
+};
+
+// Turn a howitzer into triangles and, for the muzzle flash, lines
+void tessellateHowitzer(Mesh& triangles, Mesh& lines,
+                        const PT& pt, double angle, double age);
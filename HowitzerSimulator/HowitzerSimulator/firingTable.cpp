@@ -0,0 +1,315 @@
+/***********************************************************************
+ * Source File:
+ *    FIRING TABLE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Where a shell lands for every elevation and charge, computed
+ *    ahead of time across all cores
+ ************************************************************************/
+
+#include "firingTable.h"
+#include "projectile.h"
+#include "dormandPrince.h"
+#include "angle.h"
+#include <thread>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+// Nominal muzzle velocities of the M777 charges with the M795 shell, in
+// m/s, from the smallest charge up to the full charge the game fires
+const double CHARGE_VELOCITIES[] =
+{
+   310.0, 400.0, 510.0, 650.0, DEFAULT_MUZZLE_VELOCITY
+};
+const int NUM_CHARGES = sizeof(CHARGE_VELOCITIES) / sizeof(CHARGE_VELOCITIES[0]);
+
+// Values stored per cell in the binary file
+const int NUM_BINARY_FIELDS = 5;
+
+/*********************************************
+ * FIRING TABLE : CONSTRUCTORS
+ *********************************************/
+FiringTable::FiringTable(double angleStep) :
+   muzzleVelocities(CHARGE_VELOCITIES, CHARGE_VELOCITIES + NUM_CHARGES),
+   minAngle(MIN_ELEVATION_ANGLE), angleStep(angleStep), numAngles(0)
+{
+   assert(angleStep > 0.0);
+   numAngles = (size_t)floor((MAX_ELEVATION_ANGLE - MIN_ELEVATION_ANGLE) / angleStep + 1e-9) + 1;
+   resize();
+}
+
+FiringTable::FiringTable(const vector<double>& muzzleVelocities,
+                         double minAngle, double maxAngle, double angleStep) :
+   muzzleVelocities(muzzleVelocities),
+   minAngle(minAngle), angleStep(angleStep), numAngles(0)
+{
+   assert(angleStep > 0.0);
+   assert(maxAngle >= minAngle);
+   numAngles = (size_t)floor((maxAngle - minAngle) / angleStep + 1e-9) + 1;
+   resize();
+}
+
+/*********************************************
+ * FIRING TABLE : RESIZE
+ * One cell per charge and angle, each labeled
+ * with what it will be fired at
+ *********************************************/
+void FiringTable::resize()
+{
+   solutions.assign(muzzleVelocities.size() * numAngles, FiringSolution());
+   for (size_t charge = 0; charge < muzzleVelocities.size(); charge++)
+      for (size_t row = 0; row < numAngles; row++)
+      {
+         FiringSolution& cell = solutions[charge * numAngles + row];
+         cell.angle = getAngle(row);
+         cell.muzzleVelocity = muzzleVelocities[charge];
+      }
+}
+
+/*********************************************
+ * FIRING TABLE : FIRE
+ * Fly one shell with the adaptive integrator.
+ * The apex and the impact are both events found
+ * on the dense output, so neither depends on
+ * where the steps happened to fall
+ *********************************************/
+FiringSolution FiringTable::fire(double angle, double muzzleVelocity,
+                                 double targetElevation)
+{
+   return fire(angle, muzzleVelocity, targetElevation,
+               ShellDynamics(DEFAULT_PROJECTILE_WEIGHT, DEFAULT_PROJECTILE_RADIUS));
+}
+
+FiringSolution FiringTable::fire(double angle, double muzzleVelocity,
+                                 double targetElevation,
+                                 const ShellDynamics& dynamics)
+{
+   FiringSolution solution = { angle, muzzleVelocity, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+   Velocity v;
+   v.set(Angle(angle), muzzleVelocity);
+   DormandPrince stepper;
+   stepper.start(BallisticState{ 0.0, 0.0, v.getDX(), v.getDY() }, 0.0, dynamics);
+
+   auto height = [=](const BallisticState& s) { return s.y - targetElevation; };
+   auto climb  = [](const BallisticState& s) { return s.dy; };
+
+   while (stepper.getTime() < MAX_FLIGHT_TIME)
+   {
+      stepper.step(dynamics);
+      const BallisticState& before = stepper.getPreviousState();
+      const BallisticState& after = stepper.getState();
+
+      // the apex is where the shell stops climbing
+      if (climb(before) > 0.0 && climb(after) <= 0.0)
+      {
+         double t = stepper.locate(stepper.getPreviousTime(), before.dy,
+                                   stepper.getTime(), after.dy, climb);
+         solution.apex = max(solution.apex, stepper.interpolate(t).y);
+      }
+
+      // the impact is where it comes back down to the target
+      if (height(before) > 0.0 && height(after) <= 0.0)
+      {
+         double t = stepper.locate(stepper.getPreviousTime(), height(before),
+                                   stepper.getTime(), height(after), height);
+         BallisticState impact = stepper.interpolate(t);
+         solution.range = impact.x;
+         solution.timeOfFlight = t;
+         solution.impactAngle = atan2(-impact.dy, fabs(impact.dx)) * 180.0 / M_PI;
+         solution.impactVelocity = sqrt(impact.dx * impact.dx + impact.dy * impact.dy);
+         return solution;
+      }
+   }
+
+   // never came down: leave the impact fields at zero
+   return solution;
+}
+
+/*********************************************
+ * FIRING TABLE : COMPUTE
+ * Each thread takes the next unclaimed cell until
+ * none are left. Cells are written in place, so
+ * there is nothing to merge afterwards
+ *********************************************/
+void FiringTable::compute(unsigned int numThreads)
+{
+   if (numThreads == 0)
+      numThreads = max(1u, thread::hardware_concurrency());
+
+   atomic<size_t> next(0);
+   const size_t total = solutions.size();
+   auto worker = [&]()
+   {
+      for (size_t i = next++; i < total; i = next++)
+         solutions[i] = fire(solutions[i].angle, solutions[i].muzzleVelocity);
+   };
+
+   // this thread is one of the workers
+   vector<thread> threads;
+   for (unsigned int i = 1; i < numThreads; i++)
+      threads.emplace_back(worker);
+   worker();
+   for (thread& t : threads)
+      t.join();
+}
+
+/*********************************************
+ * FIRING TABLE : WRITE BINARY
+ * Layout, in native byte order:
+ *    char[4]  "HWFT"
+ *    uint32   version
+ *    uint32   number of charges
+ *    uint32   number of angles
+ *    double   first angle, angle step
+ *    double   muzzle velocity of each charge
+ *    float[5] range, time of flight, apex, impact
+ *             angle, impact velocity for each cell,
+ *             charge by charge
+ *********************************************/
+void FiringTable::writeBinary(ostream& out) const
+{
+   uint32_t header[3] = { FIRING_TABLE_VERSION,
+                          (uint32_t)muzzleVelocities.size(),
+                          (uint32_t)numAngles };
+   out.write(FIRING_TABLE_MAGIC, 4);
+   out.write((const char*)header, sizeof(header));
+   out.write((const char*)&minAngle, sizeof(double));
+   out.write((const char*)&angleStep, sizeof(double));
+   out.write((const char*)muzzleVelocities.data(), muzzleVelocities.size() * sizeof(double));
+
+   vector<float> cells;
+   cells.reserve(solutions.size() * NUM_BINARY_FIELDS);
+   for (const FiringSolution& s : solutions)
+   {
+      cells.push_back((float)s.range);
+      cells.push_back((float)s.timeOfFlight);
+      cells.push_back((float)s.apex);
+      cells.push_back((float)s.impactAngle);
+      cells.push_back((float)s.impactVelocity);
+   }
+   out.write((const char*)cells.data(), cells.size() * sizeof(float));
+}
+
+bool FiringTable::writeBinary(const string& filename) const
+{
+   ofstream fout(filename, ios::binary);
+   if (!fout)
+      return false;
+   writeBinary(fout);
+   return fout.good();
+}
+
+/*********************************************
+ * BYTES LEFT
+ * How much of the stream is still to be read,
+ * or zero if it cannot tell
+ *********************************************/
+static uint64_t bytesLeft(istream& in)
+{
+   streampos here = in.tellg();
+   if (here == streampos(-1))
+      return 0;
+   in.seekg(0, ios::end);
+   streampos end = in.tellg();
+   in.seekg(here);
+   return (end > here) ? (uint64_t)(end - here) : 0;
+}
+
+/*********************************************
+ * FIRING TABLE : READ BINARY
+ * Replace this table with one from writeBinary().
+ * Returns false, leaving the table alone, if the
+ * data is not a firing table. The counts in the
+ * header are checked against what the stream
+ * holds before anything is allocated, so a
+ * corrupt or cut short file cannot ask for more
+ * memory than it has data. The stream has to
+ * be able to seek for that
+ *********************************************/
+bool FiringTable::readBinary(istream& in)
+{
+   char magic[4];
+   uint32_t header[3];
+   double angles[2];
+   if (!in.read(magic, 4) || memcmp(magic, FIRING_TABLE_MAGIC, 4) != 0)
+      return false;
+   if (!in.read((char*)header, sizeof(header)) || header[0] != FIRING_TABLE_VERSION)
+      return false;
+   if (!in.read((char*)angles, sizeof(angles)) || !(angles[1] > 0.0))
+      return false;
+
+   uint64_t charges = header[1];
+   uint64_t rows = header[2];
+   uint64_t left = bytesLeft(in);
+   if (charges * sizeof(double) > left)
+      return false;
+   left -= charges * sizeof(double);
+   if (charges && rows > left / (sizeof(float) * NUM_BINARY_FIELDS) / charges)
+      return false;
+
+   vector<double> velocities(header[1]);
+   vector<float> cells((size_t)header[1] * header[2] * NUM_BINARY_FIELDS);
+   if (!in.read((char*)velocities.data(), velocities.size() * sizeof(double)) ||
+       !in.read((char*)cells.data(), cells.size() * sizeof(float)))
+      return false;
+
+   muzzleVelocities = velocities;
+   numAngles = header[2];
+   minAngle = angles[0];
+   angleStep = angles[1];
+   resize();
+   for (size_t i = 0; i < solutions.size(); i++)
+   {
+      const float* cell = &cells[i * NUM_BINARY_FIELDS];
+      solutions[i].range = cell[0];
+      solutions[i].timeOfFlight = cell[1];
+      solutions[i].apex = cell[2];
+      solutions[i].impactAngle = cell[3];
+      solutions[i].impactVelocity = cell[4];
+   }
+   return true;
+}
+
+bool FiringTable::readBinary(const string& filename)
+{
+   ifstream fin(filename, ios::binary);
+   if (!fin)
+      return false;
+   return readBinary(fin);
+}
+
+/*********************************************
+ * FIRING TABLE : WRITE CSV
+ * One line per cell for spreadsheets and plotting
+ *********************************************/
+void FiringTable::writeCSV(ostream& out) const
+{
+   out << "muzzle_velocity,angle,range,time_of_flight,apex,impact_angle,impact_velocity\n";
+   out << fixed;
+   for (const FiringSolution& s : solutions)
+      out << setprecision(1) << s.muzzleVelocity << ','
+          << setprecision(2) << s.angle << ','
+          << setprecision(1) << s.range << ','
+          << setprecision(2) << s.timeOfFlight << ','
+          << setprecision(1) << s.apex << ','
+          << setprecision(2) << s.impactAngle << ','
+          << setprecision(1) << s.impactVelocity << '\n';
+}
+
+bool FiringTable::writeCSV(const string& filename) const
+{
+   ofstream fout(filename);
+   if (!fout)
+      return false;
+   writeCSV(fout);
+   return fout.good();
+}
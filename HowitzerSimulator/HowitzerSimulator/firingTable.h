@@ -0,0 +1,110 @@
+/***********************************************************************
+ * Header File:
+ *    FIRING TABLE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Where a shell lands for every elevation and charge, computed
+ *    ahead of time across all cores
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdint>
+#include "howitzer.h"
+#include "projectile.h"
+
+// Forward declaration for the unit tests
+class TestFiringTable;
+
+#define DEFAULT_ANGLE_STEP    0.1     // degrees between rows of the table
+#define FIRING_TABLE_MAGIC    "HWFT"  // first four bytes of the binary file
+#define FIRING_TABLE_VERSION  1
+
+/*********************************************
+ * FIRING SOLUTION
+ * One row of the table: fire at this angle and
+ * muzzle velocity from level ground, and this
+ * is what happens
+ *********************************************/
+struct FiringSolution
+{
+   double angle;            // degrees, 0 is straight up as in Howitzer
+   double muzzleVelocity;   // m/s
+   double range;            // horizontal distance to impact in meters
+   double timeOfFlight;     // seconds from firing to impact
+   double apex;             // highest altitude reached in meters
+   double impactAngle;      // degrees below horizontal at impact
+   double impactVelocity;   // speed at impact in m/s
+};
+
+/*********************************************
+ * FIRING TABLE
+ * A grid of firing solutions: one row per angle
+ * from MIN_ELEVATION_ANGLE to MAX_ELEVATION_ANGLE
+ * for each charge (muzzle velocity). Every cell is
+ * independent, so compute() hands them out to one
+ * thread per core and the result does not depend
+ * on the number of threads
+ *********************************************/
+class FiringTable
+{
+public:
+   friend ::TestFiringTable;
+
+   // A table for the standard M777 charges
+   FiringTable(double angleStep = DEFAULT_ANGLE_STEP);
+
+   // A table for any set of muzzle velocities and angles
+   FiringTable(const std::vector<double>& muzzleVelocities,
+               double minAngle  = MIN_ELEVATION_ANGLE,
+               double maxAngle  = MAX_ELEVATION_ANGLE,
+               double angleStep = DEFAULT_ANGLE_STEP);
+
+   // Fly every cell of the table. Zero threads means one per core
+   void compute(unsigned int numThreads = 0);
+
+   // Fly a single shell until it comes down to targetElevation meters
+   // above the gun. If it never gets that high, timeOfFlight stays zero
+   static FiringSolution fire(double angle, double muzzleVelocity,
+                              double targetElevation = 0.0);
+   
+   // The same for a shell other than the standard M795
+   static FiringSolution fire(double angle, double muzzleVelocity,
+                              double targetElevation,
+                              const ShellDynamics& dynamics);
+
+   // Compact binary file: a small header then five floats per cell
+   void writeBinary(std::ostream& out) const;
+   bool writeBinary(const std::string& filename) const;
+   bool readBinary(std::istream& in);
+   bool readBinary(const std::string& filename);
+
+   // Comma-separated values with a header row, one line per cell
+   void writeCSV(std::ostream& out) const;
+   bool writeCSV(const std::string& filename) const;
+
+   // Getters
+   size_t getNumCharges() const { return muzzleVelocities.size(); }
+   size_t getNumAngles() const { return numAngles; }
+   double getMuzzleVelocity(size_t charge) const { return muzzleVelocities[charge]; }
+   double getAngle(size_t row) const { return minAngle + angleStep * (double)row; }
+   double getAngleStep() const { return angleStep; }
+   const FiringSolution& get(size_t charge, size_t row) const
+   {
+      return solutions[charge * numAngles + row];
+   }
+
+private:
+   // Set up the rows and clear the cells
+   void resize();
+
+   std::vector<double> muzzleVelocities;   // one per charge, in m/s
+   double minAngle;                         // first row, in degrees
+   double angleStep;                        // degrees between rows
+   size_t numAngles;                        // rows per charge
+   std::vector<FiringSolution> solutions;   // charge-major grid of cells
+};
@@ -0,0 +1,70 @@
+/***********************************************************************
+ * Source File:
+ *    FLIGHT PATH
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    The recorded trajectory of a projectile, kept in one
+ *    contiguous block of memory
+ ************************************************************************/
+
+#include "flightPath.h"
+#include <algorithm>
+
+using namespace std;
+
+/*********************************************
+ * FLIGHT PATH : CONFIGURE
+ * Set the capacity and the mode. Changing either
+ * starts a fresh path
+ *********************************************/
+void FlightPath::configure(size_t capacity, bool isRing)
+{
+   assert(capacity > 0);
+
+   this->capacity = capacity;
+   this->isRing = isRing;
+
+   // release the old block so the new capacity takes effect
+   vector<PositionVelocityTime>().swap(buffer);
+   clear();
+}
+
+/*********************************************
+ * FLIGHT PATH : PUSH BACK
+ * Record the newest state. The block is reserved
+ * on first use; after that nothing is allocated
+ * unless a growing path outlives its capacity
+ *********************************************/
+void FlightPath::push_back(const PositionVelocityTime& pvt)
+{
+   if (buffer.capacity() == 0)
+      buffer.reserve(capacity);
+
+   if (count == 0)
+      launch = pvt;
+   maxAltitude = max(maxAltitude, pvt.pos.getMetersY());
+
+   // a full ring overwrites its oldest state
+   if (isRing && count == capacity)
+   {
+      buffer[head] = pvt;
+      head = (head + 1 == capacity) ? 0 : head + 1;
+      return;
+   }
+
+   buffer.push_back(pvt);
+   count++;
+}
+
+/*********************************************
+ * FLIGHT PATH : CLEAR
+ * Forget the states but hold on to the memory
+ *********************************************/
+void FlightPath::clear()
+{
+   buffer.clear();
+   head = 0;
+   count = 0;
+   maxAltitude = 0.0;
+}
@@ -0,0 +1,139 @@
+/**********************************************************************
+ * Header File:
+ *    FLIGHT PATH
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    The recorded trajectory of a projectile, kept in one
+ *    contiguous block of memory
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cassert>
+#include "position.h"
+#include "velocity.h"
+
+// Forward declarations
+class TestFlightPath;
+class TestProjectile;
+
+// Number of states reserved the first time a flight path is used.
+// At the 0.5s simulation step this covers well over eight minutes of flight
+#define DEFAULT_FLIGHT_PATH_CAPACITY 1024
+
+/**********************************************************************
+ * PositionVelocityTime
+ * Structure to keep track of one moment in the path of the projectile
+ ************************************************************************/
+struct PositionVelocityTime
+{
+   PositionVelocityTime() : pos(), v(), t(0.0) {}
+   PositionVelocityTime(const Position& p, const Velocity& vel, double time)
+      : pos(p), v(vel), t(time) {}
+
+   Position pos;
+   Velocity v;
+   double t;
+};
+
+/**********************************************************************
+ * FlightPath
+ * A contiguous store of PositionVelocityTime states. Memory is reserved
+ * once and reused across flights, so recording a state never allocates
+ * in steady state. In ring mode only the most recent states are kept;
+ * the launch state and the highest altitude are remembered regardless.
+ ************************************************************************/
+class FlightPath
+{
+public:
+   friend ::TestFlightPath;
+   friend ::TestProjectile;
+
+   /*****************************************
+    * CONST ITERATOR
+    * Walks the states from oldest to newest
+    *****************************************/
+   class const_iterator
+   {
+   public:
+      const_iterator(const FlightPath* path, size_t index) :
+         path(path), index(index) {}
+      const PositionVelocityTime& operator*() const { return (*path)[index]; }
+      const PositionVelocityTime* operator->() const { return &(*path)[index]; }
+      const_iterator& operator++() { index++; return *this; }
+      bool operator==(const const_iterator& rhs) const { return index == rhs.index; }
+      bool operator!=(const const_iterator& rhs) const { return index != rhs.index; }
+   private:
+      const FlightPath* path;
+      size_t index;
+   };
+
+   // Grow as needed, reserving the default capacity on first use
+   FlightPath() : capacity(DEFAULT_FLIGHT_PATH_CAPACITY), isRing(false),
+                  head(0), count(0), maxAltitude(0.0) {}
+
+   // Reserve a given capacity. In ring mode, keep only that many states
+   explicit FlightPath(size_t capacity, bool isRing = false) :
+      capacity(capacity), isRing(isRing),
+      head(0), count(0), maxAltitude(0.0)
+   {
+      assert(capacity > 0);
+   }
+
+   // Change the capacity or the mode. This clears the path
+   void configure(size_t capacity, bool isRing);
+
+   // Record one more state, dropping the oldest one if the ring is full
+   void push_back(const PositionVelocityTime& pvt);
+
+   // Forget every state but keep the memory for the next flight
+   void clear();
+
+   // Size queries
+   size_t size() const { return count; }
+   bool empty() const { return count == 0; }
+   size_t getCapacity() const { return capacity; }
+   bool isRingMode() const { return isRing; }
+
+   // Element access in chronological order, 0 being the oldest kept
+   const PositionVelocityTime& operator[](size_t i) const
+   {
+      assert(i < count);
+      size_t index = head + i;
+      if (index >= buffer.size())
+         index -= buffer.size();
+      return buffer[index];
+   }
+   const PositionVelocityTime& front() const { return (*this)[0]; }
+   const PositionVelocityTime& back() const { return (*this)[count - 1]; }
+   PositionVelocityTime& back()
+   {
+      return const_cast<PositionVelocityTime&>(static_cast<const FlightPath&>(*this).back());
+   }
+
+   // The first state of the flight, even if the ring has dropped it
+   const PositionVelocityTime& origin() const
+   {
+      assert(count > 0);
+      return launch;
+   }
+
+   // Highest altitude recorded since the path was last cleared
+   double getMaxAltitude() const { return maxAltitude; }
+
+   // Iteration from oldest to newest
+   const_iterator begin() const { return const_iterator(this, 0); }
+   const_iterator end() const { return const_iterator(this, count); }
+
+private:
+   std::vector<PositionVelocityTime> buffer;  // contiguous state storage
+   PositionVelocityTime launch;   // first state since the last clear
+   size_t capacity;               // states to reserve (or keep, in ring mode)
+   bool isRing;                   // overwrite the oldest state when full?
+   size_t head;                   // buffer index of the oldest state
+   size_t count;                  // number of states currently kept
+   double maxAltitude;            // highest y recorded since the last clear
+};
@@ -0,0 +1,114 @@
+/***********************************************************************
+ * Source File:
+ *    FRAME SCHEDULER
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    When to put the next frame on the screen, by the wall clock, and
+ *    how many were late
+ ************************************************************************/
+
+#include "frameScheduler.h"
+#include <thread>
+#include <cassert>
+
+using namespace std;
+using namespace std::chrono;
+
+/*********************************************
+ * FRAME SCHEDULER : CONSTRUCTOR
+ *********************************************/
+FrameScheduler::FrameScheduler(double framesPerSecond) :
+   deadline(), previous(), interval(Clock::duration::zero()),
+   numFrames(0), numMissed(0), numStill(0)
+{
+   setFramesPerSecond(framesPerSecond);
+}
+
+/*********************************************
+ * FRAME SCHEDULER : SET FRAMES PER SECOND
+ *********************************************/
+void FrameScheduler::setFramesPerSecond(double framesPerSecond)
+{
+   assert(framesPerSecond > 0.0);
+   period = duration_cast<Clock::duration>(duration<double>(1.0 / framesPerSecond));
+}
+
+/*********************************************
+ * FRAME SCHEDULER : GET PERIOD
+ *********************************************/
+double FrameScheduler::getPeriod() const
+{
+   return duration<double>(period).count();
+}
+
+/*********************************************
+ * FRAME SCHEDULER : GET DEADLINE
+ *********************************************/
+FrameScheduler::Clock::time_point FrameScheduler::getDeadline() const
+{
+   return deadline == Clock::time_point() ? Clock::now() : deadline;
+}
+
+/*********************************************
+ * FRAME SCHEDULER : GET FRAME SECONDS
+ *********************************************/
+double FrameScheduler::getFrameSeconds() const
+{
+   return duration<double>(interval).count();
+}
+
+/*********************************************
+ * FRAME SCHEDULER : WAIT FOR DEADLINE
+ * Sleep until just short of the deadline, then
+ * yield the rest: the sleep alone can wake up a
+ * scheduler tick late
+ *********************************************/
+void FrameScheduler::waitForDeadline() const
+{
+   Clock::time_point due = getDeadline();
+   this_thread::sleep_until(due - duration_cast<Clock::duration>(
+                                     duration<double>(FRAME_SPIN_SECONDS)));
+   while (Clock::now() < due)
+      this_thread::yield();
+}
+
+/*********************************************
+ * FRAME SCHEDULER : FRAME DONE
+ * Move the deadline to the next one after now,
+ * counting the ones skipped over
+ *********************************************/
+void FrameScheduler::frameDone(Clock::time_point now, bool isAnimating)
+{
+   numFrames++;
+   numStill = isAnimating ? 0 : numStill + 1;
+   interval = (previous == Clock::time_point()) ? Clock::duration::zero() : now - previous;
+   previous = now;
+
+   // the first frame starts the grid
+   if (deadline == Clock::time_point())
+      deadline = now;
+
+   // every deadline already passed, but the one this frame was for,
+   // went by without a frame
+   if (now >= deadline + period)
+   {
+      Clock::rep numLate = (now - deadline) / period;
+      numMissed += numLate;
+      deadline += numLate * period;
+   }
+   deadline += period;
+}
+
+/*********************************************
+ * FRAME SCHEDULER : WAKE
+ * Blocked frames were never due, so they are
+ * not missed, and the wait was not a frame:
+ * start the grid over
+ *********************************************/
+void FrameScheduler::wake(Clock::time_point now)
+{
+   deadline = now;
+   previous = Clock::time_point();
+   numStill = 0;
+}
@@ -0,0 +1,84 @@
+/***********************************************************************
+ * Header File:
+ *    FRAME SCHEDULER
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    When to put the next frame on the screen, by the wall clock, and
+ *    how many were late
+ ************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+// Forward declaration for the unit tests
+class TestFrameScheduler;
+
+#define DEFAULT_FRAMES_PER_SECOND 30.0
+#define FRAMES_BEFORE_IDLE 15        // still frames before the loop may block
+#define FRAME_SPIN_SECONDS 0.0005    // of each wait spent yielding, not asleep
+
+/*********************************************
+ * FRAME SCHEDULER
+ * Frames are due on a fixed grid of deadlines,
+ * one period apart on the steady clock, which
+ * is wall time that never jumps. The wait is
+ * until the deadline rather than for a length
+ * of time, so time spent drawing does not pile
+ * up as drift. A frame that finishes after its
+ * deadline skips to the next one still ahead,
+ * and each deadline passed over is counted as
+ * missed rather than rushed through. After
+ * FRAMES_BEFORE_IDLE frames in a row with
+ * nothing animating the scheduler is idle, and
+ * the loop can block until something happens;
+ * wake() starts the grid again from now
+ *********************************************/
+class FrameScheduler
+{
+public:
+   friend ::TestFrameScheduler;
+
+   typedef std::chrono::steady_clock Clock;
+
+   FrameScheduler(double framesPerSecond = DEFAULT_FRAMES_PER_SECOND);
+
+   // Seconds between frames
+   void setFramesPerSecond(double framesPerSecond);
+   double getPeriod() const;
+
+   // When the next frame is due. Before the first frame, now
+   Clock::time_point getDeadline() const;
+
+   // Sleep until the next frame is due
+   void waitForDeadline() const;
+
+   // A frame went on the screen at this time. Was anything moving?
+   void frameDone(Clock::time_point now, bool isAnimating);
+
+   // May the loop block until wake()?
+   bool isIdle() const { return numStill >= FRAMES_BEFORE_IDLE; }
+
+   // Something happened: the next frame is due now
+   void wake(Clock::time_point now);
+
+   // Accounting
+   uint64_t getNumFrames() const { return numFrames; }
+   uint64_t getNumMissed() const { return numMissed; }
+
+   // Seconds between the last two frames. Zero until there have been
+   // two since the start or the last wake(): time spent blocked is not
+   // a frame
+   double getFrameSeconds() const;
+
+private:
+   Clock::duration period;       // between deadlines
+   Clock::time_point deadline;   // of the next frame; zero before the first
+   Clock::time_point previous;   // the last frame; zero after wake()
+   Clock::duration interval;     // between the last two frames; zero if unknown
+   uint64_t numFrames;           // put on the screen
+   uint64_t numMissed;           // deadlines passed without a frame
+   int numStill;                 // frames in a row with nothing moving
+};
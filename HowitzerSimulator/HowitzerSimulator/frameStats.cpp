@@ -0,0 +1,155 @@
+/***********************************************************************
+ * Source File:
+ *    FRAME STATS
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Rolling frame time, physics time, steps and draw calls over the
+ *    last couple of seconds, and a histogram of the frame times, for
+ *    the performance overlay
+ ************************************************************************/
+
+#include "frameStats.h"
+#include <cassert>
+#include <cmath>
+
+using namespace std;
+
+// The top of each bucket in milliseconds: 120, 60 and 40 fps, then
+// 30 fps and the frames that missed it by one, two or more deadlines
+static const double bucketLimits[FRAME_STATS_BUCKETS] =
+   { 9.0, 17.0, 25.0, 34.0, 50.0, 67.0, 100.0, INFINITY };
+static const char* bucketNames[FRAME_STATS_BUCKETS] =
+   { "<9", "<17", "<25", "<34", "<50", "<67", "<100", "100+" };
+
+/*********************************************
+ * FRAME STATS : CLEAR
+ *********************************************/
+void FrameStats::clear()
+{
+   iNext = 0;
+   numFrames = 0;
+   sum = Sample{ 0, 0, 0, 0 };
+   histogram.fill(0);
+   previous = FrameCounters();
+   isPrimed = false;
+}
+
+/*********************************************
+ * FRAME STATS : ADD FRAME
+ * The oldest frame leaves the sums and its
+ * bucket as the newest takes its place
+ *********************************************/
+void FrameStats::addFrame(double frameSeconds, const FrameCounters& totals)
+{
+   assert(frameSeconds >= 0.0);
+
+   // what happened since the last reading
+   Sample sample;
+   sample.frameNanoseconds  = (uint64_t)llround(frameSeconds * 1.0e9);
+   sample.updateNanoseconds = totals.updateNanoseconds - previous.updateNanoseconds;
+   sample.numSteps          = totals.numSteps - previous.numSteps;
+   sample.numDrawCalls      = totals.numDrawCalls - previous.numDrawCalls;
+
+   bool isFrame = isPrimed && sample.frameNanoseconds > 0;
+   previous = totals;
+   isPrimed = true;
+   if (!isFrame)
+      return;
+
+   // the oldest leaves
+   Sample& slot = samples[iNext];
+   if (numFrames == FRAME_STATS_WINDOW)
+   {
+      sum.frameNanoseconds  -= slot.frameNanoseconds;
+      sum.updateNanoseconds -= slot.updateNanoseconds;
+      sum.numSteps          -= slot.numSteps;
+      sum.numDrawCalls      -= slot.numDrawCalls;
+      histogram[bucketOf(slot.frameNanoseconds)]--;
+   }
+   else
+      numFrames++;
+
+   // the newest arrives
+   slot = sample;
+   sum.frameNanoseconds  += sample.frameNanoseconds;
+   sum.updateNanoseconds += sample.updateNanoseconds;
+   sum.numSteps          += sample.numSteps;
+   sum.numDrawCalls      += sample.numDrawCalls;
+   histogram[bucketOf(sample.frameNanoseconds)]++;
+   iNext = (iNext + 1) % FRAME_STATS_WINDOW;
+}
+
+/*********************************************
+ * FRAME STATS : GET FRAME SECONDS
+ *********************************************/
+double FrameStats::getFrameSeconds() const
+{
+   return numFrames ? (double)sum.frameNanoseconds * 1.0e-9 / numFrames : 0.0;
+}
+
+/*********************************************
+ * FRAME STATS : GET FRAMES PER SECOND
+ *********************************************/
+double FrameStats::getFramesPerSecond() const
+{
+   return sum.frameNanoseconds ? numFrames / ((double)sum.frameNanoseconds * 1.0e-9) : 0.0;
+}
+
+/*********************************************
+ * FRAME STATS : GET UPDATE SECONDS PER FRAME
+ * The physics runs on its own thread: this is
+ * how much of it lands in a frame, not how much
+ * the frame waited for it
+ *********************************************/
+double FrameStats::getUpdateSecondsPerFrame() const
+{
+   return numFrames ? (double)sum.updateNanoseconds * 1.0e-9 / numFrames : 0.0;
+}
+
+/*********************************************
+ * FRAME STATS : GET STEPS PER SECOND
+ *********************************************/
+double FrameStats::getStepsPerSecond() const
+{
+   return sum.frameNanoseconds ? (double)sum.numSteps / ((double)sum.frameNanoseconds * 1.0e-9) : 0.0;
+}
+
+/*********************************************
+ * FRAME STATS : GET DRAW CALLS PER FRAME
+ *********************************************/
+double FrameStats::getDrawCallsPerFrame() const
+{
+   return numFrames ? (double)sum.numDrawCalls / numFrames : 0.0;
+}
+
+/*********************************************
+ * FRAME STATS : GET BUCKET LIMIT
+ *********************************************/
+double FrameStats::getBucketLimit(int iBucket)
+{
+   assert(0 <= iBucket && iBucket < FRAME_STATS_BUCKETS);
+   return bucketLimits[iBucket];
+}
+
+/*********************************************
+ * FRAME STATS : GET BUCKET NAME
+ *********************************************/
+const char* FrameStats::getBucketName(int iBucket)
+{
+   assert(0 <= iBucket && iBucket < FRAME_STATS_BUCKETS);
+   return bucketNames[iBucket];
+}
+
+/*********************************************
+ * FRAME STATS : BUCKET OF
+ * The first bucket whose top is above the time
+ *********************************************/
+int FrameStats::bucketOf(uint64_t frameNanoseconds)
+{
+   double ms = (double)frameNanoseconds * 1.0e-6;
+   int iBucket = 0;
+   while (iBucket < FRAME_STATS_BUCKETS - 1 && ms >= bucketLimits[iBucket])
+      iBucket++;
+   return iBucket;
+}
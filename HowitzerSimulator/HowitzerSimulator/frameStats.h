@@ -0,0 +1,95 @@
+/***********************************************************************
+ * Header File:
+ *    FRAME STATS
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Rolling frame time, physics time, steps and draw calls over the
+ *    last couple of seconds, and a histogram of the frame times, for
+ *    the performance overlay
+ ************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Forward declaration for the unit tests
+class TestFrameStats;
+
+#define FRAME_STATS_WINDOW 120    // frames in the rolling figures: 4s at 30 fps
+#define FRAME_STATS_BUCKETS 8     // bars in the frame time histogram
+
+/*********************************************
+ * FRAME COUNTERS
+ * Running totals kept by whoever does the work:
+ * they only ever go up, so reading them costs
+ * nothing and the difference between two
+ * readings is what happened in between
+ *********************************************/
+struct FrameCounters
+{
+   uint64_t numSteps = 0;            // physics steps taken
+   uint64_t updateNanoseconds = 0;   // spent taking them
+   uint64_t numDrawCalls = 0;        // sent to the graphics card
+};
+
+/*********************************************
+ * FRAME STATS
+ * Each frame, the frame time and the counters
+ * so far. The window is a ring of the last
+ * FRAME_STATS_WINDOW frames with its sums and
+ * histogram kept as frames come and go, so
+ * adding a frame or reading a figure is the
+ * same small cost however long the window
+ *********************************************/
+class FrameStats
+{
+public:
+   friend ::TestFrameStats;
+
+   FrameStats() { clear(); }
+
+   // A frame took frameSeconds, and the counters now read totals. A
+   // frame time of zero, such as the first after the window was
+   // blocked, only takes the reading
+   void addFrame(double frameSeconds, const FrameCounters& totals);
+
+   // Forget every frame
+   void clear();
+
+   // Frames in the window
+   int getNumFrames() const { return numFrames; }
+
+   // Averages over the window. Zero with no frames
+   double getFrameSeconds() const;
+   double getFramesPerSecond() const;
+   double getUpdateSecondsPerFrame() const;
+   double getStepsPerSecond() const;
+   double getDrawCallsPerFrame() const;
+
+   // Frames in the window by frame time
+   int getBucket(int iBucket) const { return histogram[iBucket]; }
+   static double getBucketLimit(int iBucket);   // milliseconds, the top
+   static const char* getBucketName(int iBucket);
+   static int bucketOf(uint64_t frameNanoseconds);
+
+private:
+   // One frame in the window
+   struct Sample
+   {
+      uint64_t frameNanoseconds;
+      uint64_t updateNanoseconds;
+      uint64_t numSteps;
+      uint64_t numDrawCalls;
+   };
+
+   std::array<Sample, FRAME_STATS_WINDOW> samples;   // the ring
+   int iNext;                 // where the next frame goes
+   int numFrames;             // in the ring
+   Sample sum;                // of the frames in the ring
+   std::array<int, FRAME_STATS_BUCKETS> histogram;
+
+   FrameCounters previous;    // the last reading
+   bool isPrimed;             // has there been one?
+};
@@ -0,0 +1,99 @@
+/***********************************************************************
+ * Source File:
+ *    GLYPH ATLAS
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Where each character of a bitmap font sits in one texture, and
+ *    how to turn a string into quads that draw from it
+ ************************************************************************/
+
+#include "glyphAtlas.h"
+#include <cassert>
+#include <cstring>
+
+using namespace std;
+
+/*********************************************
+ * GLYPH ATLAS : CONSTRUCTOR
+ * Until the font says otherwise, nothing moves
+ * the pen
+ *********************************************/
+GlyphAtlas::GlyphAtlas()
+{
+   memset(advances, 0, sizeof(advances));
+}
+
+/*********************************************
+ * GLYPH ATLAS : GET ORIGIN
+ *********************************************/
+PT GlyphAtlas::getOrigin(unsigned char c)
+{
+   assert(contains(c));
+   int i = c - GLYPH_FIRST;
+   return PT((double)((i % GLYPH_COLUMNS) * GLYPH_CELL_WIDTH + GLYPH_LEFT),
+             (double)((i / GLYPH_COLUMNS) * GLYPH_CELL_HEIGHT + GLYPH_DESCENT));
+}
+
+/*********************************************
+ * GLYPH ATLAS : GET ADVANCE
+ *********************************************/
+int GlyphAtlas::getAdvance(unsigned char c) const
+{
+   return contains(c) ? advances[c - GLYPH_FIRST] : 0;
+}
+
+/*********************************************
+ * GLYPH ATLAS : SET ADVANCE
+ *********************************************/
+void GlyphAtlas::setAdvance(unsigned char c, int pixels)
+{
+   assert(contains(c));
+   assert(pixels >= 0 && pixels < 256);
+   advances[c - GLYPH_FIRST] = (uint8_t)pixels;
+}
+
+/*********************************************
+ * GLYPH ATLAS : ADD TEXT
+ * The whole cell of each character, placed so
+ * its origin lands on the pen. Blank cells such
+ * as spaces only move the pen
+ *********************************************/
+double GlyphAtlas::addText(vector<GlyphVertex>& vertices, const PT& pt, const char* text) const
+{
+   assert(text != nullptr);
+   const float uScale = 1.0f / (float)getWidth();
+   const float vScale = 1.0f / (float)getHeight();
+   double x = pt.x;
+
+   for (const unsigned char* p = (const unsigned char*)text; *p; p++)
+   {
+      if (!contains(*p))
+         continue;
+
+      if (*p != ' ')
+      {
+         // the cell in the atlas and on the screen
+         PT origin = getOrigin(*p);
+         float u0 = (float)(origin.x - GLYPH_LEFT) * uScale;
+         float v0 = (float)(origin.y - GLYPH_DESCENT) * vScale;
+         float u1 = u0 + GLYPH_CELL_WIDTH * uScale;
+         float v1 = v0 + GLYPH_CELL_HEIGHT * vScale;
+         float x0 = (float)(x - GLYPH_LEFT);
+         float y0 = (float)(pt.y - GLYPH_DESCENT);
+         float x1 = x0 + GLYPH_CELL_WIDTH;
+         float y1 = y0 + GLYPH_CELL_HEIGHT;
+
+         vertices.push_back({ x0, y0, u0, v0 });
+         vertices.push_back({ x0, y1, u0, v1 });
+         vertices.push_back({ x1, y1, u1, v1 });
+         vertices.push_back({ x0, y0, u0, v0 });
+         vertices.push_back({ x1, y1, u1, v1 });
+         vertices.push_back({ x1, y0, u1, v0 });
+      }
+
+      x += advances[*p - GLYPH_FIRST];
+   }
+
+   return x - pt.x;
+}
@@ -0,0 +1,82 @@
+/***********************************************************************
+ * Header File:
+ *    GLYPH ATLAS
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Where each character of a bitmap font sits in one texture, and
+ *    how to turn a string into quads that draw from it
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <climits>      // for UCHAR_MAX
+#include "position.h"   // for PT
+
+// Forward declaration for the unit tests
+class TestGlyphAtlas;
+
+#define GLYPH_FIRST        32    // ' ', the first character in the atlas
+#define GLYPH_LAST         255   // the last, so Latin-1 draws as it always has
+static_assert(GLYPH_LAST == UCHAR_MAX, "contains() assumes the atlas runs to the last character");
+#define GLYPH_COLUMNS      16    // cells across the atlas
+#define GLYPH_CELL_WIDTH   16    // pixels
+#define GLYPH_CELL_HEIGHT  16    // pixels
+#define GLYPH_LEFT         2     // pixels of a cell left of where the character starts
+#define GLYPH_DESCENT      4     // pixels of a cell below the baseline
+
+/*********************************************
+ * GLYPH VERTEX
+ * A corner of a character, in pixels, and where
+ * it is in the atlas, from 0 to 1
+ *********************************************/
+struct GlyphVertex
+{
+   float x;
+   float y;
+   float u;
+   float v;
+};
+
+/*********************************************
+ * GLYPH ATLAS
+ * Every character of the font gets a cell of
+ * one texture, in rows from the bottom left. The
+ * font is drawn into the texture once, and then
+ * a string is two triangles a character from it,
+ * so all the text in a frame is a single draw
+ * call rather than a call per character. This
+ * is only the layout; uiDraw.cpp bakes the
+ * texture and draws, and tells the atlas how far
+ * each character moves the pen
+ *********************************************/
+class GlyphAtlas
+{
+public:
+   friend ::TestGlyphAtlas;
+
+   GlyphAtlas();
+
+   // Size of the texture, in pixels. Both are powers of two
+   static int getWidth()  { return GLYPH_COLUMNS * GLYPH_CELL_WIDTH; }
+   static int getHeight() { return GLYPH_COLUMNS * GLYPH_CELL_HEIGHT; }
+
+   // Is the character in the atlas? Every one from GLYPH_FIRST up is
+   static bool contains(unsigned char c) { return c >= GLYPH_FIRST; }
+
+   // Where, in the atlas, the character starts on the baseline
+   static PT getOrigin(unsigned char c);
+
+   // How many pixels the character moves the pen
+   int getAdvance(unsigned char c) const;
+   void setAdvance(unsigned char c, int pixels);
+
+   // Add two triangles a character for the text, its baseline
+   // starting at pt. Returns how wide it is
+   double addText(std::vector<GlyphVertex>& vertices, const PT& pt, const char* text) const;
+
+private:
+   uint8_t advances[GLYPH_LAST - GLYPH_FIRST + 1];
+};
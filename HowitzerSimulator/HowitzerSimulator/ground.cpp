@@ -8,7 +8,8 @@
  ************************************************************************/
 
 #include "ground.h"   // for the Ground class definition
-#include "uiDraw.h"   // for random() and drawLine()
+#include "random.h"   // for Xoshiro256
+#include "profiler.h" // for PROFILE_ZONE
 #include <cassert>
 #include <algorithm>  // for std::copy
 
@@ -24,8 +25,8 @@ const double TEXTURE = 3.0;   // size of the small features such as rocks
  * GROUND :: CONSTRUCTOR
  * Set everything up, but do not initialize it yet.
  ************************************************************************/
-Ground::Ground(const Position & posUpperRight) :
-   posUpperRight(posUpperRight),
+Ground::Ground(const Viewport & viewport) :
+   viewport(viewport),
    iHowitzer(0),
    iTarget(0),
    ground(nullptr)
@@ -38,10 +39,14 @@ Ground::Ground(const Position & posUpperRight) :
  * FIXED: Added proper copy constructor
  ************************************************************************/
 Ground::Ground(const Ground& other) :
-   posUpperRight(other.posUpperRight),
+   viewport(other.viewport),
    iHowitzer(other.iHowitzer),
    iTarget(other.iTarget),
-   ground(nullptr)
+   ground(nullptr),
+   grid(other.grid),
+   terrain(other.terrain),
+   ticks(other.ticks),
+   labels(other.labels)
 {
    copyFrom(other);
 }
@@ -55,9 +60,13 @@ Ground& Ground::operator=(const Ground& other)
    if (this != &other)
    {
       cleanup();
-      posUpperRight = other.posUpperRight;
+      viewport = other.viewport;
       iHowitzer = other.iHowitzer;
       iTarget = other.iTarget;
+      grid = other.grid;
+      terrain = other.terrain;
+      ticks = other.ticks;
+      labels = other.labels;
       copyFrom(other);
    }
    return *this;
@@ -82,7 +91,7 @@ void Ground::cleanup()
  ************************************************************************/
 void Ground::allocateGround()
 {
-   int width = (int)posUpperRight.getPixelsX();
+   int width = getWidth();
    if (width > 0)
    {
       ground = new double[width];
@@ -101,7 +110,7 @@ void Ground::copyFrom(const Ground& other)
    if (other.ground != nullptr)
    {
       allocateGround();
-      int width = (int)posUpperRight.getPixelsX();
+      int width = getWidth();
       std::copy(other.ground, other.ground + width, ground);
    }
 }
@@ -112,15 +121,11 @@ void Ground::copyFrom(const Ground& other)
  ************************************************************************/
 double Ground::getElevationMeters(const Position& pos) const
 {
-   Position posImpact(pos);
-   int width = (int)posUpperRight.getPixelsX();
-
-   if (pos.getPixelsX() >= 0.0 && pos.getPixelsX() < width && ground != nullptr)
-      posImpact.setPixelsY(ground[(int)pos.getPixelsX()]);
-   else
-      posImpact.setPixelsY(0.0);
+   double pixelX = viewport.toPixelsX(pos);
 
-   return posImpact.getMetersY();
+   if (pixelX >= 0.0 && pixelX < getWidth() && ground != nullptr)
+      return viewport.toMeters(ground[(int)pixelX]);
+   return 0.0;
 }
 
 /************************************************************************
@@ -129,7 +134,7 @@ double Ground::getElevationMeters(const Position& pos) const
  ************************************************************************/
 double Ground::getGroundHeight(int pixelX) const
 {
-   int width = (int)posUpperRight.getPixelsX();
+   int width = getWidth();
    
    if (pixelX >= 0 && pixelX < width && ground != nullptr)
       return ground[pixelX];
@@ -143,11 +148,7 @@ double Ground::getGroundHeight(int pixelX) const
  ************************************************************************/
 bool Ground::isValidPosition(const Position& pos) const
 {
-   double pixelX = pos.getPixelsX();
-   double pixelY = pos.getPixelsY();
-   
-   return (pixelX >= 0.0 && pixelX < posUpperRight.getPixelsX() &&
-           pixelY >= 0.0 && pixelY < posUpperRight.getPixelsY());
+   return viewport.contains(pos);
 }
 
 /************************************************************************
@@ -156,14 +157,11 @@ bool Ground::isValidPosition(const Position& pos) const
  ************************************************************************/
 Position Ground::getTarget() const
 {
-   int width = (int)posUpperRight.getPixelsX();
+   int width = getWidth();
    assert(iTarget >= 0 && iTarget < width);
    assert(ground != nullptr);
    
-   Position posTarget;
-   posTarget.setPixelsX(iTarget);
-   posTarget.setPixelsY(ground[iTarget]);
-   return posTarget;
+   return viewport.toPosition(iTarget, ground[iTarget]);
 }
 
 /************************************************************************
@@ -173,10 +171,13 @@ Position Ground::getTarget() const
  * reset because only then can we know its elevation. posHowitzer is by-reference
  * and not const-by-reference for this purpose.
  ************************************************************************/
-void Ground::reset(Position & posHowitzer)
+void Ground::reset(Position & posHowitzer, uint64_t seed)
 {
+   PROFILE_ZONE("Ground::reset");
+   Xoshiro256 random(seed);
+
    // remember the integer width for later. It will come in handy
-   int width = (int)posUpperRight.getPixelsX();
+   int width = getWidth();
    assert(width > 0);
    
    // Ensure ground is allocated
@@ -184,22 +185,23 @@ void Ground::reset(Position & posHowitzer)
       allocateGround();
 
    // determine the location of the target
-   iHowitzer = (int)(posHowitzer.getPixelsX());
+   iHowitzer = (int)viewport.toPixelsX(posHowitzer);
    if (iHowitzer > width / 2)
-      iTarget = random((int)(width * 0.05), (int)(width * 0.45));
+      iTarget = uniform(random, (int)(width * 0.05), (int)(width * 0.45));
    else
-      iTarget = random((int)(width * 0.55), (int)(width * 0.95));
+      iTarget = uniform(random, (int)(width * 0.55), (int)(width * 0.95));
    
    // Ensure valid indices
    iTarget = std::max(0, std::min(iTarget, width - 1));
    iHowitzer = std::max(0, std::min(iHowitzer, width - 1));
 
-   // determine the maximum and minimum altitude
-   Position posMinimum(0.0, MIN_ALTITUDE);
-   Position posMaximum(posUpperRight.getMetersX(), MAX_ALTITUDE);
+   // determine the maximum and minimum altitude, in pixels
+   double minimum = viewport.toPixels(MIN_ALTITUDE);
+   double maximum = viewport.toPixels(MAX_ALTITUDE);
+   double height = viewport.getHeightPixels();
 
    // give each location on the ground an elevation
-   ground[0] = posMinimum.getPixelsY(); // the initial elevation is low
+   ground[0] = minimum; // the initial elevation is low
    double dy = MAX_SLOPE / 2.0;  // the initial slope is heavily biased to up
    
    for (int i = 1; i < width; i++)
@@ -213,94 +215,85 @@ void Ground::reset(Position & posHowitzer)
       else
       {
          // what percentage of the elevation were we at?
-         double percent = (ground[i - 1] - posMinimum.getPixelsY()) /
-                          (posMaximum.getPixelsY() - posMinimum.getPixelsY());
+         double percent = (ground[i - 1] - minimum) / (maximum - minimum);
 
          // set the slope of the ground
-         dy += (1.0 - percent) * random(0.0, LUMPINESS) +
-               (percent) * random(-LUMPINESS, 0.0);
+         dy += (1.0 - percent) * uniform(random, 0.0, LUMPINESS) +
+               (percent) * uniform(random, -LUMPINESS, 0.0);
          if (dy > MAX_SLOPE)
             dy = MAX_SLOPE;
          if (dy < -MAX_SLOPE)
             dy = -MAX_SLOPE;
 
          // determine the elevation according to the slope
-         ground[i] = ground[i - 1] + dy + random(-TEXTURE, TEXTURE);
+         ground[i] = ground[i - 1] + dy + uniform(random, -TEXTURE, TEXTURE);
          if (ground[i] < 0.0)
             ground[i] = 0.0;
          
          // Ensure ground doesn't exceed screen bounds
-         if (ground[i] > posUpperRight.getPixelsY())
-            ground[i] = posUpperRight.getPixelsY();
+         if (ground[i] > height)
+            ground[i] = height;
       }
    }
 
    // set the howitzer's elevation
-   posHowitzer.setPixelsY(ground[iHowitzer]);
+   posHowitzer.setMetersY(viewport.toMeters(ground[iHowitzer]));
+
+   buildMesh();
 }
 
-/*****************************************************************
- * GROUND :: DRAW
- * Draw the ground on the screen
- ****************************************************************/
-void Ground::draw(ogstream & gout) const
+/************************************************************************
+ * GROUND :: BUILD MESH
+ * Turn ground[] and the scale into the meshes and labels draw() hands
+ * to the renderer. Nothing here changes until the next reset(), so
+ * this is done once a round rather than once a frame
+ ************************************************************************/
+void Ground::buildMesh()
 {
-   if (ground == nullptr)
-      return;
+   assert(ground != nullptr);
+   Position posUpperRight = viewport.getUpperRight();
+   int width = getWidth();
+
+   grid.clear();
+   terrain.clear();
+   ticks.clear();
+   labels.clear();
+   terrain.reserve(width * 6);
 
    // put the meter markers along the side
-   for (Position pos(0.0, 1000.0); pos.getPixelsY() < posUpperRight.getPixelsY(); pos.addMetersY(1000.0))
+   for (Position pos(0.0, 1000.0); pos.getMetersY() < posUpperRight.getMetersY(); pos.addMetersY(1000.0))
    {
-      Position posLeft(pos);
       Position posRight(pos);
-      posRight.setPixelsX(posUpperRight.getPixelsX());
-      gout.drawLine(posLeft, posRight, 0.85, 0.85, 0.85);
+      posRight.setMetersX(posUpperRight.getMetersX());
+      grid.addLine(viewport.toPixels(pos), viewport.toPixels(posRight), 0.85, 0.85, 0.85);
    }
 
-   // iterate through the entire ground and draw it all
-   int width = (int)posUpperRight.getPixelsX();
+   // a rectangle from the bottom of the screen to the top of each column
    for (int i = 0; i < width; i++)
-   {
-      Position posBottom;
-      Position posTop;
-      posBottom.setPixelsX((double)i);
-      posTop.setPixelsX((double)i + 1.0);
-      posTop.setPixelsY(ground[i]);
-      gout.drawRectangle(posBottom, posTop, 0.6 /*red*/, 0.4 /*green*/, 0.2 /*blue*/);
-   }
-
-   // draw the target
-   Position posTarget = getTarget();
-   gout.drawTarget(posTarget);
+      terrain.addRectangle(PT((double)i, 0.0), PT((double)i + 1.0, ground[i]),
+                           0.6 /*red*/, 0.4 /*green*/, 0.2 /*blue*/);
 
    // put the kilometer markers along the bottom
-   for (Position pos(1000.0, 0.0); pos.getPixelsX() < posUpperRight.getPixelsX(); pos.addMetersX(1000.0))
+   for (Position pos(1000.0, 0.0); pos.getMetersX() < posUpperRight.getMetersX(); pos.addMetersX(1000.0))
    {
-      Position posBottom(pos);
-      Position posTop(pos);
-      posTop.addPixelsY(10);
-      gout.drawLine(posTop, posBottom, 0.6, 0.6, 0.6);
+      PT ptBottom = viewport.toPixels(pos);
+      PT ptTop(ptBottom.x, ptBottom.y + 10.0);
+      ticks.addLine(ptTop, ptBottom, 0.6, 0.6, 0.6);
    }
 
    // put the kilometer labels along the bottom
-   for (Position pos(5000.0, 0.0); pos.getPixelsX() < posUpperRight.getPixelsX(); pos.addMetersX(5000.0))
+   for (Position pos(5000.0, 0.0); pos.getMetersX() < posUpperRight.getMetersX(); pos.addMetersX(5000.0))
    {
       Position posText(pos);
-      posText.addPixelsY(15);
-      posText.addPixelsX(-10);
-
-      gout = posText;
-      gout << (int)(pos.getMetersX() / 1000.0) << "km";
+      viewport.addPixels(posText, -10.0, 15.0);
+      labels.push_back({ posText, std::to_string((int)(pos.getMetersX() / 1000.0)) + "km" });
    }
 
-   // draw the altitude labels along the side
-   for (Position pos(0.0, 2000.0); pos.getPixelsY() < posUpperRight.getPixelsY(); pos.addMetersY(2000.0))
+   // the altitude labels along the side
+   for (Position pos(0.0, 2000.0); pos.getMetersY() < posUpperRight.getMetersY(); pos.addMetersY(2000.0))
    {
       Position posText(pos);
-      posText.addPixelsX(5);
-      posText.addPixelsY(-2);
-
-      gout = posText;
-      gout << (int)(pos.getMetersY()) << "m";
+      viewport.addPixels(posText, 5.0, -2.0);
+      labels.push_back({ posText, std::to_string((int)pos.getMetersY()) + "m" });
    }
 }
@@ -10,15 +10,34 @@
 #pragma once
 
 #include "position.h"   // for Point
-#include "uiDraw.h"
+#include "viewport.h"   // for Viewport
+#include "random.h"     // for randomSeed()
+#include "mesh.h"       // for Mesh
 #include <memory>       // for smart pointers
+#include <vector>
+#include <string>
+
+#define HIT_TOLERANCE 175.0  // meters from the target that count as a hit
 
 // forward declaration for the Ground unit tests
 class TestGround;
+class ogstream;
+
+ /***********************************************************
+  * GROUND LABEL
+  * A scale marking and where it goes
+  ***********************************************************/
+struct GroundLabel
+{
+   Position pos;        // top left corner of the text
+   std::string text;
+};
 
  /***********************************************************
   * GROUND
-  * The ground class with proper memory management
+  * The ground class with proper memory management. The
+  * terrain, the grid and the labels only change on reset(),
+  * so they are built into meshes then and drawn as they are
   ***********************************************************/
 class Ground
 {
@@ -27,7 +46,7 @@ class Ground
 
 public:
    // the constructor generates the ground
-   Ground(const Position &posUpperRight);
+   Ground(const Viewport & viewport);
    Ground() : ground(nullptr), iHowitzer(0), iTarget(0) {}
    
    // FIXED: Added destructor for proper memory management
@@ -39,10 +58,11 @@ public:
    // FIXED: Added assignment operator
    Ground& operator=(const Ground& other);
    
-   // reset the game
-   void reset(Position & posHowitzer);
+   // reset the game. The same seed always gives the same ground
+   void reset(Position & posHowitzer, uint64_t seed);
+   void reset(Position & posHowitzer) { reset(posHowitzer, randomSeed()); }
 
-   // draw the ground on the screen
+   // draw the ground on the screen, see uiSimulation.cpp
    void draw(ogstream & gout) const;
 
    // determine how high the Point is off the ground
@@ -52,17 +72,23 @@ public:
    Position getTarget() const;
    
    // Utility functions
-   int getWidth() const { return (int)posUpperRight.getPixelsX(); }
+   int getWidth() const { return (int)viewport.getWidthPixels(); }
    double getGroundHeight(int pixelX) const;
    bool isValidPosition(const Position& pos) const;
+   const Viewport& getViewport() const { return viewport; }
 
 private:
    double * ground;               // elevation of the ground, in pixels
    int iTarget;                   // the location of the target, in pixels
    int iHowitzer;                 // the location of the howitzer
-   Position posUpperRight;        // size of the screen
+   Viewport viewport;             // size and zoom of the screen
+   Mesh grid{ Mesh::LINES };      // altitude lines, behind the terrain
+   Mesh terrain{ Mesh::TRIANGLES };  // a rectangle for each column
+   Mesh ticks{ Mesh::LINES };     // kilometer ticks, in front of the terrain
+   std::vector<GroundLabel> labels;  // kilometers and altitudes
    
    // Helper functions
+   void buildMesh();              // Build the meshes from ground[]
    void cleanup();                // Clean up allocated memory
    void allocateGround();         // Allocate ground array
    void copyFrom(const Ground& other);  // Copy helper
@@ -0,0 +1,73 @@
+/***********************************************************************
+ * Source File:
+ *    HOWITZER
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Everything we need to know about a howitzer (aka the gun)
+ ************************************************************************/
+
+#include "howitzer.h"
+#include <cassert>
+
+using namespace std;
+
+/*********************************************
+ * HOWITZER : ESTIMATE RANGE
+ * Look the current elevation up on the range
+ * curve. Pointing left is the mirror of right
+ *********************************************/
+double Howitzer::estimateRange(double targetElevation) const
+{
+   double degrees = elevation.getDegrees();
+   if (elevation.isLeft())
+      degrees = 360.0 - degrees;
+   
+   double range = getRangeCurve(targetElevation).getRange(degrees);
+   return (range > 0.0) ? range : 0.0;
+}
+
+/*********************************************
+ * HOWITZER : ESTIMATE ANGLE FOR RANGE
+ * The low-angle solution, which is what a gun
+ * crew fires unless there is a hill in the way
+ *********************************************/
+Angle Howitzer::estimateAngleForRange(double range, double targetElevation) const
+{
+   Angle lowAngle;
+   Angle highAngle;
+   if (estimateAnglesForRange(range, targetElevation, lowAngle, highAngle) > 0)
+      return lowAngle;
+   
+   // out of reach: the angle that goes the farthest
+   Angle farthest(getRangeCurve(targetElevation).getMaxRangeAngle());
+   if (elevation.isLeft())
+      farthest.setDegrees(360.0 - farthest.getDegrees());
+   return farthest;
+}
+
+/*********************************************
+ * HOWITZER : ESTIMATE ANGLES FOR RANGE
+ * Both solutions from the range curve, turned
+ * to whichever side the barrel is pointing
+ *********************************************/
+int Howitzer::estimateAnglesForRange(double range, double targetElevation,
+                                     Angle& lowAngle, Angle& highAngle) const
+{
+   assert(range >= 0.0);
+   
+   double low = 0.0;
+   double high = 0.0;
+   int num = getRangeCurve(targetElevation).getAngles(range, low, high);
+   if (num == 0)
+      return 0;
+   
+   if (elevation.isLeft())
+   {
+      low = 360.0 - low;
+      high = 360.0 - high;
+   }
+   lowAngle.setDegrees(low);
+   highAngle.setDegrees(high);
+   return num;
+}
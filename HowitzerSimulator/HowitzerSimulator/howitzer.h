@@ -14,7 +14,8 @@
 #include "position.h"
 #include "velocity.h"
 #include "physics.h"
-#include "uiDraw.h"
+#include "rangeCurve.h"
+#include "random.h"
 
 // Default M777 Howitzer specifications
 #define DEFAULT_MUZZLE_VELOCITY   827.00     // m/s
@@ -22,8 +23,9 @@
 #define MIN_ELEVATION_ANGLE       0.0        // degrees (CHANGED: was -5.0)
 #define MAX_ELEVATION_ANGLE      85.0        // degrees
 
-// Forward declaration for unit tests
+// Forward declarations
 class TestHowitzer;
+class ogstream;
 
 /*********************************************
  * Howitzer
@@ -49,24 +51,27 @@ public:
       lastFireTime(-1.0),
       roundsFired(0) {}
    
-   // Drawing
-   void draw(ogstream& gout, double flightTime) const
-   {
-      gout.drawHowitzer(position, elevation.getRadians(), flightTime);
-   }
+   // Drawing, see uiSimulation.cpp
+   void draw(ogstream& gout, double flightTime) const;
    
    // Position management
    Position& getPosition() { return position; }
    const Position& getPosition() const { return position; }
    void setPosition(const Position& pos) { position = pos; }
    
-   // Generate a new random position for the howitzer
+   // Generate a new random position for the howitzer. The same seed
+   // always gives the same position
+   void generatePosition(const Position& posUpperRight, uint64_t seed)
+   {
+      Xoshiro256 random(seed);
+      double xMeters = uniform(random, posUpperRight.getMetersX() * 0.1,
+                                       posUpperRight.getMetersX() * 0.9);
+      position.setMetersX(xMeters);
+      position.setMetersY(0.0); // Always on ground level
+   }
    void generatePosition(const Position& posUpperRight)
    {
-      double xPixels = random(posUpperRight.getPixelsX() * 0.1,
-                              posUpperRight.getPixelsX() * 0.9);
-      position.setPixelsX(xPixels);
-      position.setPixelsY(0.0); // Always on ground level
+      generatePosition(posUpperRight, randomSeed());
    }
    
    // Muzzle velocity management
@@ -162,12 +167,20 @@ public:
       roundsFired++;
    }
    
-   // Range estimation (simplified ballistic calculation)
+   // Range estimation at the current elevation. The target elevation is
+   // in meters above the howitzer. Zero if the shell never comes down there
    double estimateRange(double targetElevation = 0.0) const;
    
-   // Angle estimation for hitting a target at given range
+   // Angle estimation for hitting a target at given range: the flatter,
+   // low-angle solution, on the side the barrel is pointing. Out of reach,
+   // the angle that comes closest
    Angle estimateAngleForRange(double range, double targetElevation = 0.0) const;
    
+   // Both angles that reach a range: the low-angle (flat) and high-angle
+   // (steep) paths. Returns how many exist; with one, both are set to it
+   int estimateAnglesForRange(double range, double targetElevation,
+                              Angle& lowAngle, Angle& highAngle) const;
+   
    // Utility functions
    bool canFire() const { return muzzleVelocity > 0.0; }
    double getBarrelLength() const { return 6.0; } // M777 barrel length in meters
@@ -190,6 +203,17 @@ private:
    double lastFireTime;    // Time of last firing
    int roundsFired;        // Total rounds fired
    
+   // Range against elevation for the current muzzle velocity, flown the
+   // first time it is needed and again only when the velocity or the
+   // target elevation changes
+   mutable RangeCurve rangeCurve;
+   const RangeCurve& getRangeCurve(double targetElevation) const
+   {
+      rangeCurve.build(muzzleVelocity, targetElevation,
+                       MIN_ELEVATION_ANGLE, MAX_ELEVATION_ANGLE);
+      return rangeCurve;
+   }
+   
    // Constrain elevation to realistic limits (0° to 85°)
    void constrainElevation()
    {
@@ -0,0 +1,107 @@
+/***********************************************************************
+ * Header File:
+ *    HUD LINE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    One line of heads-up display text, formatted in place without
+ *    touching the heap
+ ************************************************************************/
+
+#pragma once
+
+#include <charconv>     // for std::to_chars
+#include <cstddef>
+#include <cstring>
+
+// Forward declaration for the unit tests
+class TestHudLine;
+
+#define HUD_LINE_LENGTH 128   // characters in a line, with the terminator
+
+/*********************************************
+ * HUD LINE
+ * A fixed buffer that numbers are written into
+ * with std::to_chars, so building a line never
+ * allocates, unlike a stringstream. Anything
+ * past the end is dropped. The line also
+ * remembers what it was built from: isStale()
+ * says whether it has to be built again, so a
+ * value that has not changed since the last
+ * frame is not formatted again either
+ *********************************************/
+class HudLine
+{
+public:
+   friend ::TestHudLine;
+
+   HudLine() : length(0), isKeyed(false), key1(0.0), key2(0.0)
+   {
+      text[0] = '\0';
+   }
+
+   // Does the line have to be built again to show these values?
+   // Remembers them if so
+   bool isStale(double key1, double key2 = 0.0)
+   {
+      if (isKeyed && key1 == this->key1 && key2 == this->key2)
+         return false;
+      isKeyed = true;
+      this->key1 = key1;
+      this->key2 = key2;
+      return true;
+   }
+
+   // Build the line
+   HudLine& clear()
+   {
+      length = 0;
+      text[0] = '\0';
+      return *this;
+   }
+   HudLine& pad(size_t numSpaces)
+   {
+      size_t num = numSpaces < room() ? numSpaces : room();
+      memset(text + length, ' ', num);
+      return terminate(length + num);
+   }
+   HudLine& append(const char* s)
+   {
+      size_t num = strlen(s);
+      if (num > room())
+         num = room();
+      memcpy(text + length, s, num);
+      return terminate(length + num);
+   }
+   HudLine& append(int value)
+   {
+      std::to_chars_result result = std::to_chars(text + length, text + length + room(), value);
+      return terminate(result.ec == std::errc() ? result.ptr - text : length);
+   }
+   HudLine& append(double value, int precision)
+   {
+      std::to_chars_result result = std::to_chars(text + length, text + length + room(), value,
+                                                  std::chars_format::fixed, precision);
+      return terminate(result.ec == std::errc() ? result.ptr - text : length);
+   }
+
+   const char* c_str() const { return text; }
+   size_t size() const { return length; }
+
+private:
+   // Characters left, keeping one for the terminator
+   size_t room() const { return HUD_LINE_LENGTH - 1 - length; }
+
+   HudLine& terminate(size_t length)
+   {
+      this->length = length;
+      text[length] = '\0';
+      return *this;
+   }
+
+   char text[HUD_LINE_LENGTH];
+   size_t length;
+   bool isKeyed;           // has isStale() been called yet?
+   double key1;            // the values the line was built from
+   double key2;
+};
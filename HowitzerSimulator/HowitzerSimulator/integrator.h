@@ -0,0 +1,244 @@
+/***********************************************************************
+ * Header File:
+ *    INTEGRATOR
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Ways of stepping a shell forward in time. Each integrator is a
+ *    policy class handed to Projectile or ProjectileBatch as a template
+ *    parameter, so the choice is made at compile time and the step is
+ *    inlined into the flight loop
+ ************************************************************************/
+
+#pragma once
+
+#include "acceleration.h"
+
+/*********************************************************
+ * BALLISTIC STATE
+ * Where a shell is (m) and how fast it is going (m/s)
+ *********************************************************/
+struct BallisticState
+{
+   double x;    // horizontal position
+   double y;    // vertical position
+   double dx;   // horizontal velocity
+   double dy;   // vertical velocity
+};
+
+/*********************************************************
+ * Every integrator provides
+ *    template <class Dynamics>
+ *    static void step(BallisticState& s, double t, const Dynamics& accel)
+ * where accel(s) returns the Acceleration of the shell in
+ * state s. ORDER is the global order of accuracy and
+ * EVALUATIONS the number of calls to accel per step.
+ *********************************************************/
+
+/*********************************************************
+ * KINEMATIC INTEGRATOR
+ * The original update: hold the acceleration fixed for
+ * the whole step and apply the kinematic equations
+ *    s = s₀ + v₀t + ½at²
+ *    v = v₀ + at
+ *********************************************************/
+struct KinematicIntegrator
+{
+   static const int ORDER = 1;
+   static const int EVALUATIONS = 1;
+
+   template <class Dynamics>
+   static inline void step(BallisticState& s, double t, const Dynamics& accel)
+   {
+      Acceleration a = accel(s);
+      s.x += s.dx * t + 0.5 * a.getDDX() * t * t;
+      s.y += s.dy * t + 0.5 * a.getDDY() * t * t;
+      s.dx += a.getDDX() * t;
+      s.dy += a.getDDY() * t;
+   }
+};
+
+/*********************************************************
+ * SEMI-IMPLICIT EULER
+ * Update the velocity first and move with the new one
+ *    v = v₀ + at
+ *    s = s₀ + vt
+ *********************************************************/
+struct SemiImplicitEuler
+{
+   static const int ORDER = 1;
+   static const int EVALUATIONS = 1;
+
+   template <class Dynamics>
+   static inline void step(BallisticState& s, double t, const Dynamics& accel)
+   {
+      Acceleration a = accel(s);
+      s.dx += a.getDDX() * t;
+      s.dy += a.getDDY() * t;
+      s.x += s.dx * t;
+      s.y += s.dy * t;
+   }
+};
+
+/*********************************************************
+ * VELOCITY VERLET
+ * Move with the starting acceleration, then average it
+ * with the acceleration at the new position. Drag depends
+ * on velocity, so the second evaluation uses the velocity
+ * predicted by the first
+ *    s  = s₀ + v₀t + ½a₀t²
+ *    a₁ = a(s, v₀ + a₀t)
+ *    v  = v₀ + ½(a₀ + a₁)t
+ *********************************************************/
+struct VelocityVerlet
+{
+   static const int ORDER = 2;
+   static const int EVALUATIONS = 2;
+
+   template <class Dynamics>
+   static inline void step(BallisticState& s, double t, const Dynamics& accel)
+   {
+      Acceleration a0 = accel(s);
+      BallisticState next;
+      next.x = s.x + s.dx * t + 0.5 * a0.getDDX() * t * t;
+      next.y = s.y + s.dy * t + 0.5 * a0.getDDY() * t * t;
+      next.dx = s.dx + a0.getDDX() * t;
+      next.dy = s.dy + a0.getDDY() * t;
+
+      Acceleration a1 = accel(next);
+      next.dx = s.dx + 0.5 * (a0.getDDX() + a1.getDDX()) * t;
+      next.dy = s.dy + 0.5 * (a0.getDDY() + a1.getDDY()) * t;
+      s = next;
+   }
+};
+
+/*********************************************************
+ * RUNGE-KUTTA 4
+ * The classical fourth-order method. Four evaluations per
+ * step, but the error falls with the fourth power of the
+ * step size so far fewer steps are needed
+ *********************************************************/
+struct RungeKutta4
+{
+   static const int ORDER = 4;
+   static const int EVALUATIONS = 4;
+
+   template <class Dynamics>
+   static inline void step(BallisticState& s, double t, const Dynamics& accel)
+   {
+      const double half = 0.5 * t;
+
+      // k1 at the start
+      Acceleration a1 = accel(s);
+
+      // k2 at the midpoint using k1
+      BallisticState s2 = { s.x + s.dx * half, s.y + s.dy * half,
+                            s.dx + a1.getDDX() * half, s.dy + a1.getDDY() * half };
+      Acceleration a2 = accel(s2);
+
+      // k3 at the midpoint using k2
+      BallisticState s3 = { s.x + s2.dx * half, s.y + s2.dy * half,
+                            s.dx + a2.getDDX() * half, s.dy + a2.getDDY() * half };
+      Acceleration a3 = accel(s3);
+
+      // k4 at the end using k3
+      BallisticState s4 = { s.x + s3.dx * t, s.y + s3.dy * t,
+                            s.dx + a3.getDDX() * t, s.dy + a3.getDDY() * t };
+      Acceleration a4 = accel(s4);
+
+      // weighted average of the four slopes
+      const double sixth = t / 6.0;
+      s.x += sixth * (s.dx + 2.0 * s2.dx + 2.0 * s3.dx + s4.dx);
+      s.y += sixth * (s.dy + 2.0 * s2.dy + 2.0 * s3.dy + s4.dy);
+      s.dx += sixth * (a1.getDDX() + 2.0 * a2.getDDX() + 2.0 * a3.getDDX() + a4.getDDX());
+      s.dy += sixth * (a1.getDDY() + 2.0 * a2.getDDY() + 2.0 * a3.getDDY() + a4.getDDY());
+   }
+};
+
+/*********************************************************
+ * EVENT LOCATION
+ * An event is a function of the state, such as the height
+ * of the shell above the ground, that crosses zero when
+ * something happens. After a step has bracketed a crossing
+ * (g > 0 at the start, g <= 0 at the end) these find the
+ * moment it happened without redoing the step.
+ *********************************************************/
+
+// Stop refining once the event is within a centimeter or the
+// bracket is shorter than a microsecond
+#define EVENT_TOLERANCE      0.01   // units of the event, usually meters
+#define EVENT_TIME_TOLERANCE 1e-6   // seconds
+#define EVENT_MAX_ITERATIONS 50
+
+/*********************************************
+ * HERMITE
+ * The state a fraction theta of the way through a
+ * fixed step of length t. Position follows the cubic
+ * that matches both ends and both velocities;
+ * velocity is blended linearly
+ *********************************************/
+inline BallisticState hermite(const BallisticState& s0, const BallisticState& s1,
+                              double t, double theta)
+{
+   double theta2 = theta * theta;
+   double theta3 = theta2 * theta;
+   double h00 = 2.0 * theta3 - 3.0 * theta2 + 1.0;
+   double h10 = theta3 - 2.0 * theta2 + theta;
+   double h01 = -2.0 * theta3 + 3.0 * theta2;
+   double h11 = theta3 - theta2;
+
+   BallisticState s;
+   s.x = h00 * s0.x + h10 * t * s0.dx + h01 * s1.x + h11 * t * s1.dx;
+   s.y = h00 * s0.y + h10 * t * s0.dy + h01 * s1.y + h11 * t * s1.dy;
+   s.dx = s0.dx + theta * (s1.dx - s0.dx);
+   s.dy = s0.dy + theta * (s1.dy - s0.dy);
+   return s;
+}
+
+/*********************************************
+ * LOCATE EVENT
+ * The Illinois variant of regula falsi between
+ * (t0, g0 > 0) and (t1, g1 <= 0). stateAt(t) gives
+ * the state at any time in the bracket and g(state)
+ * the event. Returns the time on the g <= 0 side,
+ * so the shell is never left hovering above ground
+ *********************************************/
+template <class Interpolant, class Event>
+double locateEvent(double t0, double g0, double t1, double g1,
+                   const Interpolant& stateAt, const Event& g)
+{
+   // w0 and w1 weight the secant; they start as g0 and g1 but
+   // are halved when one end sits still
+   double w0 = g0;
+   double w1 = g1;
+   int side = 0;
+   for (int i = 0; i < EVENT_MAX_ITERATIONS; i++)
+   {
+      if (g1 > -EVENT_TOLERANCE || t1 - t0 < EVENT_TIME_TOLERANCE)
+         break;
+
+      // secant through the bracket, kept strictly inside it
+      double t = (t0 * w1 - t1 * w0) / (w1 - w0);
+      if (!(t > t0 && t < t1))
+         t = 0.5 * (t0 + t1);
+
+      double gt = g(stateAt(t));
+      if (gt <= 0.0)
+      {
+         t1 = t;
+         g1 = w1 = gt;
+         if (side == -1)
+            w0 *= 0.5;
+         side = -1;
+      }
+      else
+      {
+         t0 = t;
+         w0 = gt;
+         if (side == 1)
+            w1 *= 0.5;
+         side = 1;
+      }
+   }
+   return t1;
+}
@@ -9,14 +9,65 @@
 
 #include <cassert>      // for ASSERT
 #include <iomanip>      // for formatting
+#include <chrono>       // for the time between trace dumps
 #include "uiInteract.h" // for INTERFACE
 #include "uiDraw.h"     // for RANDOM and DRAW*
 #include "simulation.h" // for SIMULATION
-#include "position.h"   // for POSITION
+#include "physicsThread.h" // for PHYSICS THREAD
+#include "viewport.h"   // for VIEWPORT
+#include "profiler.h"   // for PROFILER
+#include "frameStats.h" // for FRAME STATS
 #include "test.h"       // for the unit tests
 
 using namespace std;
 
+#define TRACE_FILENAME "howitzer-trace.json"
+#define TRACE_MIN_INTERVAL 5.0   // seconds between dumps of the trace
+
+/*************************************
+ * DUMP TRACE ON STUTTER
+ * When a frame has missed its deadline since the
+ * last look, save what every thread was doing
+ * so we can see which phase blew the budget.
+ * Not more than once every few seconds: a slow
+ * patch would otherwise write a file every frame
+ **************************************/
+void dumpTraceOnStutter()
+{
+#ifdef PROFILE
+   static uint64_t numMissed = 0;
+   static chrono::steady_clock::time_point lastDump;
+   static bool isDumped = false;
+
+   uint64_t missed = Interface::getScheduler().getNumMissed();
+   if (missed == numMissed)
+      return;
+   numMissed = missed;
+
+   chrono::steady_clock::time_point now = chrono::steady_clock::now();
+   if (isDumped && chrono::duration<double>(now - lastDump).count() < TRACE_MIN_INTERVAL)
+      return;
+   lastDump = now;
+   isDumped = true;
+
+   if (Profiler::writeTrace(TRACE_FILENAME))
+      cerr << "Missed a frame: wrote " << TRACE_FILENAME << "\n";
+#endif // PROFILE
+}
+
+/*************************************
+ * APPLICATION
+ * What each frame needs: the simulation, the
+ * thread running its physics, and the figures
+ * for the performance overlay
+ **************************************/
+struct Application
+{
+   Simulator& sim;
+   const PhysicsThread& physics;
+   FrameStats stats;
+};
+
 /*************************************
  * All the interesting work happens here, when
  * I get called back from OpenGL to draw a frame.
@@ -26,28 +77,39 @@ using namespace std;
  **************************************/
 void callBack(const Interface* pUI, void* p)
 {
-   // Cast the void pointer into our Simulator object.
-   Simulator* pSim = (Simulator*)p;
-   
-   assert(pSim != nullptr);
+   // Cast the void pointer into our Application object.
+   Application* pApp = (Application*)p;
+   assert(pApp != nullptr);
    assert(pUI != nullptr);
+   Simulator* pSim = &pApp->sim;
    
-   // Handle user input
+   // Handle user input. The physics runs on its own thread
    pSim->handleInput(pUI);
    
-   // Update simulation physics
-   pSim->update(0.5);  // 0.5 second time step
-   
-   // Set up graphics output stream
-   ogstream gout(Position(10.0, pSim->getPosUpperRight().getPixelsY() - 20.0));
+   // Set up graphics output stream, text starting in the upper left. It
+   // lives from frame to frame so that recording reuses its memory
+   const Viewport& viewport = pSim->getViewport();
+   static ogstreamRecorder gout(viewport, Position());
+   gout.setPosition(viewport.toPosition(10.0, viewport.getHeightPixels() - 20.0));
    
-   // Render the simulation
+   // Render the simulation, then draw it all in a few batches
    pSim->draw(gout);
+   pSim->drawPerformance(gout, pApp->stats);
+   gout.submit();
+   
+   // Read the running totals for the overlay: a few loads a frame
+   FrameCounters totals;
+   totals.numSteps = pApp->physics.getNumSteps();
+   totals.updateNanoseconds = pApp->physics.getUpdateNanoseconds();
+   totals.numDrawCalls = ogstream::getNumDrawCalls();
+   pApp->stats.addFrame(Interface::getScheduler().getFrameSeconds(), totals);
+   
+   // With nothing in the air, the window can wait for a key
+   Interface::setAnimating(pSim->isAnimating());
+   
+   dumpTraceOnStutter();
 }
 
-// Initialize the static member for pixel-to-meter conversion
-double Position::metersFromPixels = 40.0;
-
 /*********************************
  * Initialize the simulation and set it in motion
  *********************************/
@@ -65,20 +127,24 @@ int main(int argc, char** argv)
    // Run unit tests first
    testRunner();
 
-   // Initialize OpenGL window
-   Position posUpperRight;
-   posUpperRight.setZoom(40.0);  // 40 meters equals 1 pixel
-   posUpperRight.setPixelsX(700.0);
-   posUpperRight.setPixelsY(500.0);
+   // Keep the recent past of every thread, ready to dump on a stutter
+   Profiler::setThreadName("main");
+   Profiler::setEnabled(true);
+
+   // Initialize OpenGL window: 40 meters equals 1 pixel, 700 x 500 pixels
+   Viewport viewport(40.0, 700.0, 500.0);
    
    // Create the user interface
-   Interface ui("M777 Howitzer Simulation - Enhanced Edition", posUpperRight);
+   Interface ui("M777 Howitzer Simulation - Enhanced Edition", viewport);
 
-   // Initialize the simulation
-   Simulator sim(posUpperRight);
+   // Initialize the simulation and start the physics
+   Simulator sim(viewport);
+   PhysicsThread physics(sim, TIME_STEP, TIME_SCALE);
 
-   // Set everything into action
-   ui.run(callBack, (void*)&sim);
+   // Set everything into action. P shows the performance overlay, M
+   // the spread of a dispersion run with the current aim
+   Application app{ sim, physics, FrameStats() };
+   ui.run(callBack, (void*)&app);
 
    return 0;
 }
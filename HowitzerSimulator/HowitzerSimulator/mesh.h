@@ -0,0 +1,110 @@
+/***********************************************************************
+ * Header File:
+ *    MESH
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    A batch of colored vertices, in pixels, that is built once and
+ *    handed to the renderer in a single draw call
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include "position.h"   // for PT
+
+// Forward declaration for the unit tests
+class TestMesh;
+
+/*********************************************
+ * VERTEX
+ * One corner, in pixels, and its color. The
+ * layout is what glVertexPointer() and
+ * glColorPointer() expect, interleaved
+ *********************************************/
+struct Vertex
+{
+   float x;
+   float y;
+   float red;
+   float green;
+   float blue;
+};
+
+/*********************************************
+ * MESH
+ * Geometry that does not change from frame to
+ * frame: build it when it does change, and draw
+ * all of it with ogstream::drawMesh() as one
+ * vertex array instead of a glBegin()/glEnd()
+ * pair per shape. A mesh is all lines or all
+ * triangles. Knows nothing about OpenGL, so it
+ * can be built and tested in the core library
+ *********************************************/
+class Mesh
+{
+public:
+   friend ::TestMesh;
+
+   enum Primitive { LINES, TRIANGLES };
+
+   Mesh(Primitive primitive = TRIANGLES) : primitive(primitive) {}
+
+   Primitive getPrimitive() const { return primitive; }
+   const std::vector<Vertex>& getVertices() const { return vertices; }
+   size_t size() const { return vertices.size(); }
+   bool empty() const { return vertices.empty(); }
+
+   // Start over, keeping the memory for the next build
+   void clear() { vertices.clear(); }
+   void reserve(size_t numVertices) { vertices.reserve(numVertices); }
+
+   // A line from begin to end, in pixels
+   void addLine(const PT& begin, const PT& end,
+                double red = 0.0, double green = 0.0, double blue = 0.0)
+   {
+      assert(primitive == LINES);
+      add(begin.x, begin.y, red, green, blue);
+      add(end.x,   end.y,   red, green, blue);
+   }
+
+   // A solid rectangle with opposite corners begin and end,
+   // in pixels, as two triangles
+   void addRectangle(const PT& begin, const PT& end,
+                     double red = 0.0, double green = 0.0, double blue = 0.0)
+   {
+      assert(primitive == TRIANGLES);
+      add(begin.x, begin.y, red, green, blue);
+      add(begin.x, end.y,   red, green, blue);
+      add(end.x,   end.y,   red, green, blue);
+      add(begin.x, begin.y, red, green, blue);
+      add(end.x,   end.y,   red, green, blue);
+      add(end.x,   begin.y, red, green, blue);
+   }
+
+   // Any four corners in order around the edge, in pixels,
+   // as two triangles
+   void addQuad(const PT& pt1, const PT& pt2, const PT& pt3, const PT& pt4,
+                double red = 0.0, double green = 0.0, double blue = 0.0)
+   {
+      assert(primitive == TRIANGLES);
+      add(pt1.x, pt1.y, red, green, blue);
+      add(pt2.x, pt2.y, red, green, blue);
+      add(pt3.x, pt3.y, red, green, blue);
+      add(pt1.x, pt1.y, red, green, blue);
+      add(pt3.x, pt3.y, red, green, blue);
+      add(pt4.x, pt4.y, red, green, blue);
+   }
+
+private:
+   void add(double x, double y, double red, double green, double blue)
+   {
+      vertices.push_back({ (float)x, (float)y,
+                           (float)red, (float)green, (float)blue });
+   }
+
+   Primitive primitive;
+   std::vector<Vertex> vertices;
+};
@@ -0,0 +1,244 @@
+/***********************************************************************
+ * Source File:
+ *    PERF COUNTERS
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Count cycles, instructions, cache misses and branch misses with
+ *    the processor's own counters, where the operating system lets us
+ ************************************************************************/
+
+#include "perfCounters.h"
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // __linux__
+
+using namespace std;
+
+/*********************************************
+ * PERF COUNTS : IS ANY COUNTED
+ *********************************************/
+bool PerfCounts::isAnyCounted() const
+{
+   for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      if (isCounted((PerfEvent)i))
+         return true;
+   return false;
+}
+
+/*********************************************
+ * PERF COUNTS : GET IPC
+ *********************************************/
+double PerfCounts::getIPC() const
+{
+   if (!isCounted(PERF_INSTRUCTIONS) || value[PERF_CYCLES] <= 0.0)
+      return PERF_NOT_COUNTED;
+   return value[PERF_INSTRUCTIONS] / value[PERF_CYCLES];
+}
+
+/*********************************************
+ * PERF COUNTS : DIVIDE
+ *********************************************/
+PerfCounts PerfCounts::operator / (double divisor) const
+{
+   assert(divisor > 0.0);
+   PerfCounts result;
+   for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      if (isCounted((PerfEvent)i))
+         result.value[i] = value[i] / divisor;
+   return result;
+}
+
+#ifdef __linux__
+/*********************************************
+ * OPEN EVENT
+ * One counter for this thread on any CPU. On its
+ * own, or as a group leader, it is disabled until
+ * resume(); in the group of leader it follows
+ * the leader. -1 if it will not open
+ *********************************************/
+static int openEvent(uint32_t type, uint64_t config, int leader = -1)
+{
+   perf_event_attr attr;
+   memset(&attr, 0, sizeof(attr));
+   attr.size = sizeof(attr);
+   attr.type = type;
+   attr.config = config;
+   attr.disabled = (leader < 0);
+   attr.exclude_kernel = 1;
+   attr.exclude_hv = 1;
+   attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+   return (int)syscall(SYS_perf_event_open, &attr, 0 /*this thread*/, -1 /*any CPU*/,
+                       leader, 0);
+}
+
+/*********************************************
+ * CACHE READ MISSES
+ * How PERF_TYPE_HW_CACHE names a cache event
+ *********************************************/
+static uint64_t cacheReadMisses(uint64_t cache)
+{
+   return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+#endif // __linux__
+
+/*********************************************
+ * PERF COUNTERS : CONSTRUCTOR
+ * Instructions join the group of cycles, or go
+ * on their own without them
+ *********************************************/
+PerfCounters::PerfCounters()
+{
+   fill(fd, fd + PERF_NUM_EVENTS, -1);
+   fill(isLeader, isLeader + PERF_NUM_EVENTS, true);
+   fill(timeEnabled, timeEnabled + PERF_NUM_EVENTS, 0);
+   fill(timeRunning, timeRunning + PERF_NUM_EVENTS, 0);
+#ifdef __linux__
+   fd[PERF_CYCLES]        = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+   fd[PERF_INSTRUCTIONS]  = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,
+                                      fd[PERF_CYCLES]);
+   isLeader[PERF_INSTRUCTIONS] = (fd[PERF_CYCLES] < 0);
+   fd[PERF_L1D_MISSES]    = openEvent(PERF_TYPE_HW_CACHE,
+                                      cacheReadMisses(PERF_COUNT_HW_CACHE_L1D));
+   fd[PERF_LLC_MISSES]    = openEvent(PERF_TYPE_HW_CACHE,
+                                      cacheReadMisses(PERF_COUNT_HW_CACHE_LL));
+   fd[PERF_BRANCH_MISSES] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif // __linux__
+}
+
+/*********************************************
+ * PERF COUNTERS : DESTRUCTOR
+ *********************************************/
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+   for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      if (fd[i] >= 0)
+         close(fd[i]);
+#endif // __linux__
+}
+
+/*********************************************
+ * PERF COUNTERS : IS AVAILABLE
+ *********************************************/
+bool PerfCounters::isAvailable() const
+{
+   for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      if (fd[i] >= 0)
+         return true;
+   return false;
+}
+
+#ifdef __linux__
+/*********************************************
+ * READ EVENT
+ * The count, then how long the event was enabled
+ * and how long it ran, in nanoseconds
+ *********************************************/
+static bool readEvent(int fd, uint64_t data[3])
+{
+   return fd >= 0 && read(fd, data, 3 * sizeof(uint64_t)) == (ssize_t)(3 * sizeof(uint64_t));
+}
+#endif // __linux__
+
+/*********************************************
+ * PERF COUNTERS : RESET
+ * The kernel zeroes the counts but not the
+ * times, so keep those to measure from
+ *********************************************/
+void PerfCounters::reset()
+{
+#ifdef __linux__
+   for (int i = 0; i < PERF_NUM_EVENTS; i++)
+   {
+      uint64_t data[3];
+      if (fd[i] < 0)
+         continue;
+      ioctl(fd[i], PERF_EVENT_IOC_RESET, 0);
+      if (readEvent(fd[i], data))
+      {
+         timeEnabled[i] = data[1];
+         timeRunning[i] = data[2];
+      }
+   }
+#endif // __linux__
+}
+
+/*********************************************
+ * PERF COUNTERS : RESUME
+ *********************************************/
+void PerfCounters::resume()
+{
+#ifdef __linux__
+   for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      if (fd[i] >= 0 && isLeader[i])
+         ioctl(fd[i], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif // __linux__
+}
+
+/*********************************************
+ * PERF COUNTERS : PAUSE
+ *********************************************/
+void PerfCounters::pause()
+{
+#ifdef __linux__
+   for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      if (fd[i] >= 0 && isLeader[i])
+         ioctl(fd[i], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+#endif // __linux__
+}
+
+/*********************************************
+ * PERF COUNTERS : READ
+ * Each count since reset(), scaled up by how
+ * long it was enabled over how long it ran
+ *********************************************/
+PerfCounts PerfCounters::read() const
+{
+   PerfCounts counts;
+#ifdef __linux__
+   for (int i = 0; i < PERF_NUM_EVENTS; i++)
+   {
+      uint64_t data[3];
+      if (!readEvent(fd[i], data))
+         continue;
+      uint64_t enabled = data[1] - timeEnabled[i];
+      uint64_t running = data[2] - timeRunning[i];
+      if (running == 0)
+         counts.value[i] = (enabled == 0) ? 0.0 : PERF_NOT_COUNTED;
+      else
+         counts.value[i] = (double)data[0] * ((double)enabled / (double)running);
+   }
+#endif // __linux__
+   return counts;
+}
+
+/*********************************************
+ * PERF COUNTERS : GET NAME
+ *********************************************/
+const char* PerfCounters::getName(PerfEvent event)
+{
+   switch (event)
+   {
+      case PERF_CYCLES:
+         return "cycles";
+      case PERF_INSTRUCTIONS:
+         return "instructions";
+      case PERF_L1D_MISSES:
+         return "l1d_misses";
+      case PERF_LLC_MISSES:
+         return "llc_misses";
+      case PERF_BRANCH_MISSES:
+         return "branch_misses";
+      default:
+         return "";
+   }
+}
@@ -0,0 +1,108 @@
+/***********************************************************************
+ * Header File:
+ *    PERF COUNTERS
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Count cycles, instructions, cache misses and branch misses with
+ *    the processor's own counters, where the operating system lets us
+ ************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+// Forward declaration for the unit tests
+class TestPerfCounters;
+
+#define PERF_NOT_COUNTED -1.0   // the event could not be counted here
+
+/*********************************************
+ * PERF EVENT
+ * What the hardware counts
+ *********************************************/
+enum PerfEvent
+{
+   PERF_CYCLES,          // core clock cycles
+   PERF_INSTRUCTIONS,    // instructions retired
+   PERF_L1D_MISSES,      // level 1 data cache read misses
+   PERF_LLC_MISSES,      // last level cache read misses: off to memory
+   PERF_BRANCH_MISSES,   // mispredicted branches
+   PERF_NUM_EVENTS
+};
+
+/*********************************************
+ * PERF COUNTS
+ * One reading of every event. An event the
+ * hardware or the kernel would not count is
+ * PERF_NOT_COUNTED
+ *********************************************/
+struct PerfCounts
+{
+   PerfCounts() { std::fill(value, value + PERF_NUM_EVENTS, PERF_NOT_COUNTED); }
+
+   bool isCounted(PerfEvent event) const { return value[event] >= 0.0; }
+   bool isAnyCounted() const;
+
+   // Instructions per cycle
+   double getIPC() const;
+
+   // The counts spread over so many operations
+   PerfCounts operator / (double divisor) const;
+
+   double value[PERF_NUM_EVENTS];
+};
+
+/*********************************************
+ * PERF COUNTERS
+ * On Linux each event is opened with
+ * perf_event_open() for this thread, user space
+ * only, so it works at the default paranoia
+ * level. Events the machine does not have, as in
+ * most virtual machines, are left out one by one;
+ * if none open, or on any other system, nothing
+ * is available and the rest do nothing.
+ * When there are more events than hardware
+ * counters the kernel takes turns, and the counts
+ * are scaled up by the share of time each ran.
+ * Cycles and instructions are opened as one
+ * group so they always take their turns
+ * together, and the IPC divides counts from the
+ * same stretch of time. The misses are counted
+ * on their own so a small PMU can still fit them
+ *********************************************/
+class PerfCounters
+{
+public:
+   friend ::TestPerfCounters;
+
+   PerfCounters();
+   ~PerfCounters();
+   PerfCounters(const PerfCounters&) = delete;
+   PerfCounters& operator = (const PerfCounters&) = delete;
+
+   // Could anything be opened?
+   bool isAvailable() const;
+   bool isAvailable(PerfEvent event) const { return fd[event] >= 0; }
+
+   // Zero the counts, then count only between resume() and pause(),
+   // so several stretches add up to one reading
+   void reset();
+   void resume();
+   void pause();
+   PerfCounts read() const;
+
+   // Count from zero, then read what was counted since
+   void start() { reset(); resume(); }
+   PerfCounts stop() { pause(); return read(); }
+
+   // For the reports
+   static const char* getName(PerfEvent event);
+
+private:
+   int fd[PERF_NUM_EVENTS];           // one per event, -1 if it did not open
+   bool isLeader[PERF_NUM_EVENTS];    // switched on and off for its whole group
+   uint64_t timeEnabled[PERF_NUM_EVENTS];   // nanoseconds, at the last reset()
+   uint64_t timeRunning[PERF_NUM_EVENTS];
+};
@@ -10,6 +10,100 @@
 #include "physics.h"
 #include <algorithm>
 
+using namespace std;
+
+// Grid spacing of the uniform lookup tables. Each evenly divides every gap
+// in its source table, so the grids reproduce the tables exactly
+const double ALTITUDE_TABLE_STEP = 1000.0;  // meters
+const double MACH_TABLE_STEP     = 0.01;    // Mach
+
+/*********************************************************
+ * GRAVITY MAPPING
+ * Standard gravity values at different altitudes
+ *********************************************************/
+static const Mapping gravityMapping[] =
+{
+   {0.0,     9.807},     // Sea level
+   {1000.0,  9.804},     // 1,000 meters
+   {2000.0,  9.801},     // 2,000 meters
+   {3000.0,  9.797},     // 3,000 meters
+   {4000.0,  9.794},     // 4,000 meters
+   {5000.0,  9.791},     // 5,000 meters
+   {6000.0,  9.788},     // 6,000 meters
+   {7000.0,  9.785},     // 7,000 meters
+   {8000.0,  9.782},     // 8,000 meters
+   {9000.0,  9.779},     // 9,000 meters
+   {10000.0, 9.776},     // 10,000 meters
+   {15000.0, 9.761},     // 15,000 meters
+   {20000.0, 9.745},     // 20,000 meters
+   {25000.0, 9.730},     // 25,000 meters
+   {30000.0, 9.715},     // 30,000 meters
+   {40000.0, 9.684},     // 40,000 meters
+   {50000.0, 9.654},     // 50,000 meters
+   {60000.0, 9.624},     // 60,000 meters
+   {70000.0, 9.594},     // 70,000 meters
+   {80000.0, 9.564}      // 80,000 meters
+};
+const int NUM_GRAVITY_MAPPING = sizeof(gravityMapping) / sizeof(gravityMapping[0]);
+
+/*********************************************************
+ * DENSITY MAPPING
+ * Standard air density values at different altitudes (kg/m³)
+ *********************************************************/
+static const Mapping densityMapping[] =
+{
+   {0.0,     1.225},      // Sea level
+   {1000.0,  1.112},      // 1,000 meters
+   {2000.0,  1.007},      // 2,000 meters
+   {3000.0,  0.9093},     // 3,000 meters
+   {4000.0,  0.8194},     // 4,000 meters
+   {5000.0,  0.7364},     // 5,000 meters
+   {6000.0,  0.6601},     // 6,000 meters
+   {7000.0,  0.5900},     // 7,000 meters
+   {8000.0,  0.5258},     // 8,000 meters
+   {9000.0,  0.4671},     // 9,000 meters
+   {10000.0, 0.4135},     // 10,000 meters
+   {15000.0, 0.1948},     // 15,000 meters
+   {20000.0, 0.08891},    // 20,000 meters
+   {25000.0, 0.04008},    // 25,000 meters
+   {30000.0, 0.01841},    // 30,000 meters
+   {40000.0, 0.003996},   // 40,000 meters
+   {50000.0, 0.001027},   // 50,000 meters
+   {60000.0, 0.0003097},  // 60,000 meters
+   {70000.0, 0.0000828},  // 70,000 meters
+   {80000.0, 0.0000185}   // 80,000 meters
+};
+const int NUM_DENSITY_MAPPING = sizeof(densityMapping) / sizeof(densityMapping[0]);
+
+/*********************************************************
+ * SPEED OF SOUND MAPPING
+ * Speed of sound values at different altitudes (m/s)
+ *********************************************************/
+static const Mapping speedSoundMapping[] =
+{
+   {0.0,     340.0},     // Sea level
+   {1000.0,  336.0},     // 1,000 meters
+   {2000.0,  332.0},     // 2,000 meters
+   {3000.0,  328.0},     // 3,000 meters
+   {4000.0,  324.0},     // 4,000 meters
+   {5000.0,  320.0},     // 5,000 meters
+   {6000.0,  316.0},     // 6,000 meters
+   {7000.0,  312.0},     // 7,000 meters
+   {8000.0,  308.0},     // 8,000 meters
+   {9000.0,  303.0},     // 9,000 meters
+   {10000.0, 299.0},     // 10,000 meters
+   {15000.0, 295.0},     // 15,000 meters
+   {20000.0, 295.0},     // 20,000 meters
+   {25000.0, 295.0},     // 25,000 meters
+   {30000.0, 305.0},     // 30,000 meters
+   {40000.0, 324.0},     // 40,000 meters
+   {50000.0, 337.0},     // 50,000 meters
+   {60000.0, 319.0},     // 60,000 meters
+   {70000.0, 289.0},     // 70,000 meters
+   {80000.0, 269.0}      // 80,000 meters
+};
+const int NUM_SPEED_SOUND_MAPPING = sizeof(speedSoundMapping) / sizeof(speedSoundMapping[0]);
+
 /*********************************************************
  * LINEAR INTERPOLATION WITH MAPPING
  * From a list of domains and ranges, linear interpolate
@@ -46,6 +140,102 @@ double linearInterpolation(const Mapping mapping[], int numMapping, double domai
                               domain);
 }
 
+/*********************************************************
+ * UNIFORM TABLE : CONSTRUCTOR
+ * Resample a Mapping table every step units of domain and
+ * measure how far the result strays from the original
+ *********************************************************/
+UniformTable::UniformTable(const Mapping mapping[], int numMapping, double step) :
+   domainMin(mapping[0].domain),
+   step(step),
+   stepInverse(1.0 / step),
+   maxError(0.0)
+{
+   assert(mapping != nullptr);
+   assert(numMapping > 1);
+   assert(step > 0.0);
+   
+   // enough grid points to reach the end of the table
+   double span = mapping[numMapping - 1].domain - domainMin;
+   int numNodes = (int)ceil(span / step - 1e-9) + 1;
+   domainMax = domainMin + (numNodes - 1) * step;
+   
+   // sample the original table at every grid point
+   nodes.resize(numNodes);
+   for (int i = 0; i < numNodes; i++)
+      nodes[i].range = linearInterpolation(mapping, numMapping, domainMin + i * step);
+   for (int i = 0; i < numNodes - 1; i++)
+      nodes[i].delta = nodes[i + 1].range - nodes[i].range;
+   nodes[numNodes - 1].delta = 0.0;
+   
+   // the grid points are exact, so the worst case is at an original point
+   for (int i = 0; i < numMapping; i++)
+      maxError = max(maxError, fabs((*this)(mapping[i].domain) - mapping[i].range));
+}
+
+/*********************************************************
+ * ATMOSPHERE TABLE : CONSTRUCTOR
+ * Resample the three altitude tables onto one grid and
+ * measure how far the result strays from the originals
+ *********************************************************/
+AtmosphereTable::AtmosphereTable(const Mapping density[],    int numDensity,
+                                 const Mapping speedSound[], int numSpeedSound,
+                                 const Mapping gravity[],    int numGravity,
+                                 double step) :
+   altitudeMin(min(density[0].domain, min(speedSound[0].domain, gravity[0].domain))),
+   step(step),
+   stepInverse(1.0 / step),
+   maxError(0.0)
+{
+   assert(numDensity > 0 && numSpeedSound > 0 && numGravity > 0);
+   assert(step > 0.0);
+   
+   // enough grid points to reach the end of the longest table
+   double altitudeMax = max(density[numDensity - 1].domain,
+                            max(speedSound[numSpeedSound - 1].domain,
+                                gravity[numGravity - 1].domain));
+   int numNodes = max(2, (int)ceil((altitudeMax - altitudeMin) / step - 1e-9) + 1);
+   
+   // sample every table at every grid point
+   nodes.resize(numNodes);
+   for (int i = 0; i < numNodes; i++)
+   {
+      double altitude = altitudeMin + i * step;
+      nodes[i].value.density    = linearInterpolation(density,    numDensity,    altitude);
+      nodes[i].value.speedSound = linearInterpolation(speedSound, numSpeedSound, altitude);
+      nodes[i].value.gravity    = linearInterpolation(gravity,    numGravity,    altitude);
+   }
+   for (int i = 0; i < numNodes - 1; i++)
+   {
+      nodes[i].delta.density    = nodes[i + 1].value.density    - nodes[i].value.density;
+      nodes[i].delta.speedSound = nodes[i + 1].value.speedSound - nodes[i].value.speedSound;
+      nodes[i].delta.gravity    = nodes[i + 1].value.gravity    - nodes[i].value.gravity;
+   }
+   nodes[numNodes - 1].delta = AtmosphereSample{ 0.0, 0.0, 0.0 };
+   
+   // the grid points are exact, so the worst case is at an original point
+   for (int i = 0; i < numDensity; i++)
+      maxError = max(maxError, fabs((*this)(density[i].domain).density - density[i].range));
+   for (int i = 0; i < numSpeedSound; i++)
+      maxError = max(maxError, fabs((*this)(speedSound[i].domain).speedSound - speedSound[i].range));
+   for (int i = 0; i < numGravity; i++)
+      maxError = max(maxError, fabs((*this)(gravity[i].domain).gravity - gravity[i].range));
+}
+
+/*********************************************************
+ * ATMOSPHERE AT
+ * Density, speed of sound and gravity at an altitude
+ * from the standard atmosphere, in one lookup
+ *********************************************************/
+AtmosphereSample atmosphereAt(double altitude)
+{
+   static const AtmosphereTable atmosphereTable(densityMapping,    NUM_DENSITY_MAPPING,
+                                                speedSoundMapping, NUM_SPEED_SOUND_MAPPING,
+                                                gravityMapping,    NUM_GRAVITY_MAPPING,
+                                                ALTITUDE_TABLE_STEP);
+   return atmosphereTable(altitude);
+}
+
 /*********************************************************
  * GRAVITY FROM ALTITUDE
  * Determine gravity coefficient based on the altitude
@@ -53,33 +243,8 @@ double linearInterpolation(const Mapping mapping[], int numMapping, double domai
  *********************************************************/
 double gravityFromAltitude(double altitude)
 {
-   // Standard gravity values at different altitudes
-   static const Mapping gravityMapping[] =
-   {
-      {0.0,     9.807},     // Sea level
-      {1000.0,  9.804},     // 1,000 meters
-      {2000.0,  9.801},     // 2,000 meters
-      {3000.0,  9.797},     // 3,000 meters
-      {4000.0,  9.794},     // 4,000 meters
-      {5000.0,  9.791},     // 5,000 meters
-      {6000.0,  9.788},     // 6,000 meters
-      {7000.0,  9.785},     // 7,000 meters
-      {8000.0,  9.782},     // 8,000 meters
-      {9000.0,  9.779},     // 9,000 meters
-      {10000.0, 9.776},     // 10,000 meters
-      {15000.0, 9.761},     // 15,000 meters
-      {20000.0, 9.745},     // 20,000 meters
-      {25000.0, 9.730},     // 25,000 meters
-      {30000.0, 9.715},     // 30,000 meters
-      {40000.0, 9.684},     // 40,000 meters
-      {50000.0, 9.654},     // 50,000 meters
-      {60000.0, 9.624},     // 60,000 meters
-      {70000.0, 9.594},     // 70,000 meters
-      {80000.0, 9.564}      // 80,000 meters
-   };
-   
-   constexpr int numMapping = sizeof(gravityMapping) / sizeof(gravityMapping[0]);
-   return linearInterpolation(gravityMapping, numMapping, altitude);
+   static const UniformTable gravityTable(gravityMapping, NUM_GRAVITY_MAPPING, ALTITUDE_TABLE_STEP);
+   return gravityTable(altitude);
 }
 
 /*********************************************************
@@ -89,33 +254,8 @@ double gravityFromAltitude(double altitude)
  *********************************************************/
 double densityFromAltitude(double altitude)
 {
-   // Standard air density values at different altitudes (kg/m³)
-   static const Mapping densityMapping[] =
-   {
-      {0.0,     1.225},      // Sea level
-      {1000.0,  1.112},      // 1,000 meters
-      {2000.0,  1.007},      // 2,000 meters
-      {3000.0,  0.9093},     // 3,000 meters
-      {4000.0,  0.8194},     // 4,000 meters
-      {5000.0,  0.7364},     // 5,000 meters
-      {6000.0,  0.6601},     // 6,000 meters
-      {7000.0,  0.5900},     // 7,000 meters
-      {8000.0,  0.5258},     // 8,000 meters
-      {9000.0,  0.4671},     // 9,000 meters
-      {10000.0, 0.4135},     // 10,000 meters
-      {15000.0, 0.1948},     // 15,000 meters
-      {20000.0, 0.08891},    // 20,000 meters
-      {25000.0, 0.04008},    // 25,000 meters
-      {30000.0, 0.01841},    // 30,000 meters
-      {40000.0, 0.003996},   // 40,000 meters
-      {50000.0, 0.001027},   // 50,000 meters
-      {60000.0, 0.0003097},  // 60,000 meters
-      {70000.0, 0.0000828},  // 70,000 meters
-      {80000.0, 0.0000185}   // 80,000 meters
-   };
-   
-   constexpr int numMapping = sizeof(densityMapping) / sizeof(densityMapping[0]);
-   return linearInterpolation(densityMapping, numMapping, altitude);
+   static const UniformTable densityTable(densityMapping, NUM_DENSITY_MAPPING, ALTITUDE_TABLE_STEP);
+   return densityTable(altitude);
 }
 
 /*********************************************************
@@ -125,33 +265,8 @@ double densityFromAltitude(double altitude)
  *********************************************************/
 double speedSoundFromAltitude(double altitude)
 {
-   // Speed of sound values at different altitudes (m/s)
-   static const Mapping speedSoundMapping[] =
-   {
-      {0.0,     340.0},     // Sea level
-      {1000.0,  336.0},     // 1,000 meters
-      {2000.0,  332.0},     // 2,000 meters
-      {3000.0,  328.0},     // 3,000 meters
-      {4000.0,  324.0},     // 4,000 meters
-      {5000.0,  320.0},     // 5,000 meters
-      {6000.0,  316.0},     // 6,000 meters
-      {7000.0,  312.0},     // 7,000 meters
-      {8000.0,  308.0},     // 8,000 meters
-      {9000.0,  303.0},     // 9,000 meters
-      {10000.0, 299.0},     // 10,000 meters
-      {15000.0, 295.0},     // 15,000 meters
-      {20000.0, 295.0},     // 20,000 meters
-      {25000.0, 295.0},     // 25,000 meters
-      {30000.0, 305.0},     // 30,000 meters
-      {40000.0, 324.0},     // 40,000 meters
-      {50000.0, 337.0},     // 50,000 meters
-      {60000.0, 319.0},     // 60,000 meters
-      {70000.0, 289.0},     // 70,000 meters
-      {80000.0, 269.0}      // 80,000 meters
-   };
-   
-   constexpr int numMapping = sizeof(speedSoundMapping) / sizeof(speedSoundMapping[0]);
-   return linearInterpolation(speedSoundMapping, numMapping, altitude);
+   static const UniformTable speedSoundTable(speedSoundMapping, NUM_SPEED_SOUND_MAPPING, ALTITUDE_TABLE_STEP);
+   return speedSoundTable(altitude);
 }
 
 /*********************************************************
@@ -185,5 +300,6 @@ double dragFromMach(double speedMach)
    };
    
    constexpr int numMapping = sizeof(dragMapping) / sizeof(dragMapping[0]);
-   return linearInterpolation(dragMapping, numMapping, speedMach);
+   static const UniformTable dragTable(dragMapping, numMapping, MACH_TABLE_STEP);
+   return dragTable(speedMach);
 }
@@ -12,6 +12,7 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <cassert>
+#include <vector>
 
 /*******************************************************
  * AREA FROM RADIUS
@@ -116,6 +117,148 @@ struct Mapping
  *********************************************************/
 double linearInterpolation(const Mapping mapping[], int numMapping, double domain);
 
+/*********************************************************
+ * UNIFORM TABLE
+ * A Mapping table resampled onto evenly spaced domain values
+ * so a lookup is one multiply, one truncation and one lerp
+ * instead of a binary search:
+ *
+ *    index = (d - d0) / step
+ *    r     = range[i] + delta[i] * (index - i)
+ *
+ * Between neighbouring points of the grid and the original
+ * table both curves are straight lines, so the largest
+ * difference occurs at one of those points. The constructor
+ * measures it there and getMaxError() reports it. When the step
+ * evenly divides every gap in the original table the grid
+ * contains every original point and the error is zero beyond
+ * floating-point round-off.
+ *********************************************************/
+class UniformTable
+{
+public:
+   UniformTable(const Mapping mapping[], int numMapping, double step);
+   
+   // Look up a range value. Clamps outside the table like
+   // linearInterpolation() does
+   double operator()(double domain) const
+   {
+      if (domain <= domainMin)
+         return nodes.front().range;
+      if (domain >= domainMax)
+         return nodes.back().range;
+      
+      double index = (domain - domainMin) * stepInverse;
+      size_t i = (size_t)index;
+      if (i >= nodes.size() - 1)        // round-off at the top edge
+         i = nodes.size() - 2;
+      
+      const Node& node = nodes[i];
+      return node.range + node.delta * (index - (double)i);
+   }
+   
+   // Largest difference from linearInterpolation() over the table
+   double getMaxError() const { return maxError; }
+   double getStep() const { return step; }
+   int getNumNodes() const { return (int)nodes.size(); }
+   
+private:
+   // The range at a grid point and the rise to the next one
+   struct Node
+   {
+      double range;
+      double delta;
+   };
+   
+   std::vector<Node> nodes;   // range and rise at each grid point
+   double domainMin;          // domain of the first grid point
+   double domainMax;          // domain of the last grid point
+   double step;               // distance between grid points
+   double stepInverse;        // 1 / step
+   double maxError;           // measured worst-case lookup error
+};
+
+/*********************************************************
+ * ATMOSPHERE SAMPLE
+ * Everything a shell needs to know about the air at one
+ * altitude. Filled in by a single table lookup
+ *********************************************************/
+struct AtmosphereSample
+{
+   double density;      // air density (kg/m³)
+   double speedSound;   // speed of sound (m/s)
+   double gravity;      // gravitational acceleration (m/s²)
+};
+
+/*********************************************************
+ * ATMOSPHERE TABLE
+ * Density, speed of sound and gravity resampled onto one
+ * uniform altitude grid and stored side by side. A lookup
+ * finds the grid cell once and reads all three quantities
+ * from a single 64-byte node. The error behaves exactly as
+ * it does for UniformTable, quantity by quantity
+ *********************************************************/
+class AtmosphereTable
+{
+public:
+   AtmosphereTable(const Mapping density[],    int numDensity,
+                   const Mapping speedSound[], int numSpeedSound,
+                   const Mapping gravity[],    int numGravity,
+                   double step);
+   
+   // Sample the atmosphere. Altitudes outside the table are
+   // clamped, so anything below sea level reads as sea level
+   AtmosphereSample operator()(double altitude) const
+   {
+      double index = (altitude - altitudeMin) * stepInverse;
+      size_t i = 0;
+      double fraction = 0.0;
+      if (index >= (double)(nodes.size() - 1))
+      {
+         i = nodes.size() - 2;
+         fraction = 1.0;
+      }
+      else if (index > 0.0)
+      {
+         i = (size_t)index;
+         fraction = index - (double)i;
+      }
+      
+      const Node& node = nodes[i];
+      AtmosphereSample sample;
+      sample.density    = node.value.density    + node.delta.density    * fraction;
+      sample.speedSound = node.value.speedSound + node.delta.speedSound * fraction;
+      sample.gravity    = node.value.gravity    + node.delta.gravity    * fraction;
+      return sample;
+   }
+   
+   // Largest difference from linearInterpolation() of any quantity
+   double getMaxError() const { return maxError; }
+   double getStep() const { return step; }
+   int getNumNodes() const { return (int)nodes.size(); }
+   
+private:
+   // One grid point and the rise to the next, padded to a cache line
+   struct alignas(64) Node
+   {
+      AtmosphereSample value;
+      AtmosphereSample delta;
+   };
+   
+   std::vector<Node> nodes;   // interleaved samples at each grid point
+   double altitudeMin;        // altitude of the first grid point
+   double step;               // distance between grid points
+   double stepInverse;        // 1 / step
+   double maxError;           // measured worst-case lookup error
+};
+
+/*********************************************************
+ * ATMOSPHERE AT
+ * Density, speed of sound and gravity at an altitude
+ * from the standard atmosphere, in one lookup
+ *********************************************************/
+AtmosphereSample atmosphereAt(double altitude);
+
 /*********************************************************
  * GRAVITY FROM ALTITUDE
  * Determine gravity coefficient based on the altitude
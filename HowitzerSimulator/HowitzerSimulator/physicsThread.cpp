@@ -0,0 +1,76 @@
+/***********************************************************************
+ * Source File:
+ *    PHYSICS THREAD
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Runs the simulation on its own thread at a fixed time step, so
+ *    that neither the physics nor the frame rate depends on the other
+ ************************************************************************/
+
+#include "physicsThread.h"
+#include "profiler.h"
+#include <chrono>
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+using namespace std::chrono;
+
+/*********************************************
+ * PHYSICS THREAD : CONSTRUCTOR
+ *********************************************/
+PhysicsThread::PhysicsThread(Simulator& sim, double timeStep, double timeScale) :
+   sim(sim), timeStep(timeStep), timeScale(timeScale),
+   isStopping(false), numSteps(0), updateNanoseconds(0),
+   thread(&PhysicsThread::run, this)
+{
+   assert(timeStep > 0.0);
+   assert(timeScale > 0.0);
+}
+
+/*********************************************
+ * PHYSICS THREAD : DESTRUCTOR
+ *********************************************/
+PhysicsThread::~PhysicsThread()
+{
+   isStopping = true;
+   thread.join();
+}
+
+/*********************************************
+ * PHYSICS THREAD : RUN
+ * Sleep until a step is due, take every step
+ * that is due, publish, repeat. A stall longer
+ * than MAX_CATCH_UP is dropped rather than
+ * run all at once
+ *********************************************/
+void PhysicsThread::run()
+{
+   Profiler::setThreadName("physics");
+   double realStep = timeStep / timeScale;
+   double accumulator = 0.0;
+   steady_clock::time_point previous = steady_clock::now();
+
+   while (!isStopping)
+   {
+      steady_clock::time_point now = steady_clock::now();
+      accumulator = min(accumulator + duration<double>(now - previous).count(),
+                        MAX_CATCH_UP);
+      previous = now;
+
+      while (accumulator >= realStep)
+      {
+         sim.update(timeStep);
+         accumulator -= realStep;
+         numSteps++;
+      }
+      sim.publish();
+
+      // a clock read per batch, not per step
+      updateNanoseconds += duration_cast<nanoseconds>(steady_clock::now() - now).count();
+
+      this_thread::sleep_until(now + duration_cast<steady_clock::duration>(
+                                        duration<double>(realStep - accumulator)));
+   }
+}
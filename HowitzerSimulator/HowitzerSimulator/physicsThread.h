@@ -0,0 +1,66 @@
+/***********************************************************************
+ * Header File:
+ *    PHYSICS THREAD
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Runs the simulation on its own thread at a fixed time step, so
+ *    that neither the physics nor the frame rate depends on the other
+ ************************************************************************/
+
+#pragma once
+
+#include "simulation.h"
+#include <thread>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Forward declaration for the unit tests
+class TestPhysicsThread;
+
+#define MAX_CATCH_UP 0.25    // seconds of real time made up at once
+
+/*********************************************
+ * PHYSICS THREAD
+ * A fixed-step accumulator: real time piles up
+ * and is spent in whole steps of timeStep
+ * simulated seconds, timeScale simulated seconds
+ * to the real one. After each batch of steps the
+ * state is published for Simulator::draw(),
+ * which blends the last two. A slow frame no
+ * longer slows the simulation, and a small step
+ * no longer slows the frame. The thread starts
+ * with the object and stops with it
+ *********************************************/
+class PhysicsThread
+{
+public:
+   friend ::TestPhysicsThread;
+
+   PhysicsThread(Simulator& sim, double timeStep = TIME_STEP,
+                 double timeScale = TIME_SCALE);
+   ~PhysicsThread();
+
+   PhysicsThread(const PhysicsThread&) = delete;
+   PhysicsThread& operator=(const PhysicsThread&) = delete;
+
+   double getTimeStep() const { return timeStep; }
+   double getTimeScale() const { return timeScale; }
+
+   // Steps taken so far, and the time spent taking and publishing them
+   size_t getNumSteps() const { return numSteps; }
+   uint64_t getUpdateNanoseconds() const { return updateNanoseconds; }
+
+private:
+   // What the thread does until it is stopped
+   void run();
+
+   Simulator& sim;
+   double timeStep;                 // simulated seconds per step
+   double timeScale;                // simulated seconds per real second
+   std::atomic<bool> isStopping;
+   std::atomic<size_t> numSteps;
+   std::atomic<uint64_t> updateNanoseconds;
+   std::thread thread;              // last, so it starts after the rest is set
+};
@@ -4,7 +4,8 @@
  * Author:
  *    Gary Sibanda
  * Summary:
- *    Everything we need to know about a location on the screen.
+ *    Everything we need to know about a location on the field.
+ *    Pixels are the business of Viewport
  ************************************************************************/
 
 #include "position.h"
@@ -14,8 +15,6 @@
 #include <cassert>
 #include <cmath>
 
-// Note: metersFromPixels is initialized in main.cpp
-
 /*******************************************
  * POSITION : NON-DEFAULT CONSTRUCTOR
  *****************************************/
@@ -4,7 +4,8 @@
  * Author:
  *    Gary Sibanda
  * Summary:
- *    Everything we need to know about a location on the screen.
+ *    Everything we need to know about a location on the field.
+ *    Pixels are the business of Viewport
  ************************************************************************/
 
 #pragma once
@@ -23,8 +24,8 @@ class Angle;
 
 /*********************************************
  * Position
- * A single position on the field in Meters
- * with automatic conversion to/from pixels
+ * A single position on the field in Meters.
+ * See Viewport to convert to and from pixels
  *********************************************/
 class Position
 {
@@ -46,18 +47,10 @@ public:
    double getMetersX() const { return x; }
    double getMetersY() const { return y; }
    
-   // Getters - Pixels
-   double getPixelsX() const { return x / metersFromPixels; }
-   double getPixelsY() const { return y / metersFromPixels; }
-   
    // Getters - Utility
-   double getZoom() const { return metersFromPixels; }
    double getDistanceTo(const Position& other) const;  // NEW: distance calculation
    // Angle getAngleTo(const Position& other) const;      // NEW: angle to another position (commented out to avoid circular dependency)
 
-   // Setters - Zoom
-   void setZoom(double z) { metersFromPixels = z; }
-   
    // Setters - Meters
    void setMeters(double xMeters, double yMeters)
    {
@@ -67,24 +60,11 @@ public:
    void setMetersX(double xMeters) { x = xMeters; }
    void setMetersY(double yMeters) { y = yMeters; }
    
-   // Setters - Pixels
-   void setPixelsX(double xPixels) { x = xPixels * metersFromPixels; }
-   void setPixelsY(double yPixels) { y = yPixels * metersFromPixels; }
-   
    // Mutators - Meters
    void addMetersX(double x) { this->x += x; }
    void addMetersY(double y) { this->y += y; }
    void addMeters(double x, double y) { this->x += x; this->y += y; }
    
-   // Mutators - Pixels
-   void addPixelsX(double x) { this->x += x * metersFromPixels; }
-   void addPixelsY(double y) { this->y += y * metersFromPixels; }
-   void addPixels(double x, double y)
-   {
-      this->x += x * metersFromPixels;
-      this->y += y * metersFromPixels;
-   }
-   
    // Physics update
    void add(const Acceleration& a, const Velocity& v, double t);
    
@@ -106,7 +86,6 @@ public:
 private:
    double x;                           // horizontal position in meters
    double y;                           // vertical position in meters
-   static double metersFromPixels;     // conversion factor
 };
 
 // Stream I/O useful for debugging
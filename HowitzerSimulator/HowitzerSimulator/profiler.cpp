@@ -0,0 +1,186 @@
+/***********************************************************************
+ * Source File:
+ *    PROFILER
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Time named zones of code on every thread as the program runs, and
+ *    save them as a Chrome trace to look at in chrome://tracing or
+ *    Perfetto
+ ************************************************************************/
+
+#include "profiler.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+
+using namespace std;
+using namespace std::chrono;
+
+atomic<bool>           Profiler::isOn(false);
+atomic<ProfileBuffer*> Profiler::pHead(NULL);
+atomic<int>            Profiler::numThreads(0);
+
+// Every timestamp is measured from here
+static const steady_clock::time_point profileStart = steady_clock::now();
+
+// This thread's buffer, NULL until it first records, and its name
+static thread_local ProfileBuffer* pThreadBuffer = NULL;
+static thread_local const char* pThreadName = NULL;
+
+/*********************************************
+ * PROFILE BUFFER : CONSTRUCTOR
+ *********************************************/
+ProfileBuffer::ProfileBuffer(int threadID) :
+   events(PROFILE_EVENTS_PER_THREAD), count(0), numStarted(0), threadID(threadID),
+   threadName(NULL), pNext(NULL)
+{
+}
+
+/*********************************************
+ * PROFILE BUFFER : COPY
+ * Copy what looks like the ring, then see how
+ * far the writer got meanwhile. A writer that
+ * has begun push number n is writing the slot
+ * of event n - capacity, so once it has begun
+ * "after" pushes everything before
+ * after - capacity may be torn: drop it
+ *********************************************/
+void ProfileBuffer::copy(vector<ProfileEvent>& out) const
+{
+   const uint64_t capacity = PROFILE_EVENTS_PER_THREAD;
+   uint64_t end = count.load(memory_order_acquire);
+   uint64_t begin = (end > capacity) ? end - capacity : 0;
+
+   vector<ProfileEvent> ring;
+   ring.reserve(end - begin);
+   for (uint64_t i = begin; i < end; i++)
+      ring.push_back(events[i % capacity]);
+
+   // the copy above may not move past this
+   atomic_thread_fence(memory_order_acquire);
+   uint64_t after = numStarted.load(memory_order_relaxed);
+   uint64_t safe = (after > capacity) ? after - capacity : 0;
+   uint64_t skip = (safe > begin) ? min(safe - begin, end - begin) : 0;
+   out.insert(out.end(), ring.begin() + skip, ring.end());
+}
+
+/*********************************************
+ * PROFILER : NOW
+ *********************************************/
+int64_t Profiler::now()
+{
+   return duration_cast<nanoseconds>(steady_clock::now() - profileStart).count();
+}
+
+/*********************************************
+ * PROFILER : GET BUFFER
+ * This thread's buffer, made and pushed on the
+ * front of the list the first time
+ *********************************************/
+ProfileBuffer& Profiler::getBuffer()
+{
+   if (pThreadBuffer == NULL)
+   {
+      ProfileBuffer* pBuffer = new ProfileBuffer(numThreads.fetch_add(1) + 1);
+      pBuffer->setThreadName(pThreadName);
+      ProfileBuffer* pOld = pHead.load(memory_order_relaxed);
+      do
+         pBuffer->pNext = pOld;
+      while (!pHead.compare_exchange_weak(pOld, pBuffer,
+                                          memory_order_release, memory_order_relaxed));
+      pThreadBuffer = pBuffer;
+   }
+   return *pThreadBuffer;
+}
+
+/*********************************************
+ * PROFILER : SET THREAD NAME
+ * Threads that never record never get a buffer,
+ * so keep the name until they do
+ *********************************************/
+void Profiler::setThreadName(const char* name)
+{
+   pThreadName = name;
+   if (pThreadBuffer)
+      pThreadBuffer->setThreadName(name);
+}
+
+/*********************************************
+ * PROFILER : CLEAR
+ *********************************************/
+void Profiler::clear()
+{
+   for (ProfileBuffer* p = pHead.load(memory_order_acquire); p; p = p->pNext)
+      p->clear();
+}
+
+/*********************************************
+ * WRITE NAME
+ * A zone or thread name as a JSON string
+ *********************************************/
+static void writeName(ostream& out, const char* name)
+{
+   out << '"';
+   for (const char* p = name; *p; p++)
+   {
+      if (*p == '"' || *p == '\\')
+         out << '\\';
+      if ((unsigned char)*p >= ' ')
+         out << *p;
+   }
+   out << '"';
+}
+
+/*********************************************
+ * PROFILER : WRITE TRACE
+ * Each zone is a complete ("X") event with its
+ * start and length in microseconds. Each named
+ * thread gets a metadata ("M") event so the
+ * viewer can label its track
+ *********************************************/
+void Profiler::writeTrace(ostream& out)
+{
+   out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+   out << fixed << setprecision(3);
+
+   bool isFirst = true;
+   vector<ProfileEvent> events;
+   for (ProfileBuffer* p = pHead.load(memory_order_acquire); p; p = p->pNext)
+   {
+      const char* threadName = p->getThreadName();
+      if (threadName)
+      {
+         out << (isFirst ? "\n" : ",\n")
+             << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+             << p->getThreadID() << ",\"args\":{\"name\":";
+         writeName(out, threadName);
+         out << "}}";
+         isFirst = false;
+      }
+
+      events.clear();
+      p->copy(events);
+      for (const ProfileEvent& event : events)
+      {
+         out << (isFirst ? "\n" : ",\n") << "{\"name\":";
+         writeName(out, event.name);
+         out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << p->getThreadID()
+             << ",\"ts\":" << (double)event.begin / 1000.0
+             << ",\"dur\":" << (double)(event.end - event.begin) / 1000.0 << '}';
+         isFirst = false;
+      }
+   }
+
+   out << "\n]}\n";
+}
+
+bool Profiler::writeTrace(const string& filename)
+{
+   ofstream fout(filename);
+   if (!fout)
+      return false;
+   writeTrace(fout);
+   return fout.good();
+}
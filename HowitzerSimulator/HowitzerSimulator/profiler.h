@@ -0,0 +1,170 @@
+/***********************************************************************
+ * Header File:
+ *    PROFILER
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Time named zones of code on every thread as the program runs, and
+ *    save them as a Chrome trace to look at in chrome://tracing or
+ *    Perfetto
+ ************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+// Forward declaration for the unit tests
+class TestProfiler;
+
+#define PROFILE_EVENTS_PER_THREAD 16384   // the most recent zones kept per thread
+
+/*********************************************
+ * PROFILE ZONE macro
+ * Time the rest of the enclosing block. Without
+ * PROFILE defined this is nothing at all
+ *********************************************/
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#ifdef PROFILE
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#endif // PROFILE
+
+/*********************************************
+ * PROFILE EVENT
+ * One zone: when it started and ended, in
+ * nanoseconds since the profiler started
+ *********************************************/
+struct ProfileEvent
+{
+   const char* name;   // a string literal, never copied
+   int64_t begin;
+   int64_t end;
+};
+
+/*********************************************
+ * PROFILE BUFFER
+ * A ring of the most recent events of one
+ * thread, read like a seqlock. Only that thread
+ * writes: it announces each push in numStarted
+ * before touching the slot and in count after,
+ * so it never waits. Another thread may copy
+ * the ring at any time: it reads count, copies,
+ * then drops every event the writer could have
+ * begun to overwrite by the time it finished
+ *********************************************/
+class ProfileBuffer
+{
+public:
+   friend ::TestProfiler;
+
+   ProfileBuffer(int threadID);
+
+   // From the thread that owns the buffer
+   void push(const ProfileEvent& event)
+   {
+      uint64_t n = count.load(std::memory_order_relaxed);
+      numStarted.store(n + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);   // before the slot changes
+      events[n % PROFILE_EVENTS_PER_THREAD] = event;
+      count.store(n + 1, std::memory_order_release);
+   }
+
+   // From any thread: the events still in the ring, oldest first
+   void copy(std::vector<ProfileEvent>& out) const;
+
+   int getThreadID() const { return threadID; }
+   const char* getThreadName() const { return threadName.load(std::memory_order_acquire); }
+   void setThreadName(const char* name) { threadName.store(name, std::memory_order_release); }
+
+   // Forget everything. Only while no thread is recording
+   void clear()
+   {
+      count.store(0, std::memory_order_release);
+      numStarted.store(0, std::memory_order_release);
+   }
+
+private:
+   std::vector<ProfileEvent> events;      // the ring
+   std::atomic<uint64_t> count;           // pushes finished
+   std::atomic<uint64_t> numStarted;      // pushes begun: count, or one more
+   int threadID;                          // in the order threads first recorded
+   std::atomic<const char*> threadName;   // NULL until named
+
+   ProfileBuffer* pNext;                  // the next in Profiler's list
+   friend class Profiler;
+};
+
+/*********************************************
+ * PROFILER
+ * Each thread gets its own ProfileBuffer the
+ * first time it records, added to a list with a
+ * compare and swap, so recording never takes a
+ * lock. Buffers live until the program ends.
+ * Recording is off until setEnabled(true): then
+ * a disabled zone costs one relaxed load
+ *********************************************/
+class Profiler
+{
+public:
+   friend ::TestProfiler;
+
+   // Start or stop recording on every thread
+   static void setEnabled(bool value) { isOn.store(value, std::memory_order_relaxed); }
+   static bool isEnabled() { return isOn.load(std::memory_order_relaxed); }
+
+   // Nanoseconds since the profiler started
+   static int64_t now();
+
+   // Add a finished zone to this thread's buffer
+   static void record(const char* name, int64_t begin, int64_t end)
+   {
+      getBuffer().push(ProfileEvent{ name, begin, end });
+   }
+
+   // What this thread is called in the trace. A string literal
+   static void setThreadName(const char* name);
+
+   // Chrome trace-event JSON of everything still in the buffers
+   static void writeTrace(std::ostream& out);
+   static bool writeTrace(const std::string& filename);
+
+   // Forget everything. Only while no thread is recording
+   static void clear();
+
+private:
+   static ProfileBuffer& getBuffer();
+
+   static std::atomic<bool> isOn;              // recording?
+   static std::atomic<ProfileBuffer*> pHead;   // every thread's buffer
+   static std::atomic<int> numThreads;         // buffers made so far
+};
+
+/*********************************************
+ * PROFILE ZONE
+ * Record the time from construction to the end
+ * of the scope, if the profiler was on when it
+ * started. Use PROFILE_ZONE() rather than this
+ *********************************************/
+class ProfileZone
+{
+public:
+   explicit ProfileZone(const char* name) :
+      name(name), begin(Profiler::isEnabled() ? Profiler::now() : -1) {}
+   ~ProfileZone()
+   {
+      if (begin >= 0)
+         Profiler::record(name, begin, Profiler::now());
+   }
+   ProfileZone(const ProfileZone&) = delete;
+   ProfileZone& operator = (const ProfileZone&) = delete;
+
+private:
+   const char* name;
+   int64_t begin;   // -1 when not recording
+};
@@ -26,6 +26,7 @@ void Projectile::reset()
    radius = DEFAULT_PROJECTILE_RADIUS;
    isActive = false;
    flightPath.clear();
+   stepper.stop();
 }
 
 /*********************************************
@@ -47,103 +48,51 @@ void Projectile::fire(const Position& pos, const Angle& angle, double muzzleVelo
    // Add to flight path and mark as active
    flightPath.push_back(pvt);
    isActive = true;
+   stepper.stop();
 }
 
 /*********************************************
- * PROJECTILE : ADVANCE
- * Update projectile position using realistic physics
+ * PROJECTILE : ADVANCE ADAPTIVE
+ * Let the Dormand-Prince integrator run past the
+ * requested time, then interpolate back to it. The
+ * integrator keeps its own state between calls, so
+ * the frame rate never dictates the step size
  *********************************************/
-void Projectile::advance(double simulationTime)
+void Projectile::advanceAdaptive(double simulationTime)
 {
-   // Check if projectile is active and has initial state
+   PROFILE_ZONE("Projectile::advanceAdaptive");
    if (!isActive || flightPath.empty())
       return;
    
-   // Get current state
    const PositionVelocityTime& currentPvt = flightPath.back();
-   double deltaTime = simulationTime - currentPvt.t;
-   
-   // Ensure positive time step
-   if (deltaTime <= 0.0)
+   if (simulationTime <= currentPvt.t)
       return;
    
-   // Calculate total acceleration (gravity + drag)
-   Acceleration totalAcceleration = calculateTotalAcceleration(currentPvt);
-   
-   // Create new state using kinematic equations
-   PositionVelocityTime newPvt;
-   newPvt.pos = currentPvt.pos;
-   newPvt.v = currentPvt.v;
-   newPvt.t = simulationTime;
-   
-   // Update position: s = s₀ + v₀t + ½at²
-   newPvt.pos.add(totalAcceleration, currentPvt.v, deltaTime);
+   ShellDynamics dynamics(mass, radius);
+   syncStepper(dynamics);
    
-   // Update velocity: v = v₀ + at
-   newPvt.v.add(totalAcceleration, deltaTime);
+   stepper.advanceTo(simulationTime, dynamics);
+   BallisticState state = stepper.interpolate(simulationTime);
+   record(state, simulationTime);
    
-   // Add new state to flight path
-   flightPath.push_back(newPvt);
-   
-   // Check if projectile has hit the ground (simplified check)
-   if (newPvt.pos.getMetersY() < 0.0)
-   {
+   if (state.y < 0.0)
       isActive = false;
-   }
-}
-
-/*********************************************
- * PROJECTILE : CALCULATE DRAG ACCELERATION
- * Calculate drag acceleration based on current conditions
- *********************************************/
-Acceleration Projectile::calculateDragAcceleration(const PositionVelocityTime& pvt) const
-{
-   double altitude = max(0.0, pvt.pos.getMetersY());
-   double speed = pvt.v.getSpeed();
-   
-   // Handle zero speed case
-   if (speed == 0.0)
-      return Acceleration(0.0, 0.0);
-   
-   // Calculate atmospheric properties
-   double density = densityFromAltitude(altitude);
-   double speedSound = speedSoundFromAltitude(altitude);
-   double machNumber = speed / speedSound;
-   double dragCoeff = dragFromMach(machNumber);
-   
-   // Calculate drag force
-   double dragForce = forceFromDrag(density, dragCoeff, radius, speed);
-   
-   // Convert to acceleration magnitude
-   double dragAccelMagnitude = accelerationFromForce(dragForce, mass);
-   
-   // Apply drag opposite to velocity direction
-   double velX = pvt.v.getDX();
-   double velY = pvt.v.getDY();
-   
-   double dragAccelX = -dragAccelMagnitude * (velX / speed);
-   double dragAccelY = -dragAccelMagnitude * (velY / speed);
-   
-   return Acceleration(dragAccelX, dragAccelY);
 }
 
 /*********************************************
- * PROJECTILE : CALCULATE TOTAL ACCELERATION
- * Calculate total acceleration (gravity + drag)
+ * PROJECTILE : SYNC STEPPER
+ * Start the adaptive integrator over if the flight
+ * path moved on without it
  *********************************************/
-Acceleration Projectile::calculateTotalAcceleration(const PositionVelocityTime& pvt) const
+void Projectile::syncStepper(const ShellDynamics& dynamics)
 {
-   double altitude = max(0.0, pvt.pos.getMetersY());
-   
-   // Gravity acceleration (always downward)
-   double gravity = gravityFromAltitude(altitude);
-   Acceleration gravityAccel(0.0, -gravity);
-   
-   // Drag acceleration (opposite to velocity)
-   Acceleration dragAccel = calculateDragAcceleration(pvt);
+   const PositionVelocityTime& currentPvt = flightPath.back();
+   if (stepper.covers(currentPvt.t))
+      return;
    
-   // Combine accelerations
-   return gravityAccel + dragAccel;
+   BallisticState state = { currentPvt.pos.getMetersX(), currentPvt.pos.getMetersY(),
+                            currentPvt.v.getDX(),        currentPvt.v.getDY() };
+   stepper.start(state, currentPvt.t, dynamics);
 }
 
 /*********************************************
@@ -155,19 +104,6 @@ bool Projectile::isValidState() const
    return (mass > 0.0) && (radius > 0.0);
 }
 
-/*********************************************
- * PROJECTILE : DRAW
- * Draw the projectile and its trail
- *********************************************/
-void Projectile::draw(ogstream& gout, double flightTime) const
-{
-   if (!isActive || flightPath.empty())
-      return;
-   
-   // Draw current projectile position
-   gout.drawProjectile(flightPath.back().pos, flightTime);
-}
-
 /*********************************************
  * PROJECTILE : GET POSITION
  * Return the current position of the projectile
@@ -200,10 +136,10 @@ Velocity Projectile::getVelocity() const
  *********************************************/
 double Projectile::getFlightTime() const
 {
-   if (flightPath.size() < 2)
+   if (flightPath.empty())
       return 0.0;
    
-   return flightPath.back().t - flightPath.front().t;
+   return flightPath.back().t - flightPath.origin().t;
 }
 
 /*********************************************
@@ -212,14 +148,8 @@ double Projectile::getFlightTime() const
  *********************************************/
 double Projectile::getMaxAltitude() const
 {
-   double maxAlt = 0.0;
-   
-   for (const auto& pvt : flightPath)
-   {
-      maxAlt = max(maxAlt, pvt.pos.getMetersY());
-   }
-   
-   return maxAlt;
+   // the flight path keeps a running maximum as states are recorded
+   return flightPath.getMaxAltitude();
 }
 
 /*********************************************
@@ -228,10 +158,10 @@ double Projectile::getMaxAltitude() const
  *********************************************/
 double Projectile::getTotalDistance() const
 {
-   if (flightPath.size() < 2)
+   if (flightPath.empty())
       return 0.0;
    
-   double startX = flightPath.front().pos.getMetersX();
+   double startX = flightPath.origin().pos.getMetersX();
    double endX = flightPath.back().pos.getMetersX();
    
    return abs(endX - startX);
@@ -9,34 +9,76 @@
 
 #pragma once
 
-#include <list>
-#include <vector>
 #include "position.h"
 #include "velocity.h"
+#include "acceleration.h"
 #include "physics.h"
-#include "uiDraw.h"
+#include "integrator.h"
+#include "dormandPrince.h"
+#include "flightPath.h"
+#include "profiler.h"
 
 // Forward declarations
 class TestProjectile;
 class Angle;
+class ogstream;
 
 // Default M795 projectile specifications
 #define DEFAULT_PROJECTILE_WEIGHT 46.7       // kg
 #define DEFAULT_PROJECTILE_RADIUS 0.077545   // m (155mm caliber)
+#define MAX_FLIGHT_TIME 600.0                // s before we give up on a shell
 
 /**********************************************************************
- * PositionVelocityTime
- * Structure to keep track of one moment in the path of the projectile
+ * SHELL DYNAMICS
+ * The acceleration of a shell of a given mass and radius: gravity
+ * plus drag opposite the direction of travel. The integrators call
+ * this one or more times per step. The density scale stands in for a
+ * day that is denser or thinner than the standard atmosphere
  ************************************************************************/
-struct PositionVelocityTime
+struct ShellDynamics
 {
-   PositionVelocityTime() : pos(), v(), t(0.0) {}
-   PositionVelocityTime(const Position& p, const Velocity& vel, double time)
-      : pos(p), v(vel), t(time) {}
+   ShellDynamics(double mass, double radius, double densityScale = 1.0) :
+      mass(mass), radius(radius), densityScale(densityScale) {}
    
-   Position pos;
-   Velocity v;
-   double t;
+   Acceleration operator()(const BallisticState& s) const
+   {
+      // one lookup gives density, speed of sound and gravity
+      AtmosphereSample air = atmosphereAt(s.y);
+      double speed = sqrt(s.dx * s.dx + s.dy * s.dy);
+      
+      // gravity is always downward
+      if (speed == 0.0)
+         return Acceleration(0.0, -air.gravity);
+      
+      // drag is opposite the direction of travel
+      double dragCoeff = dragFromMach(speed / air.speedSound);
+      double dragForce = forceFromDrag(air.density * densityScale, dragCoeff, radius, speed);
+      double dragAccel = accelerationFromForce(dragForce, mass);
+      return Acceleration(-dragAccel * (s.dx / speed),
+                          -air.gravity - dragAccel * (s.dy / speed));
+   }
+   
+   double mass;     // weight of the shell in kg
+   double radius;   // radius of the shell in meters
+   double densityScale;   // multiplies the density of the air
+};
+
+/**********************************************************************
+ * SURFACE CLEARANCE
+ * How far a shell is above a surface: the event that marks impact.
+ * A surface is anything with getElevationMeters(Position), like Ground
+ ************************************************************************/
+template <class Surface>
+struct SurfaceClearance
+{
+   SurfaceClearance(const Surface& surface) : surface(surface) {}
+   
+   double operator()(const BallisticState& s) const
+   {
+      return s.y - surface.getElevationMeters(Position(s.x, s.y));
+   }
+   
+   const Surface& surface;
 };
 
 /**********************************************************************
@@ -63,16 +105,40 @@ public:
                                            radius(radius),
                                            isActive(false) {}
    
-   // Advance the projectile forward until the next unit of time
+   // Advance the projectile forward until the next unit of time.
+   // The integrator is chosen at compile time, see integrator.h
+   template <class Integrator = KinematicIntegrator>
    void advance(double simulationTime);
    
+   // Advance with the adaptive Dormand-Prince integrator. It takes as
+   // many or as few internal steps as the tolerance needs and reports
+   // the state at exactly simulationTime from its dense output
+   void advanceAdaptive(double simulationTime);
+   
+   // Advance as above, but stop at the moment the shell comes down on
+   // the surface. Returns true on impact, in which case the last state
+   // in the flight path is the impact point rather than simulationTime
+   template <class Integrator = KinematicIntegrator, class Surface>
+   bool advance(double simulationTime, const Surface& surface);
+   template <class Surface>
+   bool advanceAdaptive(double simulationTime, const Surface& surface);
+   
+   // How accurate advanceAdaptive() must be, see dormandPrince.h
+   void setTolerance(double absTolerance, double relTolerance)
+   {
+      stepper.setTolerance(absTolerance, relTolerance);
+   }
+   
+   // The adaptive integrator, for its step and evaluation counts
+   const DormandPrince& getStepper() const { return stepper; }
+   
    // Reset the projectile to its default state
    void reset();
    
    // Fire the projectile with the given parameters
    void fire(const Position& pos, const Angle& angle, double muzzleVelocity, double time);
    
-   // Draw the projectile and its trail
+   // Draw the projectile and its trail, see uiSimulation.cpp
    void draw(ogstream& gout, double flightTime) const;
    
    // Get current position of the projectile
@@ -82,7 +148,14 @@ public:
    Velocity getVelocity() const;
    
    // Get flight path for analysis
-   const std::list<PositionVelocityTime>& getFlightPath() const { return flightPath; }
+   const FlightPath& getFlightPath() const { return flightPath; }
+   
+   // Reserve room for a number of states. In ring mode only that many
+   // of the most recent states are kept
+   void setFlightPathCapacity(size_t capacity, bool keepLatestOnly = false)
+   {
+      flightPath.configure(capacity, keepLatestOnly);
+   }
    
    // Projectile state queries
    bool isFlying() const { return isActive && !flightPath.empty(); }
@@ -99,17 +172,158 @@ public:
    void setRadius(double newRadius) { radius = (newRadius > 0.0) ? newRadius : radius; }
    
 private:
-   // Calculate drag acceleration at current conditions
-   Acceleration calculateDragAcceleration(const PositionVelocityTime& pvt) const;
-   
-   // Calculate total acceleration (gravity + drag)
-   Acceleration calculateTotalAcceleration(const PositionVelocityTime& pvt) const;
-   
    // Validate projectile state
    bool isValidState() const;
    
+   // Make sure the adaptive integrator is at the end of the flight path
+   void syncStepper(const ShellDynamics& dynamics);
+   
+   // Append a state to the flight path
+   void record(const BallisticState& s, double t)
+   {
+      flightPath.push_back(PositionVelocityTime(Position(s.x, s.y),
+                                                Velocity(s.dx, s.dy), t));
+   }
+   
    double mass;           // Weight of the projectile in kg
    double radius;         // Radius of projectile in meters
    bool isActive;         // Whether projectile is currently flying
-   std::list<PositionVelocityTime> flightPath;  // Complete trajectory history
+   FlightPath flightPath;  // Trajectory history
+   DormandPrince stepper;  // State of the adaptive integrator
 };
+
+/*********************************************
+ * PROJECTILE : ADVANCE
+ * Update projectile position using realistic physics,
+ * stepping with the given integrator policy
+ *********************************************/
+template <class Integrator>
+void Projectile::advance(double simulationTime)
+{
+   PROFILE_ZONE("Projectile::advance");
+   // Check if projectile is active and has initial state
+   if (!isActive || flightPath.empty())
+      return;
+   
+   // Get current state
+   const PositionVelocityTime& currentPvt = flightPath.back();
+   double deltaTime = simulationTime - currentPvt.t;
+   
+   // Ensure positive time step
+   if (deltaTime <= 0.0)
+      return;
+   
+   // Step the state forward under gravity and drag
+   BallisticState state = { currentPvt.pos.getMetersX(), currentPvt.pos.getMetersY(),
+                            currentPvt.v.getDX(),        currentPvt.v.getDY() };
+   Integrator::step(state, deltaTime, ShellDynamics(mass, radius));
+   
+   // Add new state to flight path
+   flightPath.push_back(PositionVelocityTime(Position(state.x, state.y),
+                                             Velocity(state.dx, state.dy),
+                                             simulationTime));
+   
+   // Check if projectile has hit the ground (simplified check)
+   if (state.y < 0.0)
+      isActive = false;
+}
+
+/*********************************************
+ * PROJECTILE : ADVANCE TO SURFACE
+ * Take the step, and if it carried the shell from
+ * above the surface to on or below it, find the
+ * moment of impact on a cubic through the two ends
+ * of the step. No extra steps are taken
+ *********************************************/
+template <class Integrator, class Surface>
+bool Projectile::advance(double simulationTime, const Surface& surface)
+{
+   PROFILE_ZONE("Projectile::advance");
+   if (!isActive || flightPath.empty())
+      return false;
+   
+   const PositionVelocityTime& currentPvt = flightPath.back();
+   double startTime = currentPvt.t;
+   double deltaTime = simulationTime - startTime;
+   if (deltaTime <= 0.0)
+      return false;
+   
+   BallisticState start = { currentPvt.pos.getMetersX(), currentPvt.pos.getMetersY(),
+                            currentPvt.v.getDX(),        currentPvt.v.getDY() };
+   BallisticState end = start;
+   Integrator::step(end, deltaTime, ShellDynamics(mass, radius));
+   
+   SurfaceClearance<Surface> clearance(surface);
+   double g0 = clearance(start);
+   double g1 = clearance(end);
+   
+   // still in the air, or never left the ground
+   if (g1 > 0.0 || g0 <= 0.0)
+   {
+      record(end, simulationTime);
+      if (end.y < 0.0)
+         isActive = false;
+      return false;
+   }
+   
+   // came down during this step: find where
+   double tImpact = locateEvent(startTime, g0, simulationTime, g1,
+      [&](double t) { return hermite(start, end, deltaTime, (t - startTime) / deltaTime); },
+      clearance);
+   record(hermite(start, end, deltaTime, (tImpact - startTime) / deltaTime), tImpact);
+   isActive = false;
+   return true;
+}
+
+/*********************************************
+ * PROJECTILE : ADVANCE ADAPTIVE TO SURFACE
+ * Check each internal step of the adaptive
+ * integrator for a crossing and find the impact
+ * on its dense output
+ *********************************************/
+template <class Surface>
+bool Projectile::advanceAdaptive(double simulationTime, const Surface& surface)
+{
+   PROFILE_ZONE("Projectile::advanceAdaptive");
+   if (!isActive || flightPath.empty())
+      return false;
+   
+   const PositionVelocityTime& currentPvt = flightPath.back();
+   double t0 = currentPvt.t;
+   if (simulationTime <= t0)
+      return false;
+   
+   ShellDynamics dynamics(mass, radius);
+   syncStepper(dynamics);
+   
+   SurfaceClearance<Surface> clearance(surface);
+   double g0 = clearance(stepper.interpolate(t0));
+   
+   // walk the steps that cover [t0, simulationTime]
+   while (true)
+   {
+      double t1 = std::min(stepper.getTime(), simulationTime);
+      if (t1 > t0)
+      {
+         double g1 = clearance(stepper.interpolate(t1));
+         if (g0 > 0.0 && g1 <= 0.0)
+         {
+            double tImpact = stepper.locate(t0, g0, t1, g1, clearance);
+            record(stepper.interpolate(tImpact), tImpact);
+            isActive = false;
+            return true;
+         }
+         t0 = t1;
+         g0 = g1;
+      }
+      if (t1 >= simulationTime)
+         break;
+      stepper.step(dynamics);
+   }
+   
+   BallisticState state = stepper.interpolate(simulationTime);
+   record(state, simulationTime);
+   if (state.y < 0.0)
+      isActive = false;
+   return false;
+}
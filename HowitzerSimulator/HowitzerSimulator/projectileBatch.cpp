@@ -0,0 +1,81 @@
+/***********************************************************************
+ * Source File:
+ *    PROJECTILE BATCH
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Many projectiles flying at once, stored column by column so
+ *    that a whole salvo can be advanced in one pass
+ ************************************************************************/
+
+#include "projectileBatch.h"
+#include "angle.h"
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+/*********************************************
+ * PROJECTILE BATCH : RESERVE
+ * Make room for a number of shells up front
+ *********************************************/
+void ProjectileBatch::reserve(size_t capacity)
+{
+   x.reserve(capacity);
+   y.reserve(capacity);
+   dx.reserve(capacity);
+   dy.reserve(capacity);
+   mass.reserve(capacity);
+   radius.reserve(capacity);
+   t.reserve(capacity);
+   tLaunch.reserve(capacity);
+   active.reserve(capacity);
+}
+
+/*********************************************
+ * PROJECTILE BATCH : CLEAR
+ * Remove every shell but keep the memory
+ *********************************************/
+void ProjectileBatch::clear()
+{
+   x.clear();
+   y.clear();
+   dx.clear();
+   dy.clear();
+   mass.clear();
+   radius.clear();
+   t.clear();
+   tLaunch.clear();
+   active.clear();
+   time = 0.0;
+   numActive = 0;
+}
+
+/*********************************************
+ * PROJECTILE BATCH : FIRE
+ * Launch one more shell at the current batch time
+ *********************************************/
+size_t ProjectileBatch::fire(const Position& pos, const Angle& angle,
+                             double muzzleVelocity, double mass, double radius)
+{
+   assert(muzzleVelocity >= 0.0);
+   assert(mass > 0.0);
+   assert(radius > 0.0);
+
+   Velocity v;
+   v.set(angle, muzzleVelocity);
+
+   x.push_back(pos.getMetersX());
+   y.push_back(pos.getMetersY());
+   dx.push_back(v.getDX());
+   dy.push_back(v.getDY());
+   this->mass.push_back(mass);
+   this->radius.push_back(radius);
+   t.push_back(time);
+   tLaunch.push_back(time);
+   active.push_back(1);
+   numActive++;
+
+   return x.size() - 1;
+}
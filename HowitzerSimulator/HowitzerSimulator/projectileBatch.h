@@ -0,0 +1,142 @@
+/**********************************************************************
+ * Header File:
+ *    PROJECTILE BATCH
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Many projectiles flying at once, stored column by column so
+ *    that a whole salvo can be advanced in one pass
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cassert>
+#include "position.h"
+#include "velocity.h"
+#include "projectile.h"
+#include "integrator.h"
+
+// Forward declarations
+class TestProjectileBatch;
+class Angle;
+
+/**********************************************************************
+ * ProjectileBatch
+ * A structure-of-arrays collection of shells. Each state variable
+ * (x, y, dx, dy, mass, radius) lives in its own contiguous column so
+ * that advancing N shells is one tight loop over N doubles at a time
+ * rather than N separate Projectile objects.
+ ************************************************************************/
+class ProjectileBatch
+{
+public:
+   // Friend the unit test class
+   friend ::TestProjectileBatch;
+
+   // Create an empty batch
+   ProjectileBatch() : time(0.0), numActive(0) {}
+
+   // Create an empty batch with room for a number of shells
+   ProjectileBatch(size_t capacity) : time(0.0), numActive(0)
+   {
+      reserve(capacity);
+   }
+
+   // Make room for a number of shells without reallocating
+   void reserve(size_t capacity);
+
+   // Remove every shell from the batch
+   void clear();
+
+   // Fire one more shell. Returns the index of the new shell
+   size_t fire(const Position& pos, const Angle& angle, double muzzleVelocity,
+               double mass   = DEFAULT_PROJECTILE_WEIGHT,
+               double radius = DEFAULT_PROJECTILE_RADIUS);
+
+   // Advance every shell still in flight by one time step.
+   // The integrator is chosen at compile time, see integrator.h
+   template <class Integrator = KinematicIntegrator>
+   void advance(double timeStep);
+
+   // Batch queries
+   size_t size() const { return x.size(); }
+   size_t getNumActive() const { return numActive; }
+   bool isEmpty() const { return x.empty(); }
+   bool isFlying() const { return numActive > 0; }
+   double getSimulationTime() const { return time; }
+
+   // Individual shell queries
+   bool isFlying(size_t i) const { return active[i] != 0; }
+   Position getPosition(size_t i) const { return Position(x[i], y[i]); }
+   Velocity getVelocity(size_t i) const { return Velocity(dx[i], dy[i]); }
+   double getFlightTime(size_t i) const { return t[i] - tLaunch[i]; }
+   double getMass(size_t i) const { return mass[i]; }
+   double getRadius(size_t i) const { return radius[i]; }
+
+private:
+   // Per-shell state, one column per variable
+   std::vector<double> x;         // horizontal position in meters
+   std::vector<double> y;         // vertical position in meters
+   std::vector<double> dx;        // horizontal velocity in m/s
+   std::vector<double> dy;        // vertical velocity in m/s
+   std::vector<double> mass;      // weight of each shell in kg
+   std::vector<double> radius;    // radius of each shell in meters
+   std::vector<double> t;         // time of the most recent state
+   std::vector<double> tLaunch;   // time the shell was fired
+   std::vector<unsigned char> active;  // whether the shell is still flying
+
+   double time;                   // simulation time of the batch
+   size_t numActive;              // number of shells still flying
+};
+
+/*********************************************
+ * PROJECTILE BATCH : ADVANCE
+ * Step every live shell forward with the same
+ * physics as Projectile::advance, using the given
+ * integrator policy
+ *********************************************/
+template <class Integrator>
+void ProjectileBatch::advance(double timeStep)
+{
+   assert(timeStep > 0.0);
+
+   time += timeStep;
+   if (numActive == 0)
+      return;
+
+   const size_t num = x.size();
+
+   // raw column pointers keep the loop free of bounds bookkeeping
+   double* px = x.data();
+   double* py = y.data();
+   double* pdx = dx.data();
+   double* pdy = dy.data();
+   double* pt = t.data();
+   const double* pMass = mass.data();
+   const double* pRadius = radius.data();
+   unsigned char* pActive = active.data();
+
+   for (size_t i = 0; i < num; i++)
+   {
+      if (!pActive[i])
+         continue;
+
+      BallisticState state = { px[i], py[i], pdx[i], pdy[i] };
+      Integrator::step(state, timeStep, ShellDynamics(pMass[i], pRadius[i]));
+
+      px[i] = state.x;
+      py[i] = state.y;
+      pdx[i] = state.dx;
+      pdy[i] = state.dy;
+      pt[i] = time;
+
+      // the shell stops once it falls below the ground
+      if (state.y < 0.0)
+      {
+         pActive[i] = 0;
+         numActive--;
+      }
+   }
+}
@@ -0,0 +1,125 @@
+/***********************************************************************
+ * Source File:
+ *    RANDOM
+ * Author:
+ *    Br. Helfrich and Gary Sibanda
+ * Summary:
+ *    Random numbers for the terrain, the howitzer and Monte Carlo
+ *    runs. Every generator is an object with its own state, so there
+ *    is no global lock and any run can be repeated from its seed
+ ************************************************************************/
+
+#include "random.h"
+#include <random>     // for random_device
+#include <cassert>
+
+/******************************************************************
+ * XOSHIRO 256 : JUMP
+ * The jump polynomial from the reference implementation
+ ****************************************************************/
+void Xoshiro256::jump()
+{
+   static const uint64_t JUMP[] = { 0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+                                    0xa9582618e03fc9aaull, 0x39abdc4529b1661cull };
+   uint64_t t[4] = { 0, 0, 0, 0 };
+   for (uint64_t word : JUMP)
+      for (int b = 0; b < 64; b++)
+      {
+         if (word & (1ull << b))
+            for (int i = 0; i < 4; i++)
+               t[i] ^= s[i];
+         next();
+      }
+   for (int i = 0; i < 4; i++)
+      s[i] = t[i];
+}
+
+/******************************************************************
+ * PHILOX : BLOCK
+ * Ten rounds of multiply, swap and xor. The counter
+ * is the low two words and the stream the high two
+ ****************************************************************/
+void Philox::block(uint64_t counter, uint32_t out[4]) const
+{
+   const uint32_t M0 = 0xD2511F53;
+   const uint32_t M1 = 0xCD9E8D57;
+   const uint32_t W0 = 0x9E3779B9;   // golden ratio
+   const uint32_t W1 = 0xBB67AE85;   // sqrt(3) - 1
+
+   uint32_t c[4] = { (uint32_t)counter, (uint32_t)(counter >> 32),
+                     (uint32_t)stream,  (uint32_t)(stream >> 32) };
+   uint32_t k[2] = { (uint32_t)key, (uint32_t)(key >> 32) };
+
+   for (int round = 0; round < 10; round++)
+   {
+      uint64_t p0 = (uint64_t)M0 * c[0];
+      uint64_t p1 = (uint64_t)M1 * c[2];
+      uint32_t next[4] = { (uint32_t)(p1 >> 32) ^ c[1] ^ k[0], (uint32_t)p1,
+                           (uint32_t)(p0 >> 32) ^ c[3] ^ k[1], (uint32_t)p0 };
+      for (int i = 0; i < 4; i++)
+         c[i] = next[i];
+      k[0] += W0;
+      k[1] += W1;
+   }
+
+   for (int i = 0; i < 4; i++)
+      out[i] = c[i];
+}
+
+/******************************************************************
+ * RANDOM SEED
+ ****************************************************************/
+uint64_t randomSeed()
+{
+   std::random_device device;
+   return ((uint64_t)device() << 32) ^ (uint64_t)device();
+}
+
+/******************************************************************
+ * THREAD GENERATOR
+ * The generator behind random(). One per thread,
+ * so threads never wait on each other
+ ****************************************************************/
+static Xoshiro256& threadGenerator()
+{
+   thread_local Xoshiro256 generator(randomSeed());
+   return generator;
+}
+
+void seedRandom(uint64_t seed)
+{
+   threadGenerator().seed(seed);
+}
+
+/******************************************************************
+ * RANDOM
+ * This function generates a random number.
+ *
+ *    INPUT:   min, max : The number of values (min <= num < max)
+ *    OUTPUT   <return> : Return the integer
+ ****************************************************************/
+int random(int min, int max)
+{
+   assert(min < max);
+   int num = uniform(threadGenerator(), min, max);
+   assert(min <= num && num <= max);
+
+   return num;
+}
+
+/******************************************************************
+ * RANDOM
+ * This function generates a random number.
+ *
+ *    INPUT:   min, max : The number of values (min <= num <= max)
+ *    OUTPUT   <return> : Return the double
+ ****************************************************************/
+double random(double min, double max)
+{
+   assert(min <= max);
+   double num = uniform(threadGenerator(), min, max);
+
+   assert(min <= num && num <= max);
+
+   return num;
+}
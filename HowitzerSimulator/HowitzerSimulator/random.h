@@ -0,0 +1,227 @@
+/***********************************************************************
+ * Header File:
+ *    RANDOM
+ * Author:
+ *    Br. Helfrich and Gary Sibanda
+ * Summary:
+ *    Random numbers for the terrain, the howitzer and Monte Carlo
+ *    runs. Every generator is an object with its own state, so there
+ *    is no global lock and any run can be repeated from its seed
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <cassert>
+
+// Forward declaration for the unit tests
+class TestRandom;
+
+/******************************************************************
+ * SPLIT MIX
+ * One step of splitmix64: scrambles a 64-bit value so that nearby
+ * seeds give unrelated states
+ ****************************************************************/
+inline uint64_t splitMix(uint64_t& state)
+{
+   uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+   z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+   z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+   return z ^ (z >> 31);
+}
+
+/******************************************************************
+ * XOSHIRO 256
+ * xoshiro256** by Blackman and Vigna: 256 bits of state, a period
+ * of 2^256 - 1, and a handful of shifts and adds per number. The
+ * generator to use when one thread needs a lot of numbers
+ ****************************************************************/
+class Xoshiro256
+{
+public:
+   friend ::TestRandom;
+
+   Xoshiro256(uint64_t seed = 0) { this->seed(seed); }
+
+   // Start over from a seed, spread over the state by splitmix64
+   void seed(uint64_t seed)
+   {
+      for (int i = 0; i < 4; i++)
+         s[i] = splitMix(seed);
+   }
+
+   uint64_t next()
+   {
+      uint64_t result = rotate(s[1] * 5, 7) * 9;
+      uint64_t t = s[1] << 17;
+      s[2] ^= s[0];
+      s[3] ^= s[1];
+      s[1] ^= s[2];
+      s[0] ^= s[3];
+      s[2] ^= t;
+      s[3] = rotate(s[3], 45);
+      return result;
+   }
+
+   // Skip ahead 2^128 numbers. Calling this k times on copies of one
+   // generator gives k streams that will never overlap
+   void jump();
+
+private:
+   static uint64_t rotate(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+   uint64_t s[4];
+};
+
+/******************************************************************
+ * PHILOX
+ * Philox4x32-10 by Salmon et al. A counter-based generator: the
+ * numbers are a pure function of (key, stream, counter), so the
+ * n-th number of any stream can be had without the ones before it.
+ * Give each shot, round or thread its own stream and the results
+ * do not depend on who computed what in which order
+ ****************************************************************/
+class Philox
+{
+public:
+   friend ::TestRandom;
+
+   Philox(uint64_t key = 0, uint64_t stream = 0) :
+      key(key), stream(stream), counter(0), iBuffer(2) {}
+
+   // The four 32-bit words for one counter value
+   void block(uint64_t counter, uint32_t out[4]) const;
+
+   // 64 bits for one counter value, without touching the position
+   uint64_t at(uint64_t counter) const
+   {
+      uint32_t words[4];
+      block(counter, words);
+      return ((uint64_t)words[1] << 32) | words[0];
+   }
+
+   // The next 64 bits of the stream; each block gives two
+   uint64_t next()
+   {
+      if (iBuffer == 2)
+      {
+         uint32_t words[4];
+         block(counter++, words);
+         buffer[0] = ((uint64_t)words[1] << 32) | words[0];
+         buffer[1] = ((uint64_t)words[3] << 32) | words[2];
+         iBuffer = 0;
+      }
+      return buffer[iBuffer++];
+   }
+
+   // Move to a block of the stream
+   void seek(uint64_t counter)
+   {
+      this->counter = counter;
+      iBuffer = 2;
+   }
+
+private:
+   uint64_t key;        // the seed
+   uint64_t stream;     // which of 2^64 independent streams
+   uint64_t counter;    // the next block to generate
+   uint64_t buffer[2];  // the unused half of the last block
+   int iBuffer;         // next entry of buffer to hand out, 2 if empty
+};
+
+/******************************************************************
+ * DISTRIBUTIONS
+ * Work with any generator that has a next() returning 64 bits
+ ****************************************************************/
+
+// [0, 1) with 53 random bits
+template <class Generator>
+inline double uniform(Generator& g)
+{
+   return (double)(g.next() >> 11) * 0x1.0p-53;
+}
+
+// [min, max)
+template <class Generator>
+inline double uniform(Generator& g, double min, double max)
+{
+   assert(min <= max);
+   return min + uniform(g) * (max - min);
+}
+
+// min <= num < max, as the old rand() % (max - min) + min
+template <class Generator>
+inline int uniform(Generator& g, int min, int max)
+{
+   assert(min < max);
+   uint64_t range = (uint64_t)((int64_t)max - min);
+   return min + (int)(((g.next() >> 32) * range) >> 32);
+}
+
+// Two independent standard normals by Box-Muller
+template <class Generator>
+inline void normals(Generator& g, double& a, double& b)
+{
+   double r = sqrt(-2.0 * log(1.0 - uniform(g)));   // 1 - u is never 0
+   double theta = 2.0 * M_PI * uniform(g);
+   a = r * cos(theta);
+   b = r * sin(theta);
+}
+
+// One normal with a mean and standard deviation
+template <class Generator>
+inline double normal(Generator& g, double mean = 0.0, double sigma = 1.0)
+{
+   double a;
+   double b;
+   normals(g, a, b);
+   return mean + sigma * a;
+}
+
+// Fill an array with uniforms in [min, max)
+template <class Generator>
+void fillUniform(Generator& g, double* out, size_t count,
+                 double min = 0.0, double max = 1.0)
+{
+   double scale = (max - min) * 0x1.0p-53;
+   for (size_t i = 0; i < count; i++)
+      out[i] = min + (double)(g.next() >> 11) * scale;
+}
+
+// Fill an array with normals, using both halves of every Box-Muller pair
+template <class Generator>
+void fillNormal(Generator& g, double* out, size_t count,
+                double mean = 0.0, double sigma = 1.0)
+{
+   size_t i = 0;
+   for (; i + 1 < count; i += 2)
+   {
+      normals(g, out[i], out[i + 1]);
+      out[i] = mean + sigma * out[i];
+      out[i + 1] = mean + sigma * out[i + 1];
+   }
+   if (i < count)
+      out[i] = normal(g, mean, sigma);
+}
+
+/******************************************************************
+ * RANDOM SEED
+ * A fresh seed from the operating system, for when the caller does
+ * not care to repeat the run
+ ****************************************************************/
+uint64_t randomSeed();
+
+/******************************************************************
+ * RANDOM
+ * This function generates a random number.  The user specifies
+ * The parameters
+ *    INPUT:   min, max : The number of values (min <= num <= max)
+ *    OUTPUT   <return> : Return the integer/double
+ * Each thread draws from its own Xoshiro256, seeded by randomSeed()
+ * unless seedRandom() says otherwise
+ ****************************************************************/
+int    random(int    min, int    max);
+double random(double min, double max);
+void   seedRandom(uint64_t seed);
@@ -0,0 +1,138 @@
+/***********************************************************************
+ * Source File:
+ *    RANGE CURVE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    How far a shell travels at each angle, flown once and then
+ *    looked up, so aiming does not integrate a trajectory
+ ************************************************************************/
+
+#include "rangeCurve.h"
+#include "firingTable.h"
+#include <cmath>
+#include <cassert>
+
+using namespace std;
+
+/*********************************************
+ * RANGE CURVE : BUILD
+ * One trajectory per sample. A shell that never
+ * gets as high as the target is marked unreachable
+ *********************************************/
+void RangeCurve::build(double muzzleVelocity, double targetElevation,
+                       double minAngle, double maxAngle)
+{
+   assert(maxAngle >= minAngle);
+   if (isBuiltFor(muzzleVelocity, targetElevation) &&
+       this->minAngle == minAngle && this->maxAngle == maxAngle)
+      return;
+
+   this->muzzleVelocity = muzzleVelocity;
+   this->targetElevation = targetElevation;
+   this->minAngle = minAngle;
+   this->maxAngle = maxAngle;
+
+   size_t num = (size_t)floor((maxAngle - minAngle) / RANGE_CURVE_STEP + 1e-9) + 1;
+   ranges.assign(num, -1.0);
+   iPeak = 0;
+   for (size_t i = 0; i < num; i++)
+   {
+      FiringSolution s = FiringTable::fire(angleOf(i), muzzleVelocity, targetElevation);
+      if (s.timeOfFlight > 0.0)
+         ranges[i] = s.range;
+      if (ranges[i] > ranges[iPeak])
+         iPeak = i;
+   }
+}
+
+/*********************************************
+ * RANGE CURVE : GET RANGE
+ * Straight-line interpolation between samples
+ *********************************************/
+double RangeCurve::getRange(double angle) const
+{
+   if (ranges.empty() || angle < minAngle || angle > maxAngle)
+      return -1.0;
+
+   double index = (angle - minAngle) / RANGE_CURVE_STEP;
+   size_t i = (size_t)index;
+   if (i + 1 >= ranges.size())
+      return ranges.back();
+
+   // no interpolating across the edge of what can be reached
+   if (ranges[i] < 0.0 || ranges[i + 1] < 0.0)
+      return (index - (double)i < 0.5) ? ranges[i] : ranges[i + 1];
+
+   return ranges[i] + (index - (double)i) * (ranges[i + 1] - ranges[i]);
+}
+
+/*********************************************
+ * RANGE CURVE : INTERPOLATE ANGLE
+ *********************************************/
+double RangeCurve::interpolateAngle(size_t i, double range) const
+{
+   double delta = ranges[i + 1] - ranges[i];
+   double fraction = (delta == 0.0) ? 0.0 : (range - ranges[i]) / delta;
+   return angleOf(i) + fraction * RANGE_CURVE_STEP;
+}
+
+/*********************************************
+ * RANGE CURVE : GET ANGLES
+ * Binary search each side of the peak, where the
+ * curve only rises (steep side) or only falls
+ * (flat side)
+ *********************************************/
+int RangeCurve::getAngles(double range, double& low, double& high) const
+{
+   if (ranges.empty() || range < 0.0 || range > ranges[iPeak])
+      return 0;
+
+   // steep side: first reachable sample up to the peak, range rising
+   size_t first = 0;
+   while (first < iPeak && ranges[first] < 0.0)
+      first++;
+   bool isSteep = range >= ranges[first];
+   if (isSteep)
+   {
+      size_t lo = first;
+      size_t hi = iPeak;
+      while (hi - lo > 1)
+      {
+         size_t mid = (lo + hi) / 2;
+         if (ranges[mid] <= range)
+            lo = mid;
+         else
+            hi = mid;
+      }
+      high = (lo == iPeak) ? angleOf(iPeak) : interpolateAngle(lo, range);
+   }
+
+   // flat side: the peak up to the last reachable sample, range falling
+   size_t last = ranges.size() - 1;
+   while (last > iPeak && ranges[last] < 0.0)
+      last--;
+   bool isFlat = last > iPeak && range >= ranges[last];
+   if (isFlat)
+   {
+      size_t lo = iPeak;
+      size_t hi = last;
+      while (hi - lo > 1)
+      {
+         size_t mid = (lo + hi) / 2;
+         if (ranges[mid] >= range)
+            lo = mid;
+         else
+            hi = mid;
+      }
+      low = interpolateAngle(lo, range);
+   }
+
+   // only one way there: report it as both
+   if (isSteep && !isFlat)
+      low = high;
+   if (isFlat && !isSteep)
+      high = low;
+
+   return (isSteep ? 1 : 0) + (isFlat ? 1 : 0);
+}
@@ -0,0 +1,76 @@
+/***********************************************************************
+ * Header File:
+ *    RANGE CURVE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    How far a shell travels at each angle, flown once and then
+ *    looked up, so aiming does not integrate a trajectory
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+// Forward declaration for the unit tests
+class TestRangeCurve;
+
+#define RANGE_CURVE_STEP 0.25   // degrees between samples of the curve
+
+/*********************************************
+ * RANGE CURVE
+ * Range against angle for one muzzle velocity and
+ * one target elevation. Angles are degrees from
+ * vertical, as in Howitzer. Range rises from zero
+ * straight up to a single peak and falls again, so
+ * any range short of the peak is reached twice: a
+ * steep high-angle path before the peak and a flat
+ * low-angle path after it
+ *********************************************/
+class RangeCurve
+{
+public:
+   friend ::TestRangeCurve;
+
+   RangeCurve() : muzzleVelocity(-1.0), targetElevation(0.0),
+                  minAngle(0.0), maxAngle(0.0), iPeak(0) {}
+
+   // Fly the curve unless it is already built for these values
+   void build(double muzzleVelocity, double targetElevation,
+              double minAngle, double maxAngle);
+
+   // Is the curve built for this velocity and target elevation?
+   bool isBuiltFor(double muzzleVelocity, double targetElevation) const
+   {
+      return !ranges.empty() &&
+             this->muzzleVelocity == muzzleVelocity &&
+             this->targetElevation == targetElevation;
+   }
+
+   // Range at an angle, or a negative number if a shell fired at that
+   // angle never comes down at the target elevation
+   double getRange(double angle) const;
+
+   // The angles that reach a range. Returns how many there are (0, 1
+   // or 2); low is the flatter path and high the steeper one. When
+   // there is only one, both are set to it
+   int getAngles(double range, double& low, double& high) const;
+
+   // The farthest the shell can go and the angle that gets it there
+   double getMaxRange() const { return ranges.empty() ? 0.0 : ranges[iPeak]; }
+   double getMaxRangeAngle() const { return angleOf(iPeak); }
+
+private:
+   double angleOf(size_t i) const { return minAngle + RANGE_CURVE_STEP * (double)i; }
+
+   // Angle where the curve crosses a range between samples i and i+1
+   double interpolateAngle(size_t i, double range) const;
+
+   double muzzleVelocity;        // m/s the curve was flown at
+   double targetElevation;       // meters above the gun
+   double minAngle;              // angle of the first sample
+   double maxAngle;              // angle of the last sample
+   size_t iPeak;                 // sample with the greatest range
+   std::vector<double> ranges;   // range at each sample, negative if unreachable
+};
@@ -8,134 +8,194 @@
  ************************************************************************/
 
 #include "simulation.h"
+#include "profiler.h"
 #include <iomanip>
 #include <cmath>
 #include <cassert>
+#include <algorithm>
+
+using namespace std::chrono;
 
 /*********************************************
  * SIMULATOR : CONSTRUCTOR
  * Initialize the simulation with given screen bounds
  *********************************************/
-Simulator::Simulator(const Position& posUpperRight)
-   : ground(posUpperRight), howitzer(), posUpperRight(posUpperRight),
-     time(0.0), isFiring(false), isHit(false),
-     score(0), shotsAttempted(0)
+Simulator::Simulator(const Viewport& viewport, uint64_t seed)
+   : ground(viewport), howitzer(), posUpperRight(viewport.getUpperRight()),
+     timeTrail(0.0), timePublished(steady_clock::now()), isShowingPerformance(false),
+     dispersion(), dispersionElevation(0.0), dispersionRound(0), isShowingDispersion(false),
+     time(0.0), isFiring(false), isHit(false), timeWarp(1.0),
+     score(0), shotsAttempted(0), seed(seed), round(0)
 {
    // Set horizontal position of the howitzer to center
    Position howitzerPos;
-   howitzerPos.setPixelsX(posUpperRight.getPixelsX() / 2.0);
+   howitzerPos.setMetersX(posUpperRight.getMetersX() / 2.0);
    
    // Generate ground and set howitzer vertical position
-   ground.reset(howitzerPos);
+   ground.reset(howitzerPos, nextRoundSeed());
    howitzer.setPosition(howitzerPos);
    
    // Initialize projectile trail
    clearProjectileTrail();
+   
+   // Give draw() something to show
+   capture(snapshotPublished);
+   publish();
 }
 
 /*********************************************
  * SIMULATOR : UPDATE
- * Update the simulation state for one time step
+ * Update the simulation state for one time step.
+ * With time warp the shell flies timeWarp steps
+ * of timeStep each, so the physics is the same at
+ * any speed, and stops at the step it lands in
  *********************************************/
 void Simulator::update(double timeStep)
 {
+   PROFILE_ZONE("Simulator::update");
    assert(timeStep > 0.0);
+   std::lock_guard<std::mutex> lock(mutex);
+   
+   if (!isFiring)
+      return;
    
-   if (isFiring)
+   double timeEnd = time + timeStep * timeWarp;   // infinite when fastest
+   while (time < timeEnd)
    {
-      time += timeStep;
-      projectile.advance(time);
+      time = std::min(time + timeStep, timeEnd);
+      
+      // Stops at the exact impact point if the shell lands this step
+      bool isImpact = projectile.advanceAdaptive(time, ground);
       
       // Update projectile trail
       updateProjectileTrail();
       
       // Check for ground collision
-      if (checkGroundCollision())
+      if (isImpact || checkGroundCollision() || time >= MAX_FLIGHT_TIME)
       {
-         isFiring = false;
-         
-         // Check if target was hit
-         if (checkTargetHit())
-         {
-            isHit = true;
-            score++;
-            // Generate new terrain for next round
-            Position newHowitzerPos = howitzer.getPosition();
-            ground.reset(newHowitzerPos);
-            howitzer.setPosition(newHowitzerPos);
-         }
-         else
-         {
-            isHit = false;
-         }
-         
-         // Reset projectile for next shot
-         projectile.reset();
-         clearProjectileTrail();
+         land();
+         return;
       }
    }
 }
 
 /*********************************************
- * SIMULATOR : HANDLE INPUT
- * Process user input for controlling the simulation
+ * SIMULATOR : LAND
  *********************************************/
-void Simulator::handleInput(const Interface* pUI)
+void Simulator::land()
 {
-   assert(pUI != nullptr);
+   isFiring = false;
    
-   // Process movement input
-   processMovementInput(pUI);
+   // Check if target was hit
+   if (checkTargetHit())
+   {
+      isHit = true;
+      score++;
+      // Generate new terrain for next round
+      Position newHowitzerPos = howitzer.getPosition();
+      ground.reset(newHowitzerPos, nextRoundSeed());
+      howitzer.setPosition(newHowitzerPos);
+   }
+   else
+   {
+      isHit = false;
+   }
    
-   // Process firing input
-   processFireInput(pUI);
+   // Reset projectile for next shot
+   projectile.reset();
+   clearProjectileTrail();
 }
 
 /*********************************************
- * SIMULATOR : PROCESS MOVEMENT INPUT
- * Handle howitzer movement controls with angle limits (0° to 90°)
+ * SIMULATOR : SET TIME WARP
  *********************************************/
-void Simulator::processMovementInput(const Interface* pUI)
+void Simulator::setTimeWarp(double timeWarp)
 {
-   // Get current angle in degrees for limit checking
-   double currentAngle = howitzer.getElevation().getDegrees();
+   assert(timeWarp >= 1.0);
+   std::lock_guard<std::mutex> lock(mutex);
+   this->timeWarp = timeWarp;
+}
+
+/*********************************************
+ * SIMULATOR : NEXT TIME WARP
+ *********************************************/
+double Simulator::nextTimeWarp(double timeWarp)
+{
+   if (timeWarp < 10.0)
+      return 10.0;
+   if (timeWarp < 100.0)
+      return 100.0;
+   if (timeWarp < WARP_FASTEST)
+      return WARP_FASTEST;
+   return 1.0;
+}
+
+/*********************************************
+ * SIMULATOR : FIRE
+ * Launch a shell from the howitzer unless one
+ * is already in flight
+ *********************************************/
+void Simulator::fire()
+{
+   std::lock_guard<std::mutex> lock(mutex);
+   launch();
+}
+
+/*********************************************
+ * SIMULATOR : LAUNCH
+ *********************************************/
+void Simulator::launch()
+{
+   if (isFiring || !howitzer.canFire())
+      return;
    
-   // Rotation controls with limits (0° to 90° range only)
-   if (pUI->isRight() && currentAngle < MAX_ELEVATION_ANGLE)
-      howitzer.rotate(0.05);
-   if (pUI->isLeft() && currentAngle > 0.0)  // Changed from MIN_ELEVATION_ANGLE to 0.0
-      howitzer.rotate(-0.05);
+   time = 0.0;
+   shotsAttempted++;
    
-   // Elevation controls (kept for backward compatibility but with limits)
-   if (pUI->isUp() && currentAngle < MAX_ELEVATION_ANGLE)
-      howitzer.raise(0.003);
-   if (pUI->isDown() && currentAngle > 0.0)  // Changed from MIN_ELEVATION_ANGLE to 0.0
-      howitzer.raise(-0.003);
+   // Fire projectile from howitzer position
+   projectile.fire(howitzer.getPosition(),
+                  howitzer.getElevation(),
+                  howitzer.getMuzzleVelocity(),
+                  time);
+   
+   // Record firing
+   howitzer.recordFiring(time);
+   isFiring = true;
+   isHit = false;
 }
 
 /*********************************************
- * SIMULATOR : PROCESS FIRE INPUT
- * Handle firing controls
+ * SIMULATOR : RUN DISPERSION
+ * Take the aim under the lock, then fly the
+ * rounds without it so the physics carries on.
+ * The rounds draw from a stream of their own,
+ * so the same aim on the same round of the same
+ * game always gives the same spread
  *********************************************/
-void Simulator::processFireInput(const Interface* pUI)
+void Simulator::runDispersion()
 {
-   // Fire projectile when space is pressed and not currently firing
-   if (pUI->isSpace() && !isFiring && howitzer.canFire())
+   PROFILE_ZONE("Simulator::runDispersion");
+   double angle;
+   double muzzleVelocity;
+   double targetRange;
+   double targetElevation;
    {
-      time = 0.0;
-      shotsAttempted++;
-      
-      // Fire projectile from howitzer position
-      projectile.fire(howitzer.getPosition(),
-                     howitzer.getElevation(),
-                     howitzer.getMuzzleVelocity(),
-                     time);
-      
-      // Record firing
-      howitzer.recordFiring(time);
-      isFiring = true;
-      isHit = false;
+      std::lock_guard<std::mutex> lock(mutex);
+      Position posHowitzer = howitzer.getPosition();
+      Position posTarget = ground.getTarget();
+      angle = howitzer.getElevation().getDegrees();
+      muzzleVelocity = howitzer.getMuzzleVelocity();
+      targetRange = posTarget.getMetersX() - posHowitzer.getMetersX();
+      targetElevation = posTarget.getMetersY() - posHowitzer.getMetersY();
+      dispersionElevation = howitzer.getElevation().getRadians();
+      dispersionRound = round;
    }
+   
+   if (!pool)
+      pool.reset(new ThreadPool());
+   Dispersion run(angle, muzzleVelocity, targetRange, targetElevation);
+   dispersion = run.run(DISPERSION_SHOTS, Philox(seed, 1).at(dispersionRound), *pool);
+   isShowingDispersion = true;
 }
 
 /*********************************************
@@ -165,10 +225,20 @@ bool Simulator::checkTargetHit()
 
 /*********************************************
  * SIMULATOR : UPDATE PROJECTILE TRAIL
- * Update the visual trail behind the projectile
+ * Update the visual trail behind the projectile.
+ * One point every TRAIL_INTERVAL, so the trail is
+ * the same length whatever the time step. Time
+ * warp spreads the points out by the same factor,
+ * so the trail covers the same stretch of screen
+ * time and costs the same to draw at any speed
  *********************************************/
 void Simulator::updateProjectileTrail()
 {
+   double interval = TRAIL_INTERVAL * (std::isinf(timeWarp) ? 1.0 : timeWarp);
+   if (time < timeTrail + interval - 1e-9)
+      return;
+   timeTrail = time;
+   
    // Shift old positions down the array
    for (int i = TRAIL_LENGTH - 1; i > 0; i--)
    {
@@ -189,6 +259,7 @@ void Simulator::clearProjectileTrail()
    {
       projectilePath[i] = Position();
    }
+   timeTrail = -std::numeric_limits<double>::infinity();   // the next step leaves a point
 }
 
 /*********************************************
@@ -203,97 +274,19 @@ double Simulator::calculateDistance(const Position& pos1, const Position& pos2)
 }
 
 /*********************************************
- * SIMULATOR : DRAW
- * Render the entire simulation
- *********************************************/
-void Simulator::draw(ogstream& gout) const
-{
-   // Draw ground and target
-   ground.draw(gout);
-   
-   // Draw howitzer
-   howitzer.draw(gout, time);
-   
-   // Draw projectile trail
-   for (int i = 0; i < TRAIL_LENGTH; ++i)
-   {
-      if (projectilePath[i].getMetersX() != 0.0 || projectilePath[i].getMetersY() != 0.0)
-      {
-         gout.drawProjectile(projectilePath[i], i * 0.5);
-      }
-   }
-   
-   // Display game information
-   displayGameStats(gout);
-   displayHitStatus(gout);
-}
-
-/*********************************************
- * SIMULATOR : DISPLAY GAME STATS
- * Display current game statistics with ANGLE instead of ELEVATION
- *********************************************/
-void Simulator::displayGameStats(ogstream& gout) const
-{
-   // Set up formatting
-   gout.setf(std::ios::fixed | std::ios::showpoint);
-   gout.precision(1);
-   
-   // Display flight time
-   gout << std::setw(85) << std::setfill(' ') << ""
-        << "Flight time: " << time << "s\n";
-   
-   // Display howitzer angle (CHANGED FROM "Elevation" TO "Angle")
-   gout << std::setw(95) << std::setfill(' ') << ""
-        << "Angle: " << howitzer.getElevation().getDegrees() << "°\n";
-   
-   // Display score and accuracy
-   gout << std::setw(85) << std::setfill(' ') << ""
-        << "Score: " << score << "/" << shotsAttempted;
-   
-   if (shotsAttempted > 0)
-   {
-      gout << " (" << std::setprecision(0) << (getHitRate() * 100.0) << "%)\n";
-   }
-   else
-   {
-      gout << "\n";
-   }
-}
-
-/*********************************************
- * SIMULATOR : DISPLAY HIT STATUS
- * Display hit/miss status
+ * SIMULATOR : RESET
+ * Reset the current simulation state
  *********************************************/
-void Simulator::displayHitStatus(ogstream& gout) const
+void Simulator::reset()
 {
-   if (!isFiring)
-   {
-      gout << std::setw(95) << std::setfill(' ') << "";
-      
-      if (shotsAttempted > 0)
-      {
-         if (isHit)
-            gout << "Target: HIT!";
-         else
-            gout << "Target: Miss";
-      }
-      else
-      {
-         gout << "Press SPACE to fire";
-      }
-   }
-   else
-   {
-      gout << std::setw(100) << std::setfill(' ') << ""
-           << "Projectile in flight...";
-   }
+   std::lock_guard<std::mutex> lock(mutex);
+   resetRound();
 }
 
 /*********************************************
- * SIMULATOR : RESET
- * Reset the current simulation state
+ * SIMULATOR : RESET ROUND
  *********************************************/
-void Simulator::reset()
+void Simulator::resetRound()
 {
    time = 0.0;
    isFiring = false;
@@ -304,7 +297,7 @@ void Simulator::reset()
    
    // Reset ground and howitzer position
    Position howitzerPos = howitzer.getPosition();
-   ground.reset(howitzerPos);
+   ground.reset(howitzerPos, nextRoundSeed());
    howitzer.setPosition(howitzerPos);
 }
 
@@ -314,12 +307,77 @@ void Simulator::reset()
  *********************************************/
 void Simulator::newGame()
 {
+   std::lock_guard<std::mutex> lock(mutex);
    score = 0;
    shotsAttempted = 0;
    
    // Generate new howitzer position
-   howitzer.generatePosition(posUpperRight);
+   howitzer.generatePosition(posUpperRight, nextRoundSeed());
    howitzer.reset();
    
-   reset();
+   resetRound();
+}
+
+/*********************************************
+ * SIMULATOR : CAPTURE
+ *********************************************/
+void Simulator::capture(SimulatorSnapshot& snapshot) const
+{
+   snapshot.time = time;
+   snapshot.projectile = projectile.getPosition();
+   snapshot.howitzer = howitzer.getPosition();
+   snapshot.elevation = howitzer.getElevation().getRadians();
+   snapshot.timeWarp = timeWarp;
+   snapshot.isFiring = isFiring;
+   snapshot.isHit = isHit;
+   snapshot.score = score;
+   snapshot.shotsAttempted = shotsAttempted;
+   snapshot.trail = projectilePath;
+}
+
+/*********************************************
+ * SIMULATOR : PUBLISH
+ * Fill the back frame and hand it to draw(). The
+ * ground is only copied when it has changed since
+ * this frame was last used
+ *********************************************/
+void Simulator::publish()
+{
+   SimulatorFrame& frame = frames.back();
+   steady_clock::time_point now = steady_clock::now();
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      capture(frame.current);
+      if (frame.round != round)
+      {
+         frame.ground = ground;
+         frame.round = round;
+      }
+   }
+   frame.previous = snapshotPublished;
+   frame.published = now;
+   frame.interval = duration<double>(now - timePublished).count();
+   
+   snapshotPublished = frame.current;
+   timePublished = now;
+   frames.publish();
+}
+
+/*********************************************
+ * SIMULATOR FRAME : AT
+ *********************************************/
+SimulatorSnapshot SimulatorFrame::at(double alpha) const
+{
+   if (!previous.isFiring || !current.isFiring ||
+       previous.shotsAttempted != current.shotsAttempted)
+      return current;
+   
+   alpha = std::max(0.0, std::min(1.0, alpha));
+   SimulatorSnapshot snapshot(current);
+   snapshot.time = previous.time + (current.time - previous.time) * alpha;
+   snapshot.projectile.setMeters(
+      previous.projectile.getMetersX() + (current.projectile.getMetersX() - previous.projectile.getMetersX()) * alpha,
+      previous.projectile.getMetersY() + (current.projectile.getMetersY() - previous.projectile.getMetersY()) * alpha);
+   snapshot.elevation = previous.elevation + (current.elevation - previous.elevation) * alpha;
+   return snapshot;
 }
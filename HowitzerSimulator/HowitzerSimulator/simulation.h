@@ -10,40 +10,148 @@
 #pragma once
 
 #include "position.h"
+#include "viewport.h"
 #include "ground.h"
 #include "howitzer.h"
 #include "projectile.h"
-#include "uiDraw.h"
-#include "uiInteract.h"
+#include "snapshotBuffer.h"
+#include "hudLine.h"
+#include "frameStats.h"
+#include "dispersion.h"
 #include <array>
 #include <iomanip>
+#include <mutex>
+#include <chrono>
+#include <limits>
+#include <memory>
 
 // Simulation constants
 #define TRAIL_LENGTH 20
-#define HIT_TOLERANCE 175.0  // meters
+#define TRAIL_INTERVAL 0.5   // seconds between points of the trail
 #define TIME_STEP 0.5        // seconds
+#define TIME_SCALE 15.0      // simulated seconds per second: 0.5s a frame at 30 fps
+#define DISPERSION_SHOTS 10000   // rounds in a dispersion run: a few frames on a laptop
+
+// The GLUT front end, see uiSimulation.cpp
+class ogstream;
+class Interface;
+
+// Forward declaration for the unit tests
+class TestSimulator;
+
+/*********************************************
+ * SIMULATOR SNAPSHOT
+ * Everything draw() needs from one moment of
+ * the simulation
+ *********************************************/
+struct SimulatorSnapshot
+{
+   double time = 0.0;            // flight time
+   Position projectile;
+   Position howitzer;
+   double elevation = 0.0;       // radians, 0 is straight up
+   double timeWarp = 1.0;
+   bool isFiring = false;
+   bool isHit = false;
+   int score = 0;
+   int shotsAttempted = 0;
+   std::array<Position, TRAIL_LENGTH> trail;
+};
+
+/*********************************************
+ * SIMULATOR FRAME
+ * What publish() hands to draw(): the last two
+ * snapshots, to draw somewhere between, and the
+ * ground they stand on
+ *********************************************/
+struct SimulatorFrame
+{
+   SimulatorSnapshot previous;
+   SimulatorSnapshot current;
+   std::chrono::steady_clock::time_point published;   // when current was
+   double interval = 0.0;        // seconds between previous and current
+   Ground ground;
+   uint64_t round = ~0ull;       // the round ground is from
+
+   // The snapshot alpha of the way from previous to current. Nothing
+   // is blended across a shot landing or a new one being fired
+   SimulatorSnapshot at(double alpha) const;
+};
 
 /*********************************************
  * Simulator
  * Manages the complete artillery simulation
- * including physics, rendering, and user input
+ * including physics, rendering, and user input.
+ * Everything except handleInput() and draw() runs
+ * without a window.
+ * update() and publish() may run on one thread
+ * (see PhysicsThread) while handleInput() and
+ * draw() run on another: the state is guarded by
+ * a mutex that draw() never takes, since it
+ * only looks at published frames. The getters
+ * take no lock; use them when the physics is
+ * not running on another thread
  *********************************************/
 class Simulator
 {
 public:
-   // Constructor
-   Simulator(const Position& posUpperRight);
+   friend ::TestSimulator;
+   
+   // Time warp that finishes a flight in a single update()
+   static constexpr double WARP_FASTEST = std::numeric_limits<double>::infinity();
+
+   // Constructor. Each round's ground comes from the seed and the
+   // round number, so a seed replays the same game
+   Simulator(const Viewport& viewport, uint64_t seed = randomSeed());
    
    // Main simulation loop functions
    void update(double timeStep);
    void handleInput(const Interface* pUI);
    void draw(ogstream& gout) const;
    
+   // Make the current state what draw() shows
+   void publish();
+   
+   // Is anything moving in what draw() showed last? Same thread as draw()
+   bool isAnimating() const { return frames.front().current.isFiring; }
+   
+   // The performance overlay, shown and hidden with P. Same thread as
+   // draw(): nothing is drawn while it is hidden
+   void drawPerformance(ogstream& gout, const FrameStats& stats) const;
+   bool isPerformanceShown() const { return isShowingPerformance; }
+   void setPerformanceShown(bool value) { isShowingPerformance = value; }
+   
+   // Dispersion mode, with M: fire DISPERSION_SHOTS rounds with small
+   // errors at the target, aimed as the howitzer is now, and show
+   // their spread until the aim or the round changes. Same thread as
+   // draw(), and not while holding the lock
+   void runDispersion();
+   bool hasDispersion() const { return isShowingDispersion; }
+   const DispersionResult& getDispersion() const { return dispersion; }
+   
+   // Fire the howitzer if no shell is in the air
+   void fire();
+   
+   // Fast forward: each update() covers timeWarp of its steps while a
+   // shell is in flight, up to WARP_FASTEST. 1 is real speed
+   void setTimeWarp(double timeWarp);
+   double getTimeWarp() const { return timeWarp; }
+   static double nextTimeWarp(double timeWarp);   // 1x, 10x, 100x, fastest, 1x...
+   
+   // The pieces of the simulation
+   Howitzer& getHowitzer() { return howitzer; }
+   const Howitzer& getHowitzer() const { return howitzer; }
+   const Ground& getGround() const { return ground; }
+   const Projectile& getProjectile() const { return projectile; }
+   
    // Getters
    Position getPosUpperRight() const { return posUpperRight; }
+   const Viewport& getViewport() const { return ground.getViewport(); }
    double getSimulationTime() const { return time; }
    bool isProjectileFlying() const { return isFiring; }
    bool hasHitTarget() const { return isHit; }
+   uint64_t getSeed() const { return seed; }
+   uint64_t getRound() const { return round; }
    
    // Game state management
    void reset();
@@ -58,6 +166,9 @@ public:
    }
    
 private:
+   // Guards everything below but frames
+   mutable std::mutex mutex;
+   
    // Core simulation objects
    Ground ground;
    Howitzer howitzer;
@@ -66,16 +177,54 @@ private:
    
    // Projectile trail for visual effects
    std::array<Position, TRAIL_LENGTH> projectilePath;
+   double timeTrail;        // flight time of projectilePath[0]
+   
+   // Published for draw()
+   mutable SnapshotBuffer<SimulatorFrame> frames;
+   SimulatorSnapshot snapshotPublished;
+   std::chrono::steady_clock::time_point timePublished;
+   
+   // The text of the display, kept from frame to frame by draw()
+   enum { HUD_TIME, HUD_ANGLE, HUD_WARP, HUD_SCORE, HUD_STATUS,
+          HUD_FRAME, HUD_PHYSICS, HUD_STEPS, HUD_DRAWS, HUD_LEGEND,
+          HUD_SPREAD, HUD_CHANCE, HUD_NUM_LINES };
+   mutable std::array<HudLine, HUD_NUM_LINES> hud;
+   bool isShowingPerformance;   // the overlay, only touched by the UI thread
+   
+   // The last dispersion run, only touched by the UI thread
+   std::unique_ptr<ThreadPool> pool;   // made the first time it is needed
+   DispersionResult dispersion;
+   double dispersionElevation;   // radians, the aim it was for
+   uint64_t dispersionRound;     // and the round
+   bool isShowingDispersion;
    
    // Simulation state
    double time;              // Current simulation time
    bool isFiring;           // Is projectile currently in flight
    bool isHit;              // Did last shot hit the target
+   double timeWarp;         // Steps of flight per update
    
    // Game statistics
    int score;               // Number of hits
    int shotsAttempted;      // Total shots fired
    
+   // Random numbers
+   uint64_t seed;           // Seed of the whole game
+   uint64_t round;          // Rounds of terrain generated so far
+   
+   // The seed of the next round of terrain
+   uint64_t nextRoundSeed() { return Philox(seed).at(round++); }
+   
+   // The work of fire() and reset(), with the mutex already held
+   void launch();
+   void resetRound();
+   
+   // The shell is down: score it and get ready for the next
+   void land();
+   
+   // Copy the state into a snapshot
+   void capture(SimulatorSnapshot& snapshot) const;
+   
    // Input handling
    void processMovementInput(const Interface* pUI);
    void processFireInput(const Interface* pUI);
@@ -90,6 +239,7 @@ private:
    
    // Utility functions
    double calculateDistance(const Position& pos1, const Position& pos2) const;
-   void displayGameStats(ogstream& gout) const;
-   void displayHitStatus(ogstream& gout) const;
+   void displayGameStats(ogstream& gout, const SimulatorSnapshot& snapshot) const;
+   void displayHitStatus(ogstream& gout, const SimulatorSnapshot& snapshot) const;
+   void displayDispersion(ogstream& gout, const SimulatorFrame& frame) const;
 };
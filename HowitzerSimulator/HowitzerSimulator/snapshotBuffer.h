@@ -0,0 +1,74 @@
+/***********************************************************************
+ * Header File:
+ *    SNAPSHOT BUFFER
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Hands the latest copy of something from one thread to another
+ *    without either of them ever waiting on a lock
+ ************************************************************************/
+
+#pragma once
+
+#include <atomic>
+
+// Forward declaration for the unit tests
+class TestSnapshotBuffer;
+
+/*********************************************
+ * SNAPSHOT BUFFER
+ * Double buffering between two threads with a
+ * third slot to swap through. The writer fills
+ * back() and publish()es it; the reader calls
+ * acquire() and then looks at front(). Each side
+ * only ever touches its own slot, and they trade
+ * slots through one atomic exchange on the
+ * middle, so the reader never sees a half
+ * written value and neither side blocks. The
+ * reader always gets the newest value; the ones
+ * in between are dropped. One writer thread and
+ * one reader thread only
+ *********************************************/
+template <class T>
+class SnapshotBuffer
+{
+public:
+   friend ::TestSnapshotBuffer;
+
+   SnapshotBuffer() : iFront(0), middle(1), iBack(2) {}
+
+   SnapshotBuffer(const SnapshotBuffer&) = delete;
+   SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+   // Writer: the slot to fill. It keeps whatever was last written to
+   // it, so a writer may update only the parts that changed
+   T& back() { return slots[iBack]; }
+
+   // Writer: hand back() to the reader and take the spare slot
+   void publish()
+   {
+      iBack = middle.exchange(iBack | FRESH, std::memory_order_acq_rel) & INDEX;
+   }
+
+   // Reader: move to the newest published slot, if there is one.
+   // Returns false when nothing new has been published
+   bool acquire()
+   {
+      if (!(middle.load(std::memory_order_acquire) & FRESH))
+         return false;
+      iFront = middle.exchange(iFront, std::memory_order_acq_rel) & INDEX;
+      return true;
+   }
+
+   // Reader: the slot last acquired
+   const T& front() const { return slots[iFront]; }
+
+private:
+   static const unsigned int INDEX = 3;   // the slot number
+   static const unsigned int FRESH = 4;   // set when middle is newer than front
+
+   T slots[3];
+   unsigned int iFront;                   // only the reader touches this
+   std::atomic<unsigned int> middle;      // the spare, plus the FRESH flag
+   unsigned int iBack;                    // only the writer touches this
+};
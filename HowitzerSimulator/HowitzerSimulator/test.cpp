@@ -10,12 +10,33 @@
 #include "test.h"
 #include "testAngle.h"
 #include "testPosition.h"
+#include "testViewport.h"
 #include "testPhysics.h"
 #include "testVelocity.h"
 #include "testAcceleration.h"
 #include "testGround.h"
+#include "testMesh.h"
+#include "testDrawList.h"
+#include "testGlyphAtlas.h"
 #include "testHowitzer.h"
+#include "testFlightPath.h"
 #include "testProjectile.h"
+#include "testProjectileBatch.h"
+#include "testIntegrator.h"
+#include "testFiringTable.h"
+#include "testRangeCurve.h"
+#include "testThreadPool.h"
+#include "testDispersion.h"
+#include "testRandom.h"
+#include "testSnapshotBuffer.h"
+#include "testPhysicsThread.h"
+#include "testSimulator.h"
+#include "testHudLine.h"
+#include "testFrameScheduler.h"
+#include "testFrameStats.h"
+#include "testBenchmark.h"
+#include "testPerfCounters.h"
+#include "testProfiler.h"
 
 // This code, and the similar IF_DEF in testRunner(), is to ensure that
 // you can see the text output (called the console window) and OpenGL's
@@ -46,9 +67,30 @@ void testRunner()
    TestAngle().run();
    TestAcceleration().run();
    TestPosition().run();
+   TestViewport().run();
    TestPhysics().run();
    TestVelocity().run();
-//   TestGround().run();  
+   TestGround().run();
+   TestMesh().run();
+   TestDrawList().run();
+   TestGlyphAtlas().run();
    TestHowitzer().run();
+   TestFlightPath().run();
    TestProjectile().run();
+   TestProjectileBatch().run();
+   TestIntegrator().run();
+   TestFiringTable().run();
+   TestRangeCurve().run();
+   TestThreadPool().run();
+   TestDispersion().run();
+   TestRandom().run();
+   TestSnapshotBuffer().run();
+   TestPhysicsThread().run();
+   TestSimulator().run();
+   TestHudLine().run();
+   TestFrameScheduler().run();
+   TestFrameStats().run();
+   TestBenchmark().run();
+   TestPerfCounters().run();
+   TestProfiler().run();
 }
@@ -0,0 +1,410 @@
+/***********************************************************************
+ * Header File:
+ *    TEST BENCHMARK
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for Benchmark
+ ************************************************************************/
+
+
+#pragma once
+
+#include "benchmark.h"
+#include "unitTest.h"
+#include <sstream>
+
+
+/*******************************
+ * TEST BENCHMARK
+ * A friend class for Benchmark which contains its unit tests
+ ********************************/
+class TestBenchmark : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Statistics
+      summarize_odd();
+      summarize_even();
+      summarize_p99();
+      summarize_empty();
+
+      // Ticket 2: Timing
+      run_count();
+      run_calibrate();
+      record();
+      find();
+
+      // Ticket 3: Files
+      writeCSV();
+      readCSV_roundTrip();
+      readCSV_counts();
+      readCSV_old();
+      readCSV_bad();
+
+      // Ticket 4: Hardware counters
+      run_counters();
+
+      report("Benchmark");
+   }
+
+private:
+
+   // A result as though it were measured
+   static BenchmarkResult result(const char* name, uint64_t iterations, int numSamples,
+                                 double median, double p99, double minimum, double mean,
+                                 double stepsPerOp = 1.0)
+   {
+      BenchmarkResult r;
+      r.name = name;
+      r.iterations = iterations;
+      r.numSamples = numSamples;
+      r.median = median;
+      r.p99 = p99;
+      r.minimum = minimum;
+      r.mean = mean;
+      r.stepsPerOp = stepsPerOp;
+      return r;
+   }
+
+   /*****************************************************************
+    *****************************************************************
+    * STATISTICS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    SUMMARIZE an odd number of samples
+    * input:   5, 1, 4, 2, 3
+    * output:  median 3, min 1, mean 3
+    *********************************************/
+   void summarize_odd()
+   {  // setup
+      std::vector<double> samples = { 5.0, 1.0, 4.0, 2.0, 3.0 };
+      // exercise
+      BenchmarkResult r = Benchmark::summarize("odd", 10, samples);
+      // verify
+      assertUnit(r.name == "odd");
+      assertUnit(r.iterations == 10);
+      assertUnit(r.numSamples == 5);
+      assertEquals(r.median, 3.0);
+      assertEquals(r.minimum, 1.0);
+      assertEquals(r.mean, 3.0);
+      assertEquals(r.p99, 5.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SUMMARIZE an even number of samples
+    * input:   4, 1, 3, 2
+    * output:  median halfway between 2 and 3
+    *********************************************/
+   void summarize_even()
+   {  // setup
+      std::vector<double> samples = { 4.0, 1.0, 3.0, 2.0 };
+      // exercise
+      BenchmarkResult r = Benchmark::summarize("even", 1, samples);
+      // verify
+      assertEquals(r.median, 2.5);
+      assertEquals(r.mean, 2.5);
+   }  // teardown
+
+   /*********************************************
+    * name:    SUMMARIZE the 99th percentile
+    * input:   200 down to 1
+    * output:  198: two samples were slower
+    *********************************************/
+   void summarize_p99()
+   {  // setup
+      std::vector<double> samples;
+      for (int i = 200; i >= 1; i--)
+         samples.push_back((double)i);
+      // exercise
+      BenchmarkResult r = Benchmark::summarize("p99", 1, samples);
+      // verify
+      assertEquals(r.p99, 198.0);
+      assertEquals(r.median, 100.5);
+   }  // teardown
+
+   /*********************************************
+    * name:    SUMMARIZE nothing
+    * input:   no samples
+    * output:  all zero
+    *********************************************/
+   void summarize_empty()
+   {  // setup
+      std::vector<double> samples;
+      // exercise
+      BenchmarkResult r = Benchmark::summarize("none", 0, samples);
+      // verify
+      assertUnit(r.numSamples == 0);
+      assertEquals(r.median, 0.0);
+      assertEquals(r.p99, 0.0);
+      assertEquals(r.mean, 0.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * TIMING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    RUN how many times
+    * input:   3 samples, 2 warm-up, no minimum time
+    * output:  one operation per sample: called once
+    *          to calibrate, then 2 + 3 times
+    *********************************************/
+   void run_count()
+   {  // setup
+      Benchmark bench(3, 2, 0.0);
+      int numCalls = 0;
+      // exercise
+      const BenchmarkResult& r = bench.run("count", [&]() { numCalls++; });
+      // verify
+      assertUnit(numCalls == 6);
+      assertUnit(r.iterations == 1);
+      assertUnit(r.numSamples == 3);
+      assertUnit(bench.getResults().size() == 1);
+   }  // teardown
+
+   /*********************************************
+    * name:    RUN with a minimum sample time
+    * input:   an operation that takes at least 0.1ms,
+    *          samples of at least 1ms
+    * output:  no more than 16 operations per
+    *          sample, each timed at 0.1ms or more
+    *********************************************/
+   void run_calibrate()
+   {  // setup
+      Benchmark bench(3, 0, 0.001);
+      auto wait = []()
+      {
+         Benchmark::Clock::time_point end = Benchmark::Clock::now() +
+                                            std::chrono::microseconds(100);
+         int spins = 0;
+         while (Benchmark::Clock::now() < end)
+            spins++;
+         return spins;
+      };
+      // exercise
+      const BenchmarkResult& r = bench.run("wait", wait);
+      // verify
+      assertUnit(r.iterations <= 16);
+      assertUnit(r.minimum >= 100000.0);
+      assertUnit(r.median >= r.minimum);
+      assertUnit(r.p99 >= r.median);
+   }  // teardown
+
+   /*********************************************
+    * name:    RECORD samples timed elsewhere
+    * input:   three frames of 2, 9 and 4 ns
+    * output:  summarized and added to the results
+    *********************************************/
+   void record()
+   {  // setup
+      Benchmark bench;
+      // exercise
+      const BenchmarkResult& r = bench.record("frame", 1, { 2.0, 9.0, 4.0 });
+      // verify
+      assertUnit(bench.getResults().size() == 1);
+      assertUnit(&r == &bench.getResults()[0]);
+      assertUnit(r.name == "frame");
+      assertUnit(r.numSamples == 3);
+      assertEquals(r.median, 4.0);
+      assertEquals(r.p99, 9.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FIND
+    * input:   "a" and "b" run, look for "b" and "c"
+    * output:  "b" found, "c" not
+    *********************************************/
+   void find()
+   {  // setup
+      Benchmark bench(1, 0, 0.0);
+      bench.run("a", []() { return 1; });
+      bench.run("b", []() { return 2; });
+      // exercise
+      const BenchmarkResult* pB = bench.find("b");
+      const BenchmarkResult* pC = bench.find("c");
+      // verify
+      assertUnit(pB == &bench.getResults()[1]);
+      assertUnit(pC == NULL);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FILES
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    WRITE CSV
+    * input:   one result without counts, one with
+    *          some of them
+    * output:  a header row and a line for each, the
+    *          counts that were not taken left empty
+    *********************************************/
+   void writeCSV()
+   {  // setup
+      Benchmark bench;
+      bench.results.push_back(result("add", 64, 3, 1.5, 2.0, 1.0, 1.5));
+      BenchmarkResult fly = result("fly", 2, 3, 10.0, 12.0, 9.0, 10.5, 250.0);
+      fly.counts.value[PERF_CYCLES] = 4000.0;
+      fly.counts.value[PERF_INSTRUCTIONS] = 9000.5;
+      bench.results.push_back(fly);
+      std::ostringstream out;
+      // exercise
+      bench.writeCSV(out);
+      // verify
+      assertUnit(out.str() ==
+                 "name,iterations,samples,median_ns,p99_ns,min_ns,mean_ns,steps_per_op,"
+                 "cycles,instructions,l1d_misses,llc_misses,branch_misses\n"
+                 "add,64,3,1.500,2.000,1.000,1.500,1,,,,,\n"
+                 "fly,2,3,10.000,12.000,9.000,10.500,250,4000,9000.5,,,\n");
+   }  // teardown
+
+   /*********************************************
+    * name:    READ CSV what was written
+    * input:   two results written out
+    * output:  the same two results
+    *********************************************/
+   void readCSV_roundTrip()
+   {  // setup
+      Benchmark before;
+      before.results.push_back(result("Velocity::getSpeed", 1024, 101, 3.5, 4.25, 3.125, 3.75));
+      before.results.push_back(result("trajectory", 2, 101, 569098.0, 621778.0, 545041.5, 580000.0));
+      std::stringstream file;
+      before.writeCSV(file);
+      Benchmark after;
+      // exercise
+      bool isRead = after.readCSV(file);
+      // verify
+      assertUnit(isRead);
+      assertUnit(after.getResults().size() == 2);
+      if (after.getResults().size() == 2)
+      {
+         const BenchmarkResult& r = after.getResults()[1];
+         assertUnit(after.getResults()[0].name == "Velocity::getSpeed");
+         assertUnit(r.name == "trajectory");
+         assertUnit(r.iterations == 2);
+         assertUnit(r.numSamples == 101);
+         assertEquals(r.median, 569098.0);
+         assertEquals(r.p99, 621778.0);
+         assertEquals(r.minimum, 545041.5);
+         assertEquals(r.mean, 580000.0);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    READ CSV with hardware counts
+    * input:   a result with cycles and branch misses
+    * output:  those two counted, the rest not
+    *********************************************/
+   void readCSV_counts()
+   {  // setup
+      Benchmark before;
+      BenchmarkResult fly = result("fly", 2, 3, 10.0, 12.0, 9.0, 10.5, 250.0);
+      fly.counts.value[PERF_CYCLES] = 4000.0;
+      fly.counts.value[PERF_BRANCH_MISSES] = 0.25;
+      before.results.push_back(fly);
+      std::stringstream file;
+      before.writeCSV(file);
+      Benchmark after;
+      // exercise
+      bool isRead = after.readCSV(file);
+      // verify
+      assertUnit(isRead);
+      assertUnit(after.getResults().size() == 1);
+      if (after.getResults().size() == 1)
+      {
+         const PerfCounts& counts = after.getResults()[0].counts;
+         assertEquals(after.getResults()[0].stepsPerOp, 250.0);
+         assertEquals(counts.value[PERF_CYCLES], 4000.0);
+         assertEquals(counts.value[PERF_BRANCH_MISSES], 0.25);
+         assertUnit(!counts.isCounted(PERF_INSTRUCTIONS));
+         assertUnit(!counts.isCounted(PERF_L1D_MISSES));
+         assertUnit(!counts.isCounted(PERF_LLC_MISSES));
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    READ CSV from before the counts
+    * input:   only the first seven columns
+    * output:  read, one step, nothing counted
+    *********************************************/
+   void readCSV_old()
+   {  // setup
+      Benchmark bench;
+      std::istringstream file("name,iterations,samples,median_ns,p99_ns,min_ns,mean_ns\n"
+                              "add,64,3,1.500,2.000,1.000,1.500\n");
+      // exercise
+      bool isRead = bench.readCSV(file);
+      // verify
+      assertUnit(isRead);
+      assertUnit(bench.getResults().size() == 1);
+      if (bench.getResults().size() == 1)
+      {
+         const BenchmarkResult& r = bench.getResults()[0];
+         assertUnit(r.iterations == 64);
+         assertEquals(r.mean, 1.5);
+         assertEquals(r.stepsPerOp, 1.0);
+         assertUnit(!r.counts.isAnyCounted());
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    READ CSV that is not ours
+    * input:   a file without our header
+    * output:  false, results unchanged
+    *********************************************/
+   void readCSV_bad()
+   {  // setup
+      Benchmark bench;
+      bench.results.push_back(result("keep", 1, 1, 1.0, 1.0, 1.0, 1.0));
+      std::istringstream file("muzzle_velocity,angle,range\n827.0,45.0,1000.0\n");
+      // exercise
+      bool isRead = bench.readCSV(file);
+      // verify
+      assertUnit(!isRead);
+      assertUnit(bench.getResults().size() == 1);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * HARDWARE COUNTERS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    RUN with hardware counters
+    * input:   1000 additions per operation, 10 steps each
+    * output:  counted per operation where this machine
+    *          can count, and timed either way
+    *********************************************/
+   void run_counters()
+   {  // setup
+      PerfCounters counters;
+      Benchmark bench(3, 0, 0.0);
+      bench.setCounters(&counters);
+      auto add = []()
+      {
+         double sum = 0.0;
+         for (int i = 0; i < 1000; i++)
+         {
+            sum += (double)i;
+            doNotOptimize(sum);
+         }
+         return sum;
+      };
+      // exercise
+      const BenchmarkResult& r = bench.run("add", add, 10.0);
+      // verify
+      assertEquals(r.stepsPerOp, 10.0);
+      assertUnit(r.minimum > 0.0);
+      assertUnit(r.counts.isAnyCounted() == counters.isAvailable());
+      if (counters.isAvailable(PERF_INSTRUCTIONS) && r.counts.isCounted(PERF_INSTRUCTIONS))
+         assertUnit(r.counts.value[PERF_INSTRUCTIONS] > 1000.0);
+   }  // teardown
+};
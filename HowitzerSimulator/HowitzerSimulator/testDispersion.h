@@ -0,0 +1,240 @@
+/***********************************************************************
+ * Header File:
+ *    TEST DISPERSION
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for Dispersion
+ ************************************************************************/
+
+
+#pragma once
+
+#include "dispersion.h"
+#include "firingTable.h"
+#include "ground.h"
+#include "unitTest.h"
+#include <cmath>
+#include <cstring>
+
+
+/*******************************
+ * TEST DISPERSION
+ * A friend class for Dispersion which contains its unit tests
+ ********************************/
+class TestDispersion : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Setup
+      constructor();
+      fire_noErrors();
+
+      // Ticket 2: Reproducible
+      run_threadsAgree();
+      run_seedMatters();
+
+      // Ticket 3: Statistics
+      summarize_handBuilt();
+      run_noErrors();
+      run_velocityOnly();
+      run_farTarget();
+
+      report("Dispersion");
+   }
+
+private:
+
+   // every error off
+   static DispersionErrors none()
+   {
+      DispersionErrors errors;
+      errors.muzzleVelocity = errors.elevation = errors.azimuth = 0.0;
+      errors.mass = errors.radius = errors.densityScale = 0.0;
+      return errors;
+   }
+
+   /*****************************************************************
+    *****************************************************************
+    * SETUP
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    CONSTRUCTOR
+    * input:   45 degrees, 827m/s, target 20km
+    * output:  default errors and the game's hit tolerance
+    *********************************************/
+   void constructor()
+   {  // setup
+      // exercise
+      Dispersion d(45.0, 827.0, 20000.0);
+      // verify
+      assertEquals(d.angle, 45.0);
+      assertEquals(d.muzzleVelocity, 827.0);
+      assertEquals(d.targetRange, 20000.0);
+      assertEquals(d.targetElevation, 0.0);
+      assertEquals(d.hitTolerance, HIT_TOLERANCE);
+      assertEquals(d.getErrors().muzzleVelocity, DEFAULT_SIGMA_MUZZLE_VELOCITY);
+      assertEquals(d.getErrors().densityScale, DEFAULT_SIGMA_DENSITY);
+      assertUnit(d.getImpacts().empty());
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE with no errors
+    * input:   45 degrees, 827m/s, every sigma zero
+    * output:  lands where FiringTable says, straight down range
+    *********************************************/
+   void fire_noErrors()
+   {  // setup
+      Dispersion d(45.0, 827.0, 20000.0);
+      d.setErrors(none());
+      // exercise
+      Impact impact = d.fire(17, 1);
+      // verify
+      assertEquals(impact.range, (float)FiringTable::fire(45.0, 827.0).range);
+      assertEquals(impact.deflection, 0.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * REPRODUCIBLE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    RUN gives the same answer on any number of threads
+    * input:   2000 rounds, seed 42, on 1, 3 and 8 threads
+    * output:  the same impacts bit for bit
+    *********************************************/
+   void run_threadsAgree()
+   {  // setup
+      Dispersion one(45.0, 827.0, 20000.0);
+      Dispersion three(45.0, 827.0, 20000.0);
+      Dispersion eight(45.0, 827.0, 20000.0);
+      ThreadPool pool1(1);
+      ThreadPool pool3(3);
+      ThreadPool pool8(8);
+      // exercise
+      DispersionResult r1 = one.run(2000, 42, pool1);
+      DispersionResult r3 = three.run(2000, 42, pool3);
+      DispersionResult r8 = eight.run(2000, 42, pool8);
+      // verify
+      size_t bytes = 2000 * sizeof(Impact);
+      assertUnit(memcmp(one.impacts.data(), three.impacts.data(), bytes) == 0);
+      assertUnit(memcmp(one.impacts.data(), eight.impacts.data(), bytes) == 0);
+      assertUnit(r1.cep == r3.cep && r1.cep == r8.cep);
+      assertUnit(r1.meanRange == r8.meanRange);
+      assertUnit(r1.hitProbability == r8.hitProbability);
+   }  // teardown
+
+   /*********************************************
+    * name:    RUN with another seed
+    * input:   100 rounds, seeds 1 and 2
+    * output:  different impacts
+    *********************************************/
+   void run_seedMatters()
+   {  // setup
+      Dispersion a(45.0, 827.0, 20000.0);
+      Dispersion b(45.0, 827.0, 20000.0);
+      ThreadPool pool(2);
+      // exercise
+      a.run(100, 1, pool);
+      b.run(100, 2, pool);
+      // verify
+      assertUnit(a.impacts[0].range != b.impacts[0].range);
+      assertUnit(a.impacts[99].deflection != b.impacts[99].deflection);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * STATISTICS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    SUMMARIZE impacts we made up
+    * input:   ranges 100..104 on the line of fire, one dud,
+    *          target at 102 with a 1.5m tolerance
+    * output:  mean 102, REP 1, CEP 1, DEP 0, 3 hits of 6 rounds
+    *********************************************/
+   void summarize_handBuilt()
+   {  // setup
+      Dispersion d(45.0, 827.0, 102.0);
+      d.setHitTolerance(1.5);
+      d.impacts = { { 100.0f, 0.0f }, { 101.0f, 0.0f }, { 102.0f, 0.0f },
+                    { 103.0f, 0.0f }, { 104.0f, 0.0f },
+                    { NAN, 0.0f } };
+      // exercise
+      DispersionResult r = d.summarize();
+      // verify
+      assertUnit(r.numShots == 6);
+      assertUnit(r.numLanded == 5);
+      assertEquals(r.meanRange, 102.0);
+      assertEquals(r.meanDeflection, 0.0);
+      assertEquals(r.rangeErrorProbable, 1.0);
+      assertEquals(r.deflectionErrorProbable, 0.0);
+      assertEquals(r.cep, 1.0);
+      assertEquals(r.hitProbability, 0.5);
+   }  // teardown
+
+   /*********************************************
+    * name:    RUN with no errors, aimed at the impact point
+    * input:   500 rounds, every sigma zero
+    * output:  no spread and every round a hit
+    *********************************************/
+   void run_noErrors()
+   {  // setup
+      Dispersion d(45.0, 827.0, FiringTable::fire(45.0, 827.0).range);
+      d.setErrors(none());
+      ThreadPool pool(4);
+      // exercise
+      DispersionResult r = d.run(500, 7, pool);
+      // verify
+      assertUnit(r.numLanded == 500);
+      assertUnit(r.cep < 0.01);
+      assertUnit(r.rangeErrorProbable < 0.01);
+      assertEquals(r.hitProbability, 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    RUN with only muzzle velocity error
+    * input:   2000 rounds, 5m/s sigma
+    * output:  spread in range only: DEP 0 and CEP = REP
+    *********************************************/
+   void run_velocityOnly()
+   {  // setup
+      Dispersion d(45.0, 827.0, FiringTable::fire(45.0, 827.0).range);
+      DispersionErrors errors = none();
+      errors.muzzleVelocity = 5.0;
+      d.setErrors(errors);
+      ThreadPool pool(4);
+      // exercise
+      DispersionResult r = d.run(2000, 3, pool);
+      // verify
+      assertEquals(r.deflectionErrorProbable, 0.0);
+      assertUnit(r.rangeErrorProbable > 10.0);
+      assertUnit(fabs(r.cep - r.rangeErrorProbable) < 0.01);
+      assertUnit(r.hitProbability > 0.0 && r.hitProbability < 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    RUN at a target far beyond the impacts
+    * input:   1000 rounds with default errors, target 5km long
+    * output:  no hits, but the spread is still measured
+    *********************************************/
+   void run_farTarget()
+   {  // setup
+      double range = FiringTable::fire(45.0, 827.0).range;
+      Dispersion d(45.0, 827.0, range + 5000.0);
+      ThreadPool pool(4);
+      // exercise
+      DispersionResult r = d.run(1000, 11, pool);
+      // verify
+      assertEquals(r.hitProbability, 0.0);
+      assertUnit(fabs(r.meanRange - range) < 100.0);
+      assertUnit(r.cep > 0.0);
+      assertUnit(r.deflectionErrorProbable > 0.0);
+   }  // teardown
+};
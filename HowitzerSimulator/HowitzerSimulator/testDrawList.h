@@ -0,0 +1,290 @@
+/***********************************************************************
+ * Header File:
+ *    TEST DRAW LIST
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for DrawList
+ ************************************************************************/
+
+
+#pragma once
+
+#include "drawList.h"
+#include "ground.h"
+#include "uiDraw.h"
+#include "unitTest.h"
+#include <cstring>
+
+
+/*******************************
+ * TEST DRAW LIST
+ * A friend class for DrawList which contains its unit tests
+ ********************************/
+class TestDrawList : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Recording
+      addLine();
+      addText_two();
+      addMesh_segment();
+      clear_keepsMemory();
+
+      // Ticket 2: Batching
+      build_empty();
+      build_oneBucket();
+      build_aroundMesh();
+      build_howitzer();
+      build_ground();
+
+      report("DrawList");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * RECORDING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    ADD LINE
+    * input:   (1, 2) to (3, 4) in (0.5, 0.25, 0.125)
+    * output:  one command with all of that
+    *********************************************/
+   void addLine()
+   {  // setup
+      DrawList list;
+      // exercise
+      list.addLine(PT(1.0, 2.0), PT(3.0, 4.0), 0.5, 0.25, 0.125);
+      // verify
+      assertUnit(list.commands.size() == 1);
+      assertUnit(list.commands[0].kind == DRAW_LINE);
+      assertUnit(list.commands[0].segment == 0);
+      assertEquals(list.commands[0].x, 1.0);
+      assertEquals(list.commands[0].y, 2.0);
+      assertEquals(list.commands[0].end.x, 3.0);
+      assertEquals(list.commands[0].end.y, 4.0);
+      assertEquals(list.commands[0].red, 0.5);
+      assertEquals(list.commands[0].green, 0.25);
+      assertEquals(list.commands[0].blue, 0.125);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD TEXT twice
+    * input:   "12" then "abc"
+    * output:  both in one arena, each terminated
+    *********************************************/
+   void addText_two()
+   {  // setup
+      DrawList list;
+      // exercise
+      list.addText(PT(1.0, 2.0), "12");
+      list.addText(PT(3.0, 4.0), "abc");
+      // verify
+      assertUnit(list.commands.size() == 2);
+      assertUnit(list.text.size() == 7);
+      assertUnit(list.commands[1].text.iBegin == 3);
+      assertUnit(list.commands[1].text.length == 3);
+      assertUnit(strcmp(list.getText(list.commands[0]), "12") == 0);
+      assertUnit(strcmp(list.getText(list.commands[1]), "abc") == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD MESH
+    * input:   a rectangle, a mesh, a rectangle
+    * output:  the mesh ends segment 0
+    *********************************************/
+   void addMesh_segment()
+   {  // setup
+      DrawList list;
+      Mesh mesh(Mesh::LINES);
+      // exercise
+      list.addRectangle(PT(0.0, 0.0), PT(1.0, 1.0));
+      list.addMesh(mesh);
+      list.addRectangle(PT(0.0, 0.0), PT(1.0, 1.0));
+      // verify
+      assertUnit(list.commands.size() == 3);
+      assertUnit(list.commands[0].segment == 0);
+      assertUnit(list.commands[1].segment == 0);
+      assertUnit(list.commands[1].pMesh == &mesh);
+      assertUnit(list.commands[2].segment == 1);
+      assertUnit(list.segment == 1);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLEAR
+    * input:   100 lines, a mesh and some text
+    * output:  nothing recorded, the memory kept
+    *********************************************/
+   void clear_keepsMemory()
+   {  // setup
+      DrawList list;
+      Mesh mesh;
+      for (int i = 0; i < 100; i++)
+         list.addLine(PT(0.0, 0.0), PT(1.0, 1.0));
+      list.addMesh(mesh);
+      list.addText(PT(0.0, 0.0), "text");
+      // exercise
+      list.clear();
+      // verify
+      assertUnit(list.commands.empty());
+      assertUnit(list.text.empty());
+      assertUnit(list.segment == 0);
+      assertUnit(list.commands.capacity() >= 102);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * BATCHING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    BUILD with nothing recorded
+    * input:   an empty list
+    * output:  nothing to draw
+    *********************************************/
+   void build_empty()
+   {  // setup
+      DrawList list;
+      // exercise
+      const std::vector<const Mesh*>& batches = list.build();
+      // verify
+      assertUnit(batches.empty());
+   }  // teardown
+
+   /*********************************************
+    * name:    BUILD one kind of each
+    * input:   rectangle, line, text, rectangle, line
+    * output:  a mesh of both rectangles, then one
+    *          of both lines, in the order recorded
+    *********************************************/
+   void build_oneBucket()
+   {  // setup
+      DrawList list;
+      list.addRectangle(PT(0.0, 0.0), PT(1.0, 1.0), 1.0, 0.0, 0.0);
+      list.addLine(PT(0.0, 0.0), PT(1.0, 1.0));
+      list.addText(PT(0.0, 0.0), "text");
+      list.addRectangle(PT(2.0, 2.0), PT(3.0, 3.0), 0.0, 1.0, 0.0);
+      list.addLine(PT(2.0, 2.0), PT(3.0, 3.0));
+      // exercise
+      const std::vector<const Mesh*>& batches = list.build();
+      // verify
+      assertUnit(batches.size() == 2);
+      if (batches.size() == 2)
+      {
+         assertUnit(batches[0]->getPrimitive() == Mesh::TRIANGLES);
+         assertUnit(batches[0]->size() == 12);
+         assertEquals(batches[0]->getVertices()[0].red, 1.0);
+         assertEquals(batches[0]->getVertices()[6].green, 1.0);
+         assertUnit(batches[1]->getPrimitive() == Mesh::LINES);
+         assertUnit(batches[1]->size() == 4);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    BUILD around a mesh
+    * input:   line, mesh, rectangle, line
+    * output:  the first line, the mesh, then the
+    *          rectangle and the last line
+    *********************************************/
+   void build_aroundMesh()
+   {  // setup
+      DrawList list;
+      Mesh mesh(Mesh::TRIANGLES);
+      mesh.addRectangle(PT(0.0, 0.0), PT(1.0, 1.0));
+      list.addLine(PT(0.0, 0.0), PT(1.0, 1.0));
+      list.addMesh(mesh);
+      list.addRectangle(PT(0.0, 0.0), PT(1.0, 1.0));
+      list.addLine(PT(2.0, 2.0), PT(3.0, 3.0));
+      // exercise
+      const std::vector<const Mesh*>& batches = list.build();
+      // verify
+      assertUnit(batches.size() == 4);
+      if (batches.size() == 4)
+      {
+         assertUnit(batches[0]->getPrimitive() == Mesh::LINES);
+         assertEquals(batches[0]->getVertices()[0].x, 0.0);
+         assertUnit(batches[1] == &mesh);
+         assertUnit(batches[2]->getPrimitive() == Mesh::TRIANGLES);
+         assertUnit(batches[3]->getPrimitive() == Mesh::LINES);
+         assertEquals(batches[3]->getVertices()[0].x, 2.0);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    BUILD a howitzer just fired
+    * input:   a howitzer at (100, 50), age 0
+    * output:  six quads and ten lines of flash
+    *********************************************/
+   void build_howitzer()
+   {  // setup
+      DrawList list;
+      list.addHowitzer(PT(100.0, 50.0), 0.0, 0.0);
+      // exercise
+      const std::vector<const Mesh*>& batches = list.build();
+      // verify
+      assertUnit(batches.size() == 2);
+      if (batches.size() == 2)
+      {
+         assertUnit(batches[0]->size() == 6 * 6);
+         assertUnit(batches[1]->size() == 10 * 2);
+         assertEquals(batches[0]->getVertices()[0].x, 110.0);  // footing
+         assertEquals(batches[0]->getVertices()[0].y, 50.0);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    BUILD a real ground
+    * input:   a ground from seed 1, drawn through a
+    *          recorder
+    * output:  the grid, the terrain, the target and
+    *          the ticks, each in its own batch and in
+    *          that order, then the labels
+    *********************************************/
+   void build_ground()
+   {  // setup
+      Viewport viewport(40.0, 700.0, 500.0);
+      Ground ground(viewport);
+      Position posHowitzer;
+      posHowitzer.setMetersX(viewport.getUpperRight().getMetersX() / 2.0);
+      ground.reset(posHowitzer, 1);
+      ogstreamRecorder gout(viewport, Position());
+      ground.draw(gout);
+      const std::vector<DrawCommand>& commands = gout.getDrawList().getCommands();
+      DrawList list = gout.getDrawList();
+      // exercise
+      const std::vector<const Mesh*>& batches = list.build();
+      // verify
+      assertUnit(commands.size() > 4);
+      if (commands.size() > 4)
+      {
+         assertUnit(commands[0].kind == DRAW_MESH);       // grid
+         assertUnit(commands[0].segment == 0);
+         assertUnit(commands[0].pMesh->getPrimitive() == Mesh::LINES);
+         assertUnit(commands[1].kind == DRAW_MESH);       // terrain
+         assertUnit(commands[1].segment == 1);
+         assertUnit(commands[1].pMesh->getPrimitive() == Mesh::TRIANGLES);
+         assertUnit(commands[2].kind == DRAW_RECTANGLE);  // target
+         assertUnit(commands[2].segment == 2);
+         assertUnit(commands[3].kind == DRAW_MESH);       // ticks
+         assertUnit(commands[3].segment == 2);
+         assertUnit(commands[3].pMesh->getPrimitive() == Mesh::LINES);
+         for (size_t i = 4; i < commands.size(); i++)
+            assertUnit(commands[i].kind == DRAW_TEXT);
+      }
+      assertUnit(batches.size() == 4);
+      if (batches.size() == 4 && commands.size() > 4)
+      {
+         assertUnit(batches[0] == commands[0].pMesh);
+         assertUnit(batches[1] == commands[1].pMesh);
+         assertUnit(batches[2]->getPrimitive() == Mesh::TRIANGLES);
+         assertUnit(batches[2]->size() == 6);
+         assertUnit(batches[3] == commands[3].pMesh);
+      }
+   }  // teardown
+};
@@ -0,0 +1,308 @@
+/***********************************************************************
+ * Header File:
+ *    TEST FIRING TABLE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for FiringTable
+ ************************************************************************/
+
+
+#pragma once
+
+#include "firingTable.h"
+#include "projectile.h"
+#include "angle.h"
+#include "unitTest.h"
+#include <sstream>
+#include <string>
+#include <cmath>
+
+
+/*******************************
+ * TEST FIRING TABLE
+ * A friend class for FiringTable which contains its unit tests
+ ********************************/
+class TestFiringTable : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Setup
+      defaultConstructor();
+      customConstructor();
+
+      // Ticket 2: Fire
+      fire_matchesProjectile();
+      fire_straightUp();
+      fire_apex();
+
+      // Ticket 3: Sweep
+      compute_threadsAgree();
+      compute_rangeRisesThenFalls();
+
+      // Ticket 4: Files
+      binary_roundTrip();
+      binary_notATable();
+      binary_hugeCounts();
+      csv_header();
+
+      report("FiringTable");
+   }
+
+private:
+
+   // level ground at the height of the gun
+   struct Flat
+   {
+      double getElevationMeters(const Position&) const { return 0.0; }
+   };
+
+   /*****************************************************************
+    *****************************************************************
+    * SETUP
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    DEFAULT CONSTRUCTOR
+    * input:   step=1 degree
+    * output:  five charges, 86 angles from 0 to 85, top charge 827
+    *********************************************/
+   void defaultConstructor()
+   {  // setup
+      // exercise
+      FiringTable table(1.0);
+      // verify
+      assertUnit(table.getNumCharges() == 5);
+      assertUnit(table.getNumAngles() == 86);
+      assertEquals(table.getAngle(0), MIN_ELEVATION_ANGLE);
+      assertEquals(table.getAngle(85), MAX_ELEVATION_ANGLE);
+      assertEquals(table.getMuzzleVelocity(4), DEFAULT_MUZZLE_VELOCITY);
+      assertEquals(table.get(4, 45).angle, 45.0);
+      assertEquals(table.get(4, 45).muzzleVelocity, DEFAULT_MUZZLE_VELOCITY);
+      assertEquals(table.get(4, 45).range, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CUSTOM CONSTRUCTOR
+    * input:   v={500,600} angles 30 to 60 by 10
+    * output:  two charges, four angles
+    *********************************************/
+   void customConstructor()
+   {  // setup
+      // exercise
+      FiringTable table({ 500.0, 600.0 }, 30.0, 60.0, 10.0);
+      // verify
+      assertUnit(table.getNumCharges() == 2);
+      assertUnit(table.getNumAngles() == 4);
+      assertUnit(table.solutions.size() == 8);
+      assertEquals(table.get(1, 3).angle, 60.0);
+      assertEquals(table.get(1, 3).muzzleVelocity, 600.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FIRE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    FIRE lands where a Projectile lands
+    * input:   827m/s at 45 degrees
+    * output:  within 2m and 0.01s of a 0.01s RK4 Projectile
+    *********************************************/
+   void fire_matchesProjectile()
+   {  // setup
+      Projectile p;
+      p.fire(Position(0.0, 0.0), Angle(45.0), 827.0, 0.0);
+      int i = 1;
+      while (!p.advance<RungeKutta4>((double)i * 0.01, Flat()))
+         i++;
+      // exercise
+      FiringSolution s = FiringTable::fire(45.0, 827.0);
+      // verify
+      assertUnit(fabs(s.range - p.getPosition().getMetersX()) < 2.0);
+      assertUnit(fabs(s.timeOfFlight - p.getFlightTime()) < 0.01);
+      assertUnit(fabs(s.apex - p.getMaxAltitude()) < 2.0);
+      assertUnit(fabs(s.impactVelocity - p.getCurrentSpeed()) < 0.1);
+      assertUnit(s.impactAngle > 45.0 && s.impactAngle < 90.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE straight up
+    * input:   400m/s at 0 degrees
+    * output:  no range, comes straight down
+    *********************************************/
+   void fire_straightUp()
+   {  // setup
+      // exercise
+      FiringSolution s = FiringTable::fire(0.0, 400.0);
+      // verify
+      assertEquals(s.range, 0.0);
+      assertEquals(s.impactAngle, 90.0);
+      assertUnit(s.timeOfFlight > 0.0);
+      assertUnit(s.impactVelocity < 400.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE finds the apex between steps
+    * input:   100m/s straight up, so drag is small
+    * output:  apex close to v^2/2g = 509.7m but below it
+    *********************************************/
+   void fire_apex()
+   {  // setup
+      // exercise
+      FiringSolution s = FiringTable::fire(0.0, 100.0);
+      // verify
+      assertUnit(s.apex < 100.0 * 100.0 / (2.0 * 9.807));
+      assertUnit(s.apex > 490.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * SWEEP
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    COMPUTE gives the same table on any number of threads
+    * input:   two charges, 0 to 85 by 5 degrees, 1 and 4 threads
+    * output:  identical cells
+    *********************************************/
+   void compute_threadsAgree()
+   {  // setup
+      FiringTable one({ 400.0, 827.0 }, 0.0, 85.0, 5.0);
+      FiringTable four({ 400.0, 827.0 }, 0.0, 85.0, 5.0);
+      // exercise
+      one.compute(1);
+      four.compute(4);
+      // verify
+      bool isSame = true;
+      for (size_t i = 0; i < one.solutions.size(); i++)
+         isSame = isSame && one.solutions[i].range == four.solutions[i].range &&
+                            one.solutions[i].apex  == four.solutions[i].apex;
+      assertUnit(isSame);
+      assertUnit(four.get(1, 9).range > 20000.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    COMPUTE range grows and then shrinks with angle
+    * input:   827m/s, 0 to 85 by 5 degrees
+    * output:  zero range straight up, a single peak, every
+    *          shell lands
+    *********************************************/
+   void compute_rangeRisesThenFalls()
+   {  // setup
+      FiringTable table({ 827.0 }, 0.0, 85.0, 5.0);
+      // exercise
+      table.compute();
+      // verify
+      int numTurns = 0;
+      bool isLanded = true;
+      for (size_t row = 1; row < table.getNumAngles(); row++)
+      {
+         isLanded = isLanded && table.get(0, row).timeOfFlight > 0.0;
+         if (row + 1 < table.getNumAngles() &&
+             table.get(0, row).range > table.get(0, row - 1).range &&
+             table.get(0, row).range > table.get(0, row + 1).range)
+            numTurns++;
+      }
+      assertEquals(table.get(0, 0).range, 0.0);
+      assertUnit(numTurns == 1);
+      assertUnit(isLanded);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FILES
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    BINARY write then read
+    * input:   two charges, 0 to 85 by 5 degrees
+    * output:  same shape and cells to float precision
+    *********************************************/
+   void binary_roundTrip()
+   {  // setup
+      FiringTable table({ 400.0, 827.0 }, 0.0, 85.0, 5.0);
+      FiringTable copy({ 100.0 }, 0.0, 0.0, 1.0);
+      table.compute();
+      std::stringstream buffer;
+      // exercise
+      table.writeBinary(buffer);
+      bool isRead = copy.readBinary(buffer);
+      // verify
+      assertUnit(isRead);
+      assertUnit(buffer.str().size() == 4 + 12 + 16 + 2 * 8 + 2 * 18 * 5 * 4);
+      assertUnit(copy.getNumCharges() == 2);
+      assertUnit(copy.getNumAngles() == 18);
+      assertEquals(copy.getMuzzleVelocity(1), 827.0);
+      assertEquals(copy.get(1, 9).angle, 45.0);
+      assertUnit(fabs(copy.get(1, 9).range - table.get(1, 9).range) < 0.01);
+      assertUnit(fabs(copy.get(0, 3).timeOfFlight - table.get(0, 3).timeOfFlight) < 0.001);
+   }  // teardown
+
+   /*********************************************
+    * name:    BINARY rejects something that is not a table
+    * input:   "hello world"
+    * output:  false, table unchanged
+    *********************************************/
+   void binary_notATable()
+   {  // setup
+      FiringTable table({ 100.0 }, 0.0, 10.0, 1.0);
+      std::stringstream buffer("hello world");
+      // exercise
+      bool isRead = table.readBinary(buffer);
+      // verify
+      assertUnit(!isRead);
+      assertUnit(table.getNumAngles() == 11);
+   }  // teardown
+
+   /*********************************************
+    * name:    BINARY rejects counts the data cannot hold
+    * input:   a good header claiming 4 billion charges
+    *          and angles, with one cell after it
+    * output:  false, table unchanged, nothing allocated
+    *********************************************/
+   void binary_hugeCounts()
+   {  // setup
+      FiringTable table({ 100.0 }, 0.0, 10.0, 1.0);
+      uint32_t header[3] = { FIRING_TABLE_VERSION, 0xFFFFFFFF, 0xFFFFFFFF };
+      double angles[2] = { 0.0, 1.0 };
+      float cell[5] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+      std::stringstream buffer;
+      buffer.write(FIRING_TABLE_MAGIC, 4);
+      buffer.write((const char*)header, sizeof(header));
+      buffer.write((const char*)angles, sizeof(angles));
+      buffer.write((const char*)cell, sizeof(cell));
+      // exercise
+      bool isRead = table.readBinary(buffer);
+      // verify
+      assertUnit(!isRead);
+      assertUnit(table.getNumAngles() == 11);
+   }  // teardown
+
+   /*********************************************
+    * name:    CSV header and one line per cell
+    * input:   one charge, 3 angles
+    * output:  4 lines, starting with the column names
+    *********************************************/
+   void csv_header()
+   {  // setup
+      FiringTable table({ 827.0 }, 40.0, 50.0, 5.0);
+      table.compute();
+      std::stringstream buffer;
+      // exercise
+      table.writeCSV(buffer);
+      // verify
+      std::string line;
+      int numLines = 0;
+      std::getline(buffer, line);
+      assertUnit(line == "muzzle_velocity,angle,range,time_of_flight,apex,impact_angle,impact_velocity");
+      while (std::getline(buffer, line))
+         numLines++;
+      assertUnit(numLines == 3);
+   }  // teardown
+};
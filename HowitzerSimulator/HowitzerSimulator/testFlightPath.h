@@ -0,0 +1,283 @@
+/***********************************************************************
+ * Header File:
+ *    TEST FLIGHT PATH
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for FlightPath
+ ************************************************************************/
+
+
+#pragma once
+
+#include "flightPath.h"
+#include "unitTest.h"
+
+
+/*******************************
+ * TEST FLIGHT PATH
+ * A friend class for FlightPath which contains the FlightPath unit tests
+ ********************************/
+class TestFlightPath : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Growing path
+      defaultConstructor();
+      pushBack_first();
+      pushBack_three();
+      pushBack_pastCapacity();
+      clear_keepsMemory();
+
+      // Ticket 2: Ring mode
+      ring_notFull();
+      ring_wrap();
+      ring_iterate();
+      ring_origin();
+      ring_maxAltitude();
+      configure_ring();
+
+      report("FlightPath");
+   }
+
+private:
+
+   // make a state that is easy to recognize
+   PositionVelocityTime state(double t, double y = 0.0)
+   {
+      return PositionVelocityTime(Position(t * 10.0, y), Velocity(t, -t), t);
+   }
+
+   /*****************************************************************
+    *****************************************************************
+    * GROWING PATH
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    DEFAULT CONSTRUCTOR
+    * input:   nothing
+    * output:  empty, not a ring, nothing allocated yet
+    *********************************************/
+   void defaultConstructor()
+   {  // setup
+      // exercise
+      FlightPath path;
+      // verify
+      assertUnit(path.empty());
+      assertUnit(path.size() == 0);
+      assertUnit(!path.isRingMode());
+      assertUnit(path.getCapacity() == DEFAULT_FLIGHT_PATH_CAPACITY);
+      assertUnit(path.buffer.capacity() == 0);
+      assertEquals(path.getMaxAltitude(), 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    PUSH BACK the first state
+    * input:   empty path, t=1
+    * output:  size=1, front=back=origin=t1, capacity reserved
+    *********************************************/
+   void pushBack_first()
+   {  // setup
+      FlightPath path;
+      // exercise
+      path.push_back(state(1.0, 50.0));
+      // verify
+      assertUnit(path.size() == 1);
+      assertEquals(path.front().t, 1.0);
+      assertEquals(path.back().t, 1.0);
+      assertEquals(path.origin().t, 1.0);
+      assertEquals(path.getMaxAltitude(), 50.0);
+      assertUnit(path.buffer.capacity() >= DEFAULT_FLIGHT_PATH_CAPACITY);
+   }  // teardown
+
+   /*********************************************
+    * name:    PUSH BACK three states
+    * input:   empty path, t=1,2,3
+    * output:  chronological order, back=t3
+    *********************************************/
+   void pushBack_three()
+   {  // setup
+      FlightPath path;
+      // exercise
+      path.push_back(state(1.0));
+      path.push_back(state(2.0));
+      path.push_back(state(3.0));
+      // verify
+      assertUnit(path.size() == 3);
+      assertEquals(path[0].t, 1.0);
+      assertEquals(path[1].t, 2.0);
+      assertEquals(path[2].t, 3.0);
+      assertEquals(path.back().pos.getMetersX(), 30.0);
+      assertEquals(path.back().v.getDY(), -3.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    PUSH BACK past the reserved capacity
+    * input:   capacity=2, t=1,2,3,4
+    * output:  a growing path keeps all four
+    *********************************************/
+   void pushBack_pastCapacity()
+   {  // setup
+      FlightPath path(2);
+      // exercise
+      for (int i = 1; i <= 4; i++)
+         path.push_back(state((double)i));
+      // verify
+      assertUnit(path.size() == 4);
+      assertEquals(path.front().t, 1.0);
+      assertEquals(path.back().t, 4.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLEAR a full path
+    * input:   three states
+    * output:  empty, memory still reserved
+    *********************************************/
+   void clear_keepsMemory()
+   {  // setup
+      FlightPath path;
+      path.push_back(state(1.0, 10.0));
+      path.push_back(state(2.0, 20.0));
+      path.push_back(state(3.0, 5.0));
+      const PositionVelocityTime* pBefore = path.buffer.data();
+      // exercise
+      path.clear();
+      // verify
+      assertUnit(path.empty());
+      assertEquals(path.getMaxAltitude(), 0.0);
+      assertUnit(path.buffer.data() == pBefore);
+      assertUnit(path.buffer.capacity() >= DEFAULT_FLIGHT_PATH_CAPACITY);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * RING MODE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    RING that has not filled up yet
+    * input:   ring of 3, t=1,2
+    * output:  both states kept
+    *********************************************/
+   void ring_notFull()
+   {  // setup
+      FlightPath path(3, true /*isRing*/);
+      // exercise
+      path.push_back(state(1.0));
+      path.push_back(state(2.0));
+      // verify
+      assertUnit(path.isRingMode());
+      assertUnit(path.size() == 2);
+      assertEquals(path.front().t, 1.0);
+      assertEquals(path.back().t, 2.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    RING that wraps around
+    * input:   ring of 3, t=1,2,3,4,5
+    * output:  t=3,4,5 kept, nothing new allocated
+    *********************************************/
+   void ring_wrap()
+   {  // setup
+      FlightPath path(3, true /*isRing*/);
+      path.push_back(state(1.0));
+      const PositionVelocityTime* pBefore = path.buffer.data();
+      // exercise
+      for (int i = 2; i <= 5; i++)
+         path.push_back(state((double)i));
+      // verify
+      assertUnit(path.size() == 3);
+      assertEquals(path[0].t, 3.0);
+      assertEquals(path[1].t, 4.0);
+      assertEquals(path[2].t, 5.0);
+      assertEquals(path.front().t, 3.0);
+      assertEquals(path.back().t, 5.0);
+      assertUnit(path.buffer.data() == pBefore);
+   }  // teardown
+
+   /*********************************************
+    * name:    RING iterate after wrapping
+    * input:   ring of 3, t=1..7
+    * output:  iteration visits t=5,6,7 in order
+    *********************************************/
+   void ring_iterate()
+   {  // setup
+      FlightPath path(3, true /*isRing*/);
+      for (int i = 1; i <= 7; i++)
+         path.push_back(state((double)i));
+      double expected = 5.0;
+      int visited = 0;
+      // exercise
+      for (const auto& pvt : path)
+      {
+         // verify
+         assertEquals(pvt.t, expected);
+         expected += 1.0;
+         visited++;
+      }
+      assertUnit(visited == 3);
+   }  // teardown
+
+   /*********************************************
+    * name:    RING remembers the launch state
+    * input:   ring of 2, t=1,2,3
+    * output:  front=t2, origin=t1
+    *********************************************/
+   void ring_origin()
+   {  // setup
+      FlightPath path(2, true /*isRing*/);
+      // exercise
+      path.push_back(state(1.0));
+      path.push_back(state(2.0));
+      path.push_back(state(3.0));
+      // verify
+      assertEquals(path.front().t, 2.0);
+      assertEquals(path.origin().t, 1.0);
+      assertEquals(path.origin().pos.getMetersX(), 10.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    RING remembers the apex after it is dropped
+    * input:   ring of 2, y=100,900,300,200
+    * output:  maxAltitude=900
+    *********************************************/
+   void ring_maxAltitude()
+   {  // setup
+      FlightPath path(2, true /*isRing*/);
+      // exercise
+      path.push_back(state(1.0, 100.0));
+      path.push_back(state(2.0, 900.0));
+      path.push_back(state(3.0, 300.0));
+      path.push_back(state(4.0, 200.0));
+      // verify
+      assertEquals(path.getMaxAltitude(), 900.0);
+      assertEquals(path.front().pos.getMetersY(), 300.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CONFIGURE a full growing path into a ring
+    * input:   three states, then ring of 2
+    * output:  empty ring of 2
+    *********************************************/
+   void configure_ring()
+   {  // setup
+      FlightPath path;
+      path.push_back(state(1.0));
+      path.push_back(state(2.0));
+      path.push_back(state(3.0));
+      // exercise
+      path.configure(2, true /*isRing*/);
+      // verify
+      assertUnit(path.empty());
+      assertUnit(path.isRingMode());
+      assertUnit(path.getCapacity() == 2);
+      path.push_back(state(4.0));
+      path.push_back(state(5.0));
+      path.push_back(state(6.0));
+      assertUnit(path.size() == 2);
+      assertEquals(path.front().t, 5.0);
+   }  // teardown
+};
@@ -0,0 +1,276 @@
+/***********************************************************************
+ * Header File:
+ *    TEST FRAME SCHEDULER
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for FrameScheduler
+ ************************************************************************/
+
+
+#pragma once
+
+#include "frameScheduler.h"
+#include "unitTest.h"
+#include <chrono>
+
+
+/*******************************
+ * TEST FRAME SCHEDULER
+ * A friend class for FrameScheduler which contains its unit tests
+ ********************************/
+class TestFrameScheduler : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Deadlines
+      constructor();
+      frameDone_first();
+      frameDone_onTime();
+      frameDone_late();
+      frameDone_noDrift();
+      waitForDeadline();
+
+      // Ticket 2: Idle
+      isIdle_animating();
+      isIdle_still();
+      wake();
+
+      // Ticket 3: Frame time
+      getFrameSeconds_interval();
+      getFrameSeconds_wake();
+
+      report("FrameScheduler");
+   }
+
+private:
+   typedef FrameScheduler::Clock Clock;
+
+   // A time some milliseconds after an arbitrary start
+   static Clock::time_point at(double ms)
+   {
+      return Clock::time_point(std::chrono::hours(1)) +
+         std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(ms));
+   }
+
+   // How far apart two times are, in milliseconds
+   static double ms(Clock::time_point a, Clock::time_point b)
+   {
+      return std::chrono::duration<double, std::milli>(a - b).count();
+   }
+
+   /*****************************************************************
+    *****************************************************************
+    * DEADLINES
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    CONSTRUCTOR
+    * input:   50 frames per second
+    * output:  20ms apart, nothing counted yet
+    *********************************************/
+   void constructor()
+   {  // setup
+      // exercise
+      FrameScheduler scheduler(50.0);
+      // verify
+      assertEquals(scheduler.getPeriod(), 0.02);
+      assertUnit(scheduler.deadline == Clock::time_point());
+      assertUnit(scheduler.getNumFrames() == 0);
+      assertUnit(scheduler.getNumMissed() == 0);
+      assertUnit(!scheduler.isIdle());
+   }  // teardown
+
+   /*********************************************
+    * name:    FRAME DONE the first time
+    * input:   a frame at 0ms, 50 frames per second
+    * output:  the next is due at 20ms
+    *********************************************/
+   void frameDone_first()
+   {  // setup
+      FrameScheduler scheduler(50.0);
+      // exercise
+      scheduler.frameDone(at(0.0), true);
+      // verify
+      assertEquals(ms(scheduler.getDeadline(), at(0.0)), 20.0);
+      assertUnit(scheduler.getNumFrames() == 1);
+      assertUnit(scheduler.getNumMissed() == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FRAME DONE a little after it was due
+    * input:   frames at 0ms and 25ms
+    * output:  the next is due at 40ms, none missed
+    *********************************************/
+   void frameDone_onTime()
+   {  // setup
+      FrameScheduler scheduler(50.0);
+      scheduler.frameDone(at(0.0), true);
+      // exercise
+      scheduler.frameDone(at(25.0), true);
+      // verify
+      assertEquals(ms(scheduler.getDeadline(), at(0.0)), 40.0);
+      assertUnit(scheduler.getNumMissed() == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FRAME DONE long after it was due
+    * input:   frames at 0ms and 75ms
+    * output:  the 40ms and 60ms deadlines missed,
+    *          the next due at 80ms
+    *********************************************/
+   void frameDone_late()
+   {  // setup
+      FrameScheduler scheduler(50.0);
+      scheduler.frameDone(at(0.0), true);
+      // exercise
+      scheduler.frameDone(at(75.0), true);
+      // verify
+      assertEquals(ms(scheduler.getDeadline(), at(0.0)), 80.0);
+      assertUnit(scheduler.getNumMissed() == 2);
+      assertUnit(scheduler.getNumFrames() == 2);
+   }  // teardown
+
+   /*********************************************
+    * name:    FRAME DONE always a bit late
+    * input:   100 frames, each 3ms after its deadline
+    * output:  still on the 20ms grid: due at 2020ms
+    *********************************************/
+   void frameDone_noDrift()
+   {  // setup
+      FrameScheduler scheduler(50.0);
+      scheduler.frameDone(at(0.0), true);
+      // exercise
+      for (int i = 1; i <= 100; i++)
+         scheduler.frameDone(at(20.0 * i + 3.0), true);
+      // verify
+      assertEquals(ms(scheduler.getDeadline(), at(0.0)), 2020.0);
+      assertUnit(scheduler.getNumMissed() == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    WAIT FOR DEADLINE
+    * input:   a deadline 5ms from now
+    * output:  returns no sooner than the deadline
+    *********************************************/
+   void waitForDeadline()
+   {  // setup
+      FrameScheduler scheduler(200.0);
+      Clock::time_point start = Clock::now();
+      scheduler.frameDone(start, true);
+      // exercise
+      scheduler.waitForDeadline();
+      // verify
+      Clock::time_point end = Clock::now();
+      assertUnit(ms(end, start) >= 5.0);
+      assertUnit(ms(end, start) < 500.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * IDLE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    IS IDLE while animating
+    * input:   100 frames with something moving
+    * output:  not idle
+    *********************************************/
+   void isIdle_animating()
+   {  // setup
+      FrameScheduler scheduler(50.0);
+      // exercise
+      for (int i = 0; i < 100; i++)
+         scheduler.frameDone(at(20.0 * i), true);
+      // verify
+      assertUnit(!scheduler.isIdle());
+   }  // teardown
+
+   /*********************************************
+    * name:    IS IDLE once still
+    * input:   one frame moving, then still ones
+    * output:  idle after FRAMES_BEFORE_IDLE, not before
+    *********************************************/
+   void isIdle_still()
+   {  // setup
+      FrameScheduler scheduler(50.0);
+      scheduler.frameDone(at(0.0), true);
+      // exercise
+      for (int i = 1; i < FRAMES_BEFORE_IDLE; i++)
+         scheduler.frameDone(at(20.0 * i), false);
+      bool isIdleBefore = scheduler.isIdle();
+      scheduler.frameDone(at(20.0 * FRAMES_BEFORE_IDLE), false);
+      // verify
+      assertUnit(!isIdleBefore);
+      assertUnit(scheduler.isIdle());
+   }  // teardown
+
+   /*********************************************
+    * name:    WAKE after blocking
+    * input:   idle at 300ms, wake at 10000ms, a
+    *          frame at 10005ms
+    *
+    * output:  not idle, nothing missed, next due at
+    *          10020ms
+    *********************************************/
+   void wake()
+   {  // setup
+      FrameScheduler scheduler(50.0);
+      for (int i = 0; i <= FRAMES_BEFORE_IDLE; i++)
+         scheduler.frameDone(at(20.0 * i), false);
+      // exercise
+      scheduler.wake(at(10000.0));
+      bool isIdle = scheduler.isIdle();
+      scheduler.frameDone(at(10005.0), false);
+      // verify
+      assertUnit(!isIdle);
+      assertUnit(scheduler.getNumMissed() == 0);
+      assertEquals(ms(scheduler.getDeadline(), at(0.0)), 10020.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * FRAME TIME
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    GET FRAME SECONDS between frames
+    * input:   frames at 0ms and 75ms
+    * output:  0 after the first, 0.075 after the second
+    *********************************************/
+   void getFrameSeconds_interval()
+   {  // setup
+      FrameScheduler scheduler(50.0);
+      // exercise
+      scheduler.frameDone(at(0.0), true);
+      double first = scheduler.getFrameSeconds();
+      scheduler.frameDone(at(75.0), true);
+      // verify
+      assertEquals(first, 0.0);
+      assertEquals(scheduler.getFrameSeconds(), 0.075);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET FRAME SECONDS after blocking
+    * input:   a frame at 0ms, wake at 10000ms, frames
+    *          at 10005ms and 10025ms
+    * output:  0 for the first after the wait, then 0.02
+    *********************************************/
+   void getFrameSeconds_wake()
+   {  // setup
+      FrameScheduler scheduler(50.0);
+      scheduler.frameDone(at(0.0), false);
+      // exercise
+      scheduler.wake(at(10000.0));
+      scheduler.frameDone(at(10005.0), true);
+      double afterWake = scheduler.getFrameSeconds();
+      scheduler.frameDone(at(10025.0), true);
+      // verify
+      assertEquals(afterWake, 0.0);
+      assertEquals(scheduler.getFrameSeconds(), 0.02);
+   }  // teardown
+};
@@ -0,0 +1,228 @@
+/***********************************************************************
+ * Header File:
+ *    TEST FRAME STATS
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for FrameStats
+ ************************************************************************/
+
+
+#pragma once
+
+#include "frameStats.h"
+#include "unitTest.h"
+#include <cstring>
+
+
+/*******************************
+ * TEST FRAME STATS
+ * A friend class for FrameStats which contains its unit tests
+ ********************************/
+class TestFrameStats : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Rolling figures
+      constructor();
+      addFrame_first();
+      addFrame_averages();
+      addFrame_noTime();
+      addFrame_window();
+
+      // Ticket 2: Histogram
+      bucketOf();
+      getBucketName();
+      histogram_window();
+
+      report("FrameStats");
+   }
+
+private:
+
+   // Running totals so far
+   static FrameCounters totals(uint64_t numSteps, uint64_t updateNanoseconds,
+                               uint64_t numDrawCalls)
+   {
+      FrameCounters counters;
+      counters.numSteps = numSteps;
+      counters.updateNanoseconds = updateNanoseconds;
+      counters.numDrawCalls = numDrawCalls;
+      return counters;
+   }
+
+   /*****************************************************************
+    *****************************************************************
+    * ROLLING FIGURES
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    CONSTRUCTOR
+    * input:   nothing
+    * output:  no frames, every figure zero
+    *********************************************/
+   void constructor()
+   {  // setup
+      // exercise
+      FrameStats stats;
+      // verify
+      assertUnit(stats.getNumFrames() == 0);
+      assertEquals(stats.getFrameSeconds(), 0.0);
+      assertEquals(stats.getFramesPerSecond(), 0.0);
+      assertEquals(stats.getUpdateSecondsPerFrame(), 0.0);
+      assertEquals(stats.getStepsPerSecond(), 0.0);
+      assertEquals(stats.getDrawCallsPerFrame(), 0.0);
+      for (int i = 0; i < FRAME_STATS_BUCKETS; i++)
+         assertUnit(stats.getBucket(i) == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD FRAME the first time
+    * input:   a 20ms frame, counters already at 5 steps
+    * output:  only the reading is taken: no frames
+    *********************************************/
+   void addFrame_first()
+   {  // setup
+      FrameStats stats;
+      // exercise
+      stats.addFrame(0.02, totals(5, 1000, 3));
+      // verify
+      assertUnit(stats.getNumFrames() == 0);
+      assertUnit(stats.isPrimed);
+      assertUnit(stats.previous.numSteps == 5);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD FRAME twice after the first
+    * input:   20ms with 2 steps, 1ms of physics and
+    *          4 draw calls, then 30ms with 3 steps,
+    *          2ms of physics and 6 draw calls
+    * output:  25ms, 40 fps, 1.5ms of physics and 5 draw
+    *          calls a frame, 100 steps a second
+    *********************************************/
+   void addFrame_averages()
+   {  // setup
+      FrameStats stats;
+      stats.addFrame(0.0, totals(10, 5000000, 100));
+      // exercise
+      stats.addFrame(0.02, totals(12, 6000000, 104));
+      stats.addFrame(0.03, totals(15, 8000000, 110));
+      // verify
+      assertUnit(stats.getNumFrames() == 2);
+      assertEquals(stats.getFrameSeconds(), 0.025);
+      assertEquals(stats.getFramesPerSecond(), 40.0);
+      assertEquals(stats.getUpdateSecondsPerFrame(), 0.0015);
+      assertEquals(stats.getStepsPerSecond(), 100.0);
+      assertEquals(stats.getDrawCallsPerFrame(), 5.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD FRAME with no frame time
+    * input:   a frame, a frame of zero seconds with 50
+    *          steps, then a 20ms frame with 1 step
+    * output:  the steps of the zero frame are not
+    *          counted against the next: 2 frames of
+    *          1 step
+    *********************************************/
+   void addFrame_noTime()
+   {  // setup
+      FrameStats stats;
+      stats.addFrame(0.0, totals(0, 0, 0));
+      stats.addFrame(0.02, totals(1, 0, 0));
+      // exercise
+      stats.addFrame(0.0, totals(51, 0, 0));
+      stats.addFrame(0.02, totals(52, 0, 0));
+      // verify
+      assertUnit(stats.getNumFrames() == 2);
+      assertEquals(stats.getStepsPerSecond(), 50.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD FRAME past the window
+    * input:   a window of 10ms frames of 1 draw call,
+    *          then a window of 20ms frames of 3
+    * output:  only the second window is left
+    *********************************************/
+   void addFrame_window()
+   {  // setup
+      FrameStats stats;
+      uint64_t numDrawCalls = 0;
+      stats.addFrame(0.0, totals(0, 0, numDrawCalls));
+      for (int i = 0; i < FRAME_STATS_WINDOW; i++)
+         stats.addFrame(0.01, totals(0, 0, numDrawCalls += 1));
+      // exercise
+      for (int i = 0; i < FRAME_STATS_WINDOW; i++)
+         stats.addFrame(0.02, totals(0, 0, numDrawCalls += 3));
+      // verify
+      assertUnit(stats.getNumFrames() == FRAME_STATS_WINDOW);
+      assertEquals(stats.getFrameSeconds(), 0.02);
+      assertEquals(stats.getDrawCallsPerFrame(), 3.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * HISTOGRAM
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    BUCKET OF
+    * input:   frame times around the bucket limits
+    * output:  the first bucket whose top is above
+    *********************************************/
+   void bucketOf()
+   {  // setup
+      // exercise
+      // verify
+      assertUnit(FrameStats::bucketOf(0) == 0);
+      assertUnit(FrameStats::bucketOf(8999999) == 0);
+      assertUnit(FrameStats::bucketOf(9000000) == 1);
+      assertUnit(FrameStats::bucketOf(33333333) == 3);
+      assertUnit(FrameStats::bucketOf(66666667) == 5);
+      assertUnit(FrameStats::bucketOf(5000000000ull) == FRAME_STATS_BUCKETS - 1);
+      for (int i = 1; i < FRAME_STATS_BUCKETS; i++)
+         assertUnit(FrameStats::getBucketLimit(i - 1) < FrameStats::getBucketLimit(i));
+   }  // teardown
+
+   /*********************************************
+    * name:    GET BUCKET NAME
+    * input:   every bucket
+    * output:  a name for each
+    *********************************************/
+   void getBucketName()
+   {  // setup
+      // exercise
+      // verify
+      assertUnit(strcmp(FrameStats::getBucketName(0), "<9") == 0);
+      assertUnit(strcmp(FrameStats::getBucketName(FRAME_STATS_BUCKETS - 1), "100+") == 0);
+      for (int i = 0; i < FRAME_STATS_BUCKETS; i++)
+         assertUnit(strlen(FrameStats::getBucketName(i)) > 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    HISTOGRAM past the window
+    * input:   a window of 33ms frames, then half a
+    *          window of 70ms frames
+    * output:  half in each bucket, adding up to the
+    *          window
+    *********************************************/
+   void histogram_window()
+   {  // setup
+      FrameStats stats;
+      stats.addFrame(0.0, FrameCounters());
+      for (int i = 0; i < FRAME_STATS_WINDOW; i++)
+         stats.addFrame(0.033, FrameCounters());
+      // exercise
+      for (int i = 0; i < FRAME_STATS_WINDOW / 2; i++)
+         stats.addFrame(0.070, FrameCounters());
+      // verify
+      assertUnit(stats.getBucket(FrameStats::bucketOf(33000000)) == FRAME_STATS_WINDOW / 2);
+      assertUnit(stats.getBucket(FrameStats::bucketOf(70000000)) == FRAME_STATS_WINDOW / 2);
+      int total = 0;
+      for (int i = 0; i < FRAME_STATS_BUCKETS; i++)
+         total += stats.getBucket(i);
+      assertUnit(total == FRAME_STATS_WINDOW);
+   }  // teardown
+};
@@ -0,0 +1,216 @@
+/***********************************************************************
+ * Header File:
+ *    TEST GLYPH ATLAS
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for GlyphAtlas
+ ************************************************************************/
+
+
+#pragma once
+
+#include "glyphAtlas.h"
+#include "unitTest.h"
+
+
+/*******************************
+ * TEST GLYPH ATLAS
+ * A friend class for GlyphAtlas which contains its unit tests
+ ********************************/
+class TestGlyphAtlas : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Layout
+      size();
+      contains();
+      getOrigin_first();
+      getOrigin_secondRow();
+      advance_default();
+
+      // Ticket 2: Text
+      addText_empty();
+      addText_one();
+      addText_space();
+      addText_advance();
+
+      report("GlyphAtlas");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * LAYOUT
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    SIZE
+    * input:   nothing
+    * output:  256 x 256, room for every character
+    *********************************************/
+   void size()
+   {  // setup
+      // exercise
+      int width = GlyphAtlas::getWidth();
+      int height = GlyphAtlas::getHeight();
+      // verify
+      assertUnit(width == 256);
+      assertUnit(height == 256);
+      assertUnit((GLYPH_LAST - GLYPH_FIRST + 1) * GLYPH_CELL_WIDTH * GLYPH_CELL_HEIGHT
+                 <= width * height);
+   }  // teardown
+
+   /*********************************************
+    * name:    CONTAINS
+    * input:   '\n', ' ', 'A', '~', 0xB0
+    * output:  all but the newline
+    *********************************************/
+   void contains()
+   {  // setup
+      // exercise
+      // verify
+      assertUnit(!GlyphAtlas::contains('\n'));
+      assertUnit(GlyphAtlas::contains(' '));
+      assertUnit(GlyphAtlas::contains('A'));
+      assertUnit(GlyphAtlas::contains('~'));
+      assertUnit(GlyphAtlas::contains(0xB0));
+   }  // teardown
+
+   /*********************************************
+    * name:    GET ORIGIN of the first character
+    * input:   ' '
+    * output:  the bottom left cell, in from its corner
+    *********************************************/
+   void getOrigin_first()
+   {  // setup
+      // exercise
+      PT origin = GlyphAtlas::getOrigin(' ');
+      // verify
+      assertEquals(origin.x, (double)GLYPH_LEFT);
+      assertEquals(origin.y, (double)GLYPH_DESCENT);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET ORIGIN on the second row
+    * input:   '1', the 18th character
+    * output:  second row, second column
+    *********************************************/
+   void getOrigin_secondRow()
+   {  // setup
+      // exercise
+      PT origin = GlyphAtlas::getOrigin('1');
+      // verify
+      assertEquals(origin.x, (double)(GLYPH_CELL_WIDTH + GLYPH_LEFT));
+      assertEquals(origin.y, (double)(GLYPH_CELL_HEIGHT + GLYPH_DESCENT));
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE before the font is baked
+    * input:   'A', then set to 7
+    * output:  0, then 7; a newline is always 0
+    *********************************************/
+   void advance_default()
+   {  // setup
+      GlyphAtlas atlas;
+      // exercise
+      int before = atlas.getAdvance('A');
+      atlas.setAdvance('A', 7);
+      // verify
+      assertUnit(before == 0);
+      assertUnit(atlas.getAdvance('A') == 7);
+      assertUnit(atlas.getAdvance('\n') == 0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * TEXT
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    ADD TEXT with nothing
+    * input:   ""
+    * output:  no vertices, no width
+    *********************************************/
+   void addText_empty()
+   {  // setup
+      GlyphAtlas atlas;
+      std::vector<GlyphVertex> vertices;
+      // exercise
+      double width = atlas.addText(vertices, PT(10.0, 20.0), "");
+      // verify
+      assertUnit(vertices.empty());
+      assertEquals(width, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD TEXT one character
+    * input:   "!" at (10, 20)
+    * output:  two triangles covering its cell
+    *********************************************/
+   void addText_one()
+   {  // setup
+      GlyphAtlas atlas;
+      atlas.setAdvance('!', 4);
+      std::vector<GlyphVertex> vertices;
+      // exercise
+      double width = atlas.addText(vertices, PT(10.0, 20.0), "!");
+      // verify
+      assertUnit(vertices.size() == 6);
+      assertEquals(width, 4.0);
+      if (vertices.size() == 6)
+      {
+         // bottom left: the cell of '!' is the second of the first row
+         assertEquals(vertices[0].x, 10.0 - GLYPH_LEFT);
+         assertEquals(vertices[0].y, 20.0 - GLYPH_DESCENT);
+         assertEquals(vertices[0].u, 16.0 / 256.0);
+         assertEquals(vertices[0].v, 0.0);
+         // top right
+         assertEquals(vertices[2].x, 10.0 - GLYPH_LEFT + GLYPH_CELL_WIDTH);
+         assertEquals(vertices[2].y, 20.0 - GLYPH_DESCENT + GLYPH_CELL_HEIGHT);
+         assertEquals(vertices[2].u, 32.0 / 256.0);
+         assertEquals(vertices[2].v, 16.0 / 256.0);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD TEXT space
+    * input:   " " with an advance of 3
+    * output:  no vertices, 3 wide
+    *********************************************/
+   void addText_space()
+   {  // setup
+      GlyphAtlas atlas;
+      atlas.setAdvance(' ', 3);
+      std::vector<GlyphVertex> vertices;
+      // exercise
+      double width = atlas.addText(vertices, PT(0.0, 0.0), "   ");
+      // verify
+      assertUnit(vertices.empty());
+      assertEquals(width, 9.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD TEXT two characters
+    * input:   "AB" at (0, 0), A is 8 wide
+    * output:  B starts 8 pixels after A
+    *********************************************/
+   void addText_advance()
+   {  // setup
+      GlyphAtlas atlas;
+      atlas.setAdvance('A', 8);
+      atlas.setAdvance('B', 7);
+      std::vector<GlyphVertex> vertices;
+      // exercise
+      double width = atlas.addText(vertices, PT(0.0, 0.0), "AB");
+      // verify
+      assertUnit(vertices.size() == 12);
+      assertEquals(width, 15.0);
+      if (vertices.size() == 12)
+         assertEquals(vertices[6].x - vertices[0].x, 8.0);
+   }  // teardown
+};
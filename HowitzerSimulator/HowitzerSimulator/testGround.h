@@ -11,6 +11,7 @@
 #pragma once
 
 #include "ground.h"
+#include "uiDraw.h"
 #include "unitTest.h"
 #include <vector>
 
@@ -35,15 +36,17 @@ public:
       getTarget_two();
       getTarget_seven();
       draw();
+      buildMesh_terrain();
+      buildMesh_grid();
 
       // setter
       reset_ten();
+      reset_mesh();
 
       report("Ground");
    }
 
 private:
-   double metersFromPixels = -1.0;
 
    /*****************************************************************
     *****************************************************************
@@ -58,22 +61,16 @@ private:
      *********************************************/
    void constructor()
    {  // setup
-      Position posUpperRight;
-      double metersFromPixels = posUpperRight.metersFromPixels;
-      posUpperRight.metersFromPixels = 1100.0;
-      posUpperRight.x = 4400; // 4px
-      posUpperRight.y = 5500; // 5px
+      Viewport viewport(1100.0, 4.0, 5.0);
       // exercise
-      Ground g(posUpperRight);
+      Ground g(viewport);
       // verify
       assertUnit(g.iHowitzer == 0);
       assertUnit(g.ground != nullptr);
-      assertEquals(g.posUpperRight.x, 4400);
-      assertEquals(g.posUpperRight.y, 5500);
-      assertEquals(posUpperRight.x, 4400);
-      assertEquals(posUpperRight.y, 5500);
-      // teardown
-      posUpperRight.metersFromPixels = metersFromPixels;
+      assertEquals(g.viewport.getUpperRight().getMetersX(), 4400);
+      assertEquals(g.viewport.getUpperRight().getMetersY(), 5500);
+      assertEquals(viewport.getWidthPixels(), 4);
+      assertEquals(viewport.getHeightPixels(), 5);
    }  // teardown
 
    /*****************************************************************
@@ -171,93 +168,105 @@ private:
       teardownStandardFixture(g);
    }
 
-   // Spy to see exactly what ogstream::draw*() methods are called... and how.
-   class ogstreamSpy : public ogstreamDummy
-   {
-   public:
-      // ignore lines
-      void drawLine(const Position& begin, const Position& end,
-         double red, double green, double blue) { }
-      // ignore text
-      void drawText(const Position& topLeft, const char* text) { }
-      // flush is a no-op
-      void flush() { }
-      // remember target
-      void drawTarget(const Position& pos)
+   /*********************************************
+    * name:    DRAW
+    * input:   standard
+    * output:  three meshes, the target and the
+    *          labels, and no shapes one at a time
+    *********************************************/
+   void draw()
+   {  // setup
+      Position pos;
+      Ground g;
+      setupStandardFixture(g);
+      g.buildMesh();
+      ogstreamRecorder gout(g.viewport, pos);
+      // exercise
+      g.draw(gout);
+      // verify
+      const vector<DrawCommand>& commands = gout.getDrawList().getCommands();
+      assertUnit(commands.size() == 4 + g.labels.size());
+      if (commands.size() == 4 + g.labels.size())
       {
-         targets.push_back(pos);
+         assertUnit(commands[0].kind == DRAW_MESH);
+         assertUnit(commands[0].pMesh == &g.grid);
+         assertUnit(commands[1].kind == DRAW_MESH);
+         assertUnit(commands[1].pMesh == &g.terrain);
+         assertUnit(commands[2].kind == DRAW_RECTANGLE);   // the target
+         assertEquals(commands[2].x, 2.0);                 // 7px - 5px
+         assertEquals(commands[2].y, -3.0);                // 2px - 5px
+         assertUnit(commands[3].kind == DRAW_MESH);
+         assertUnit(commands[3].pMesh == &g.ticks);
+         for (size_t i = 4; i < commands.size(); i++)
+            assertUnit(commands[i].kind == DRAW_TEXT);
       }
-      // remember rectangles
-      void drawRectangle(const Position& begin, const Position& end,
-         double red, double green, double blue)
+      verifyStandardFixture(g);
+      // teardown
+      teardownStandardFixture(g);
+   }
+
+   /*********************************************
+    * name:    BUILD MESH
+    * input:   standard
+    * output:  a rectangle from the bottom to the
+    *          top of each of the ten columns
+    *********************************************/
+   void buildMesh_terrain()
+   {  // setup
+      Ground g;
+      setupStandardFixture(g);
+      // exercise
+      g.buildMesh();
+      // verify
+      const vector<Vertex>& v = g.terrain.getVertices();
+      assertUnit(v.size() == 60);
+      if (v.size() == 60)
       {
-         rectanglesBegin.push_back(begin);
-         rectanglesEnd.push_back(end);
+         assertEquals(v[0].x, 0.0);   // column 0, bottom left
+         assertEquals(v[0].y, 0.0);
+         assertEquals(v[2].x, 1.0);   // column 0, top right
+         assertEquals(v[2].y, 9.0);
+         assertEquals(v[6].x, 1.0);   // column 1, bottom left
+         assertEquals(v[6].y, 0.0);
+         assertEquals(v[8].x, 2.0);   // column 1, top right
+         assertEquals(v[8].y, 8.0);
+         assertEquals(v[54].x, 9.0);  // column 9, bottom left
+         assertEquals(v[54].y, 0.0);
+         assertEquals(v[56].x, 10.0); // column 9, top right
+         assertEquals(v[56].y, 0.0);
+         assertEquals(v[0].red, 0.6);
+         assertEquals(v[0].green, 0.4);
+         assertEquals(v[0].blue, 0.2);
       }
-      vector <Position>  targets;
-      vector <Position>  rectanglesBegin;
-      vector <Position>  rectanglesEnd;
-   };
+      verifyStandardFixture(g);
+      // teardown
+      teardownStandardFixture(g);
+   }
 
    /*********************************************
-    * name:    DRAW
-    * input:   standard
-    * output:  check the retangles
+    * name:    BUILD MESH grid and labels
+    * input:   standard, 11000m x 11000m
+    * output:  ten altitude lines, ten kilometer
+    *          ticks, 2 kilometer labels (5km, 10km)
+    *          and 5 altitude labels (2000m - 10000m)
     *********************************************/
-   void draw()
+   void buildMesh_grid()
    {  // setup
-      Position pos;
       Ground g;
       setupStandardFixture(g);
-      ogstreamSpy goutSpy;
       // exercise
-      g.draw(goutSpy);
+      g.buildMesh();
       // verify
-      assertUnit(goutSpy.targets.size() == 1);
-      assertUnit(0.0 <= goutSpy.targets.front().x && goutSpy.targets.front().x < 11000.0);
-      assertUnit(0.0 <= goutSpy.targets.front().y && goutSpy.targets.front().y < 11000.0);
-      assertUnit(goutSpy.rectanglesBegin.size() == 10);
-      assertUnit(goutSpy.rectanglesEnd.size() == 10);
-      assertEquals(goutSpy.rectanglesBegin[0].x, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[1].x, 1100.0);
-      assertEquals(goutSpy.rectanglesBegin[2].x, 2200.0);
-      assertEquals(goutSpy.rectanglesBegin[3].x, 3300.0);
-      assertEquals(goutSpy.rectanglesBegin[4].x, 4400.0);
-      assertEquals(goutSpy.rectanglesBegin[5].x, 5500.0);
-      assertEquals(goutSpy.rectanglesBegin[6].x, 6600.0);
-      assertEquals(goutSpy.rectanglesBegin[7].x, 7700.0);
-      assertEquals(goutSpy.rectanglesBegin[8].x, 8800.0);
-      assertEquals(goutSpy.rectanglesBegin[9].x, 9900.0);
-      assertEquals(goutSpy.rectanglesBegin[0].y, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[1].y, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[2].y, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[3].y, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[4].y, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[5].y, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[6].y, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[7].y, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[8].y, 0.0);
-      assertEquals(goutSpy.rectanglesBegin[9].y, 0.0);
-      assertEquals(goutSpy.rectanglesEnd[0].x, 1100.0);
-      assertEquals(goutSpy.rectanglesEnd[1].x, 2200.0);
-      assertEquals(goutSpy.rectanglesEnd[2].x, 3300.0);
-      assertEquals(goutSpy.rectanglesEnd[3].x, 4400.0);
-      assertEquals(goutSpy.rectanglesEnd[4].x, 5500.0);
-      assertEquals(goutSpy.rectanglesEnd[5].x, 6600.0);
-      assertEquals(goutSpy.rectanglesEnd[6].x, 7700.0);
-      assertEquals(goutSpy.rectanglesEnd[7].x, 8800.0);
-      assertEquals(goutSpy.rectanglesEnd[8].x, 9900.0);
-      assertEquals(goutSpy.rectanglesEnd[9].x, 11000.0);
-      assertEquals(goutSpy.rectanglesEnd[0].y, 9900.0);
-      assertEquals(goutSpy.rectanglesEnd[1].y, 8800.0);
-      assertEquals(goutSpy.rectanglesEnd[2].y, 7700.0);
-      assertEquals(goutSpy.rectanglesEnd[3].y, 6600.0);
-      assertEquals(goutSpy.rectanglesEnd[4].y, 5500.0);
-      assertEquals(goutSpy.rectanglesEnd[5].y, 4400.0);
-      assertEquals(goutSpy.rectanglesEnd[6].y, 3300.0);
-      assertEquals(goutSpy.rectanglesEnd[7].y, 2200.0);
-      assertEquals(goutSpy.rectanglesEnd[8].y, 1100.0);
-      assertEquals(goutSpy.rectanglesEnd[9].y, 0.0);
+      assertUnit(g.grid.size() == 20);
+      assertUnit(g.ticks.size() == 20);
+      assertUnit(g.labels.size() == 7);
+      if (g.labels.size() == 7)
+      {
+         assertUnit(g.labels[0].text == "5km");
+         assertUnit(g.labels[1].text == "10km");
+         assertUnit(g.labels[2].text == "2000m");
+         assertUnit(g.labels[6].text == "10000m");
+      }
       verifyStandardFixture(g);
       // teardown
       teardownStandardFixture(g);
@@ -287,8 +296,8 @@ private:
       // verify
       assertUnit(g.iHowitzer == 3);
       assertUnit(g.iTarget >= 0 && g.iTarget < 10);
-      assertEquals(g.posUpperRight.x, 11000.0);  // 10px
-      assertEquals(g.posUpperRight.y, 11000.0);  // 10px
+      assertEquals(g.viewport.getWidthPixels(), 10.0);
+      assertEquals(g.viewport.getHeightPixels(), 10.0);
       assertUnit(g.ground != nullptr);
       if (g.ground != nullptr)
       {
@@ -309,6 +318,33 @@ private:
 
 
 
+   /*********************************************
+    * name:    RESET builds the meshes
+    * input:   (3300, 4400)
+    * output:  a rectangle for each column
+    *********************************************/
+   void reset_mesh()
+   {  // setup
+      Position posHowitzer;
+      Ground g;
+      setupStandardFixture(g);
+      posHowitzer.x = 3300.0;  // 3px
+      posHowitzer.y = 4400.0;  // 4px
+      // exercise
+      g.reset(posHowitzer, 1);
+      // verify
+      assertUnit(g.terrain.size() == 60);
+      assertUnit(!g.grid.empty());
+      assertUnit(!g.ticks.empty());
+      assertUnit(!g.labels.empty());
+      if (g.terrain.size() == 60)
+         assertEquals(g.terrain.getVertices()[2].y, g.ground[0]);
+      // teardown
+      teardownStandardFixture(g);
+   }
+
+
+
    /*****************************************************************
     *****************************************************************
     * STANDARD FIXTURE
@@ -319,9 +355,6 @@ private:
    // standard fixture: 10 x 10 with howitzer at 5 and target at 7
    void setupStandardFixture(Ground& g)
    {
-      metersFromPixels = g.posUpperRight.metersFromPixels;
-      g.posUpperRight.metersFromPixels = 1100.0;
-
       // delete the old
       if (g.ground != nullptr)
          delete [] g.ground;
@@ -330,8 +363,7 @@ private:
       for (int i = 0; i < 10; i++)
          g.ground[i] = 9.0 - (double)i;
 
-      g.posUpperRight.x = 11000.0;   // 10 pixels
-      g.posUpperRight.y = 11000.0;   // 10 pixels
+      g.viewport = Viewport(1100.0, 10.0, 10.0);   // 11000m is 10 pixels
       g.iHowitzer = 5;
       g.iTarget = 7;
    }
@@ -341,9 +373,9 @@ private:
    {
       assertUnit(g.iHowitzer == 5);
       assertUnit(g.iTarget == 7);
-      assertEquals(g.posUpperRight.x, 11000.0);
-      assertEquals(g.posUpperRight.y, 11000.0);
-      assertEquals(g.posUpperRight.metersFromPixels, 1100.0);
+      assertEquals(g.viewport.getWidthPixels(), 10.0);
+      assertEquals(g.viewport.getHeightPixels(), 10.0);
+      assertEquals(g.viewport.getZoom(), 1100.0);
       assert(g.ground != nullptr);
       if (g.ground != nullptr)
       {
@@ -360,10 +392,9 @@ private:
       }
    }
 
-   // standard fixture: teardown
-   void teardownStandardFixture(Ground& g)
+   // standard fixture: teardown. The zoom belongs to g's own viewport,
+   // so there is no static to restore
+   void teardownStandardFixture(Ground&)
    {
-      assertUnit(-1.0 != metersFromPixels);
-      g.posUpperRight.metersFromPixels = metersFromPixels;
    }
 };
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "howitzer.h"
+#include "firingTable.h"
 #include "unitTest.h"
 
 /*******************************
@@ -35,6 +36,7 @@ public:
       // Ticket 2: Setters
       generatePosition_small();
       generatePosition_large();
+      generatePosition_seeded();
       raise_rightDown();
       raise_rightUp();
       raise_leftDown();
@@ -44,11 +46,19 @@ public:
       rotate_wrapClock();
       rotate_wrapCounterClock();
       
+      // Ticket 3: Range estimates
+      estimateRange_standard();
+      estimateRange_left();
+      estimateRange_cached();
+      estimateAngleForRange_low();
+      estimateAngleForRange_left();
+      estimateAngleForRange_tooFar();
+      estimateAnglesForRange_both();
+      
       report("Howitzer");
    }
    
 private:
-   double metersFromPixels = -1.0;
    
    /*****************************************************************
     *****************************************************************
@@ -278,6 +288,27 @@ private:
       assert(h.position.y == 0);
    }
    
+   /*********************************************
+    * name:    GENERATE POSITION from a seed
+    * input:   (1000px, 1000px) seeds 7, 7 and 8
+    * output:  the same seed gives the same x, another seed another
+    *********************************************/
+   void generatePosition_seeded()
+   {  // setup
+      Howitzer h1;
+      Howitzer h2;
+      Howitzer h3;
+      Position position(1000 * 1100, 1000 * 1100);
+      // exercise
+      h1.generatePosition(position, 7);
+      h2.generatePosition(position, 7);
+      h3.generatePosition(position, 8);
+      // verify
+      assertEquals(h1.position.x, h2.position.x);
+      assertUnit(h1.position.x != h3.position.x);
+      assertUnit(h1.position.x / 1100 >= 100 && h1.position.x / 1100 <= 900);
+   }  // teardown
+   
    /*********************************************
     * name:    RAISE to the right/down
     * input:   h.elevation=0.5radians  raise(-0.1)
@@ -408,23 +439,128 @@ private:
    
    /*****************************************************************
     *****************************************************************
-    * STANDARD FIXTURE
+    * RANGE ESTIMATES
     *****************************************************************
     *****************************************************************/
    
-   // setup standard fixture - set the zoom to 1100m per pixel
-   void setupStandardFixture()
-   {
-      Position p;
-      metersFromPixels = p.metersFromPixels;
-      p.metersFromPixels = 1100.0;
-   }
+   /*********************************************
+    * name:    ESTIMATE RANGE at the standard settings
+    * input:   827m/s at 45 degrees, level ground
+    * output:  within 10m of flying the shell
+    *********************************************/
+   void estimateRange_standard()
+   {  // setup
+      Howitzer h;
+      // exercise
+      double range = h.estimateRange();
+      // verify
+      assertUnit(fabs(range - FiringTable::fire(45.0, 827.0).range) < 10.0);
+      assertUnit(range > 20000.0);
+   }  // teardown
    
-   // teardown the standard fixture - reset the zoom to what it was previously
-   void teardownStandardFixture()
-   {
-      assert(metersFromPixels != -1.0);
-      Position p;
-      p.metersFromPixels = metersFromPixels;
-   }
+   /*********************************************
+    * name:    ESTIMATE RANGE pointing left
+    * input:   827m/s at -30 (330) degrees
+    * output:  the same as 30 degrees to the right
+    *********************************************/
+   void estimateRange_left()
+   {  // setup
+      Howitzer left;
+      Howitzer right;
+      left.elevation.setDegrees(330.0);
+      right.elevation.setDegrees(30.0);
+      // exercise
+      double rangeLeft = left.estimateRange();
+      double rangeRight = right.estimateRange();
+      // verify
+      assertEquals(rangeLeft, rangeRight);
+      assertUnit(rangeLeft > 0.0);
+   }  // teardown
+   
+   /*********************************************
+    * name:    ESTIMATE RANGE keeps its curve until the velocity changes
+    * input:   two estimates, then a new muzzle velocity
+    * output:  the curve is built for 827 then for 500
+    *********************************************/
+   void estimateRange_cached()
+   {  // setup
+      Howitzer h;
+      h.estimateRange();
+      // exercise
+      bool isCached = h.rangeCurve.isBuiltFor(827.0, 0.0);
+      h.setMuzzleVelocity(500.0);
+      double range = h.estimateRange();
+      // verify
+      assertUnit(isCached);
+      assertUnit(h.rangeCurve.isBuiltFor(500.0, 0.0));
+      assertUnit(range < 20000.0);
+   }  // teardown
+   
+   /*********************************************
+    * name:    ESTIMATE ANGLE FOR RANGE gives the flat path
+    * input:   827m/s, 12km
+    * output:  an angle past the max-range angle that lands
+    *          within 10m of 12km
+    *********************************************/
+   void estimateAngleForRange_low()
+   {  // setup
+      Howitzer h;
+      // exercise
+      Angle a = h.estimateAngleForRange(12000.0);
+      // verify
+      assertUnit(a.getDegrees() > h.rangeCurve.getMaxRangeAngle());
+      assertUnit(fabs(FiringTable::fire(a.getDegrees(), 827.0).range - 12000.0) < 10.0);
+   }  // teardown
+   
+   /*********************************************
+    * name:    ESTIMATE ANGLE FOR RANGE pointing left
+    * input:   827m/s at 315 degrees, 12km
+    * output:  the mirror of the right-hand answer
+    *********************************************/
+   void estimateAngleForRange_left()
+   {  // setup
+      Howitzer left;
+      Howitzer right;
+      left.elevation.setDegrees(315.0);
+      // exercise
+      Angle a = left.estimateAngleForRange(12000.0);
+      Angle b = right.estimateAngleForRange(12000.0);
+      // verify
+      assertUnit(a.isLeft());
+      assertEquals(a.getDegrees(), 360.0 - b.getDegrees());
+   }  // teardown
+   
+   /*********************************************
+    * name:    ESTIMATE ANGLE FOR RANGE out of reach
+    * input:   827m/s, 40km
+    * output:  the angle of maximum range
+    *********************************************/
+   void estimateAngleForRange_tooFar()
+   {  // setup
+      Howitzer h;
+      // exercise
+      Angle a = h.estimateAngleForRange(40000.0);
+      // verify
+      assertEquals(a.getDegrees(), h.rangeCurve.getMaxRangeAngle());
+   }  // teardown
+   
+   /*********************************************
+    * name:    ESTIMATE ANGLES FOR RANGE gives both paths
+    * input:   827m/s, 18km
+    * output:  two angles, the high one steeper, both landing
+    *          within 10m of 18km
+    *********************************************/
+   void estimateAnglesForRange_both()
+   {  // setup
+      Howitzer h;
+      Angle low;
+      Angle high;
+      // exercise
+      int num = h.estimateAnglesForRange(18000.0, 0.0, low, high);
+      // verify
+      assertUnit(num == 2);
+      assertUnit(high.getDegrees() < low.getDegrees());
+      assertUnit(fabs(FiringTable::fire(low.getDegrees(), 827.0).range - 18000.0) < 10.0);
+      assertUnit(fabs(FiringTable::fire(high.getDegrees(), 827.0).range - 18000.0) < 10.0);
+   }  // teardown
 };
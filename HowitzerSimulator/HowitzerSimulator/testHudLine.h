@@ -0,0 +1,194 @@
+/***********************************************************************
+ * Header File:
+ *    TEST HUD LINE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for HudLine
+ ************************************************************************/
+
+
+#pragma once
+
+#include "hudLine.h"
+#include "unitTest.h"
+#include <string>
+
+
+/*******************************
+ * TEST HUD LINE
+ * A friend class for HudLine which contains its unit tests
+ ********************************/
+class TestHudLine : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Formatting
+      constructor();
+      append_text();
+      append_int();
+      append_double();
+      pad_then_text();
+      append_full();
+
+      // Ticket 2: Caching
+      isStale_first();
+      isStale_same();
+      isStale_changed();
+
+      report("HudLine");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * FORMATTING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    CONSTRUCTOR
+    * input:   nothing
+    * output:  an empty line
+    *********************************************/
+   void constructor()
+   {  // setup
+      // exercise
+      HudLine line;
+      // verify
+      assertUnit(line.size() == 0);
+      assertUnit(std::string(line.c_str()) == "");
+      assertUnit(!line.isKeyed);
+   }  // teardown
+
+   /*********************************************
+    * name:    APPEND text
+    * input:   "Score: " then "/"
+    * output:  "Score: /"
+    *********************************************/
+   void append_text()
+   {  // setup
+      HudLine line;
+      // exercise
+      line.append("Score: ").append("/");
+      // verify
+      assertUnit(std::string(line.c_str()) == "Score: /");
+      assertUnit(line.size() == 8);
+   }  // teardown
+
+   /*********************************************
+    * name:    APPEND integers
+    * input:   3, "/", -12
+    * output:  "3/-12"
+    *********************************************/
+   void append_int()
+   {  // setup
+      HudLine line;
+      // exercise
+      line.append(3).append("/").append(-12);
+      // verify
+      assertUnit(std::string(line.c_str()) == "3/-12");
+   }  // teardown
+
+   /*********************************************
+    * name:    APPEND doubles
+    * input:   12.34 to 1 place, 66.666 to 0, 10 to 0
+    * output:  "12.3 67 10"
+    *********************************************/
+   void append_double()
+   {  // setup
+      HudLine line;
+      // exercise
+      line.append(12.34, 1).append(" ").append(66.666, 0).append(" ").append(10.0, 0);
+      // verify
+      assertUnit(std::string(line.c_str()) == "12.3 67 10");
+   }  // teardown
+
+   /*********************************************
+    * name:    PAD then text
+    * input:   three spaces, then "x", cleared, then "y"
+    * output:  "   x", then "y"
+    *********************************************/
+   void pad_then_text()
+   {  // setup
+      HudLine line;
+      // exercise
+      line.pad(3).append("x");
+      std::string before = line.c_str();
+      line.clear().append("y");
+      // verify
+      assertUnit(before == "   x");
+      assertUnit(std::string(line.c_str()) == "y");
+   }  // teardown
+
+   /*********************************************
+    * name:    APPEND past the end
+    * input:   200 spaces, "abc" and 12345
+    * output:  127 spaces, still terminated
+    *********************************************/
+   void append_full()
+   {  // setup
+      HudLine line;
+      // exercise
+      line.pad(200).append("abc").append(12345).append(1.5, 1);
+      // verify
+      assertUnit(line.size() == HUD_LINE_LENGTH - 1);
+      assertUnit(line.c_str()[HUD_LINE_LENGTH - 1] == '\0');
+      assertUnit(line.c_str()[HUD_LINE_LENGTH - 2] == ' ');
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * CACHING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    IS STALE the first time
+    * input:   0.0, never asked before
+    * output:  stale
+    *********************************************/
+   void isStale_first()
+   {  // setup
+      HudLine line;
+      // exercise
+      bool isStale = line.isStale(0.0);
+      // verify
+      assertUnit(isStale);
+      assertUnit(line.isKeyed);
+   }  // teardown
+
+   /*********************************************
+    * name:    IS STALE with the same values
+    * input:   (2, 3) twice
+    * output:  stale, then not
+    *********************************************/
+   void isStale_same()
+   {  // setup
+      HudLine line;
+      // exercise
+      bool isStale1 = line.isStale(2.0, 3.0);
+      bool isStale2 = line.isStale(2.0, 3.0);
+      // verify
+      assertUnit(isStale1);
+      assertUnit(!isStale2);
+   }  // teardown
+
+   /*********************************************
+    * name:    IS STALE with a value changed
+    * input:   (2, 3), then (2, 4)
+    * output:  stale both times
+    *********************************************/
+   void isStale_changed()
+   {  // setup
+      HudLine line;
+      line.isStale(2.0, 3.0);
+      // exercise
+      bool isStale = line.isStale(2.0, 4.0);
+      // verify
+      assertUnit(isStale);
+      assertEquals(line.key2, 4.0);
+   }  // teardown
+};
@@ -0,0 +1,501 @@
+/***********************************************************************
+ * Header File:
+ *    TEST INTEGRATOR
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for the integrator policies and the
+ *    adaptive Dormand-Prince integrator
+ ************************************************************************/
+
+
+#pragma once
+
+#include "integrator.h"
+#include "dormandPrince.h"
+#include "projectile.h"
+#include "projectileBatch.h"
+#include "angle.h"
+#include "unitTest.h"
+#include <cmath>
+
+
+/*******************************
+ * TEST INTEGRATOR
+ * Unit tests for KinematicIntegrator, SemiImplicitEuler,
+ * VelocityVerlet, RungeKutta4 and DormandPrince
+ ********************************/
+class TestIntegrator : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Constant acceleration
+      kinematic_constant();
+      semiImplicitEuler_constant();
+      velocityVerlet_constant();
+      rungeKutta4_constant();
+
+      // Ticket 2: Order of accuracy
+      semiImplicitEuler_order();
+      velocityVerlet_order();
+      rungeKutta4_order();
+
+      // Ticket 3: Shells
+      projectile_kinematicDefault();
+      projectile_rungeKutta4LargeStep();
+      batch_matchesProjectile();
+
+      // Ticket 4: Adaptive steps
+      dormandPrince_constant();
+      dormandPrince_stepGrows();
+      dormandPrince_spring();
+      dormandPrince_denseOutput();
+      projectile_adaptiveExactTime();
+      projectile_adaptiveAccuracy();
+
+      // Ticket 5: Events
+      hermite_ends();
+      locateEvent_falling();
+      dormandPrince_locate();
+
+      report("Integrator");
+   }
+
+private:
+
+   // constant acceleration, as if there were gravity but no air
+   struct Falling
+   {
+      Acceleration operator()(const BallisticState&) const
+      {
+         return Acceleration(1.0, -10.0);
+      }
+   };
+
+   // a spring: acceleration pulls back toward the origin, a = -x
+   struct Spring
+   {
+      Acceleration operator()(const BallisticState& s) const
+      {
+         return Acceleration(-s.x, -s.y);
+      }
+   };
+
+   // error in x after one second of the spring, starting at x=1, v=0
+   template <class Integrator>
+   double springError(int steps)
+   {
+      BallisticState s = { 1.0, 0.0, 0.0, 0.0 };
+      double t = 1.0 / (double)steps;
+      for (int i = 0; i < steps; i++)
+         Integrator::step(s, t, Spring());
+      return fabs(s.x - cos(1.0));
+   }
+
+   /*****************************************************************
+    *****************************************************************
+    * CONSTANT ACCELERATION
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    KINEMATIC with constant acceleration
+    * input:   s=(0,100) v=(10,20) a=(1,-10) t=2
+    * output:  x=22 y=120 dx=12 dy=0
+    *********************************************/
+   void kinematic_constant()
+   {  // setup
+      BallisticState s = { 0.0, 100.0, 10.0, 20.0 };
+      // exercise
+      KinematicIntegrator::step(s, 2.0, Falling());
+      // verify
+      assertEquals(s.x, 22.0);    // 0 + 10*2 + .5*1*4
+      assertEquals(s.y, 120.0);   // 100 + 20*2 + .5*(-10)*4
+      assertEquals(s.dx, 12.0);   // 10 + 1*2
+      assertEquals(s.dy, 0.0);    // 20 + (-10)*2
+   }  // teardown
+
+   /*********************************************
+    * name:    SEMI-IMPLICIT EULER with constant acceleration
+    * input:   s=(0,100) v=(10,20) a=(1,-10) t=2
+    * output:  dx=12 dy=0 x=24 y=100
+    *********************************************/
+   void semiImplicitEuler_constant()
+   {  // setup
+      BallisticState s = { 0.0, 100.0, 10.0, 20.0 };
+      // exercise
+      SemiImplicitEuler::step(s, 2.0, Falling());
+      // verify
+      assertEquals(s.dx, 12.0);   // 10 + 1*2
+      assertEquals(s.dy, 0.0);    // 20 + (-10)*2
+      assertEquals(s.x, 24.0);    // 0 + 12*2
+      assertEquals(s.y, 100.0);   // 100 + 0*2
+   }  // teardown
+
+   /*********************************************
+    * name:    VELOCITY VERLET is exact for constant acceleration
+    * input:   s=(0,100) v=(10,20) a=(1,-10) t=2
+    * output:  x=22 y=120 dx=12 dy=0
+    *********************************************/
+   void velocityVerlet_constant()
+   {  // setup
+      BallisticState s = { 0.0, 100.0, 10.0, 20.0 };
+      // exercise
+      VelocityVerlet::step(s, 2.0, Falling());
+      // verify
+      assertEquals(s.x, 22.0);
+      assertEquals(s.y, 120.0);
+      assertEquals(s.dx, 12.0);
+      assertEquals(s.dy, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    RUNGE-KUTTA 4 is exact for constant acceleration
+    * input:   s=(0,100) v=(10,20) a=(1,-10) t=2
+    * output:  x=22 y=120 dx=12 dy=0
+    *********************************************/
+   void rungeKutta4_constant()
+   {  // setup
+      BallisticState s = { 0.0, 100.0, 10.0, 20.0 };
+      // exercise
+      RungeKutta4::step(s, 2.0, Falling());
+      // verify
+      assertEquals(s.x, 22.0);
+      assertEquals(s.y, 120.0);
+      assertEquals(s.dx, 12.0);
+      assertEquals(s.dy, 0.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * ORDER OF ACCURACY
+    * Halving the step divides the error by 2^ORDER
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    SEMI-IMPLICIT EULER is first order
+    * input:   spring for one second in 100 then 200 steps
+    * output:  error ratio near 2
+    *********************************************/
+   void semiImplicitEuler_order()
+   {  // setup
+      // exercise
+      double ratio = springError<SemiImplicitEuler>(100) /
+                     springError<SemiImplicitEuler>(200);
+      // verify
+      assertUnit(ratio > 1.8 && ratio < 2.2);
+      assertUnit(SemiImplicitEuler::ORDER == 1);
+   }  // teardown
+
+   /*********************************************
+    * name:    VELOCITY VERLET is second order
+    * input:   spring for one second in 100 then 200 steps
+    * output:  error ratio near 4
+    *********************************************/
+   void velocityVerlet_order()
+   {  // setup
+      // exercise
+      double ratio = springError<VelocityVerlet>(100) /
+                     springError<VelocityVerlet>(200);
+      // verify
+      assertUnit(ratio > 3.6 && ratio < 4.4);
+      assertUnit(VelocityVerlet::ORDER == 2);
+   }  // teardown
+
+   /*********************************************
+    * name:    RUNGE-KUTTA 4 is fourth order
+    * input:   spring for one second in 10 then 20 steps
+    * output:  error ratio near 16
+    *********************************************/
+   void rungeKutta4_order()
+   {  // setup
+      // exercise
+      double ratio = springError<RungeKutta4>(10) /
+                     springError<RungeKutta4>(20);
+      // verify
+      assertUnit(ratio > 14.0 && ratio < 18.0);
+      assertUnit(RungeKutta4::ORDER == 4);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * SHELLS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    PROJECTILE default integrator is the kinematic one
+    * input:   pos=100,200 v=50,0 advance 1s
+    * output:  pos.x=149.9756 pos.y=195.0968 v=49.9513,-9.8064
+    *********************************************/
+   void projectile_kinematicDefault()
+   {  // setup
+      Projectile p;
+      p.fire(Position(100.0, 200.0), Angle(90.0), 50.0, 100.0);
+      // exercise
+      p.advance<KinematicIntegrator>(101.0);
+      // verify
+      assertEquals(p.getPosition().getMetersX(), 149.9756);
+      assertEquals(p.getPosition().getMetersY(), 195.0968);
+      assertEquals(p.getVelocity().getDX(), 49.9513);
+      assertEquals(p.getVelocity().getDY(), -9.8064);
+   }  // teardown
+
+   /*********************************************
+    * name:    PROJECTILE with RK4 at a 5s step beats the 0.5s default
+    * input:   827m/s at 45 degrees for 60s
+    * output:  RK4 at 5s is closer to a 0.01s reference than
+    *          the kinematic update at 0.5s
+    *********************************************/
+   void projectile_rungeKutta4LargeStep()
+   {  // setup
+      Projectile reference;
+      Projectile kinematic;
+      Projectile rk4;
+      reference.fire(Position(0.0, 10000.0), Angle(45.0), 827.0, 0.0);
+      kinematic.fire(Position(0.0, 10000.0), Angle(45.0), 827.0, 0.0);
+      rk4.fire(Position(0.0, 10000.0), Angle(45.0), 827.0, 0.0);
+      // exercise
+      for (int i = 1; i <= 6000; i++)
+         reference.advance<RungeKutta4>(i * 0.01);
+      for (int i = 1; i <= 120; i++)
+         kinematic.advance<KinematicIntegrator>(i * 0.5);
+      for (int i = 1; i <= 12; i++)
+         rk4.advance<RungeKutta4>(i * 5.0);
+      // verify
+      double errorKinematic = kinematic.getPosition().getDistanceTo(reference.getPosition());
+      double errorRK4 = rk4.getPosition().getDistanceTo(reference.getPosition());
+      assertUnit(errorRK4 < errorKinematic);
+      assertUnit(errorRK4 < 10.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    BATCH uses the same policy as the projectile
+    * input:   827m/s at 30 degrees, RK4, 10 steps of 1s
+    * output:  batch shell matches the projectile
+    *********************************************/
+   void batch_matchesProjectile()
+   {  // setup
+      ProjectileBatch b;
+      Projectile p;
+      b.fire(Position(0.0, 500.0), Angle(30.0), 827.0);
+      p.fire(Position(0.0, 500.0), Angle(30.0), 827.0, 0.0);
+      // exercise
+      for (int i = 1; i <= 10; i++)
+      {
+         b.advance<RungeKutta4>(1.0);
+         p.advance<RungeKutta4>((double)i);
+      }
+      // verify
+      assertEquals(b.getPosition(0).getMetersX(), p.getPosition().getMetersX());
+      assertEquals(b.getPosition(0).getMetersY(), p.getPosition().getMetersY());
+      assertEquals(b.getVelocity(0).getDX(), p.getVelocity().getDX());
+      assertEquals(b.getVelocity(0).getDY(), p.getVelocity().getDY());
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * ADAPTIVE STEPS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    DORMAND-PRINCE is exact for constant acceleration
+    * input:   s=(0,100) v=(10,20) a=(1,-10) until t=2
+    * output:  x=22 y=120 dx=12 dy=0 at t=2
+    *********************************************/
+   void dormandPrince_constant()
+   {  // setup
+      DormandPrince dp;
+      dp.start(BallisticState{ 0.0, 100.0, 10.0, 20.0 }, 0.0, Falling());
+      // exercise
+      dp.advanceTo(2.0, Falling());
+      BallisticState s = dp.interpolate(2.0);
+      // verify
+      assertUnit(dp.getTime() >= 2.0);
+      assertEquals(s.x, 22.0);
+      assertEquals(s.y, 120.0);
+      assertEquals(s.dx, 12.0);
+      assertEquals(s.dy, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    DORMAND-PRINCE grows the step when there is no error
+    * input:   constant acceleration, maxStep=3, five steps
+    * output:  no rejections, step reaches the maximum
+    *********************************************/
+   void dormandPrince_stepGrows()
+   {  // setup
+      DormandPrince dp;
+      dp.setMaxStep(3.0);
+      dp.start(BallisticState{ 0.0, 100.0, 10.0, 20.0 }, 0.0, Falling());
+      double first = dp.getStepSize();
+      // exercise
+      for (int i = 0; i < 5; i++)
+         dp.step(Falling());
+      // verify
+      assertUnit(first < 3.0);
+      assertEquals(dp.getStepSize(), 3.0);
+      assertUnit(dp.getNumRejected() == 0);
+      assertUnit(dp.getNumAccepted() == 5);
+      assertUnit(dp.getNumEvaluations() == 1 + 5 * 6);
+   }  // teardown
+
+   /*********************************************
+    * name:    DORMAND-PRINCE meets a tight tolerance
+    * input:   spring for one second, tolerance 1e-10
+    * output:  x within 1e-8 of cos(1)
+    *********************************************/
+   void dormandPrince_spring()
+   {  // setup
+      DormandPrince dp(1e-10, 1e-10);
+      dp.start(BallisticState{ 1.0, 0.0, 0.0, 0.0 }, 0.0, Spring());
+      // exercise
+      dp.advanceTo(1.0, Spring());
+      BallisticState s = dp.interpolate(1.0);
+      // verify
+      assertUnit(fabs(s.x - cos(1.0)) < 1e-8);
+      assertUnit(fabs(s.dx + sin(1.0)) < 1e-8);
+   }  // teardown
+
+   /*********************************************
+    * name:    DORMAND-PRINCE dense output inside a step
+    * input:   spring with one large step
+    * output:  the middle of the step is close to cos(t) and
+    *          the ends match the step exactly
+    *********************************************/
+   void dormandPrince_denseOutput()
+   {  // setup
+      DormandPrince dp(1e-6, 1e-6);
+      dp.start(BallisticState{ 1.0, 0.0, 0.0, 0.0 }, 0.0, Spring());
+      dp.step(Spring());
+      dp.step(Spring());
+      double t0 = dp.getPreviousTime();
+      double t1 = dp.getTime();
+      double middle = 0.5 * (t0 + t1);
+      // exercise
+      BallisticState s0 = dp.interpolate(t0);
+      BallisticState s1 = dp.interpolate(t1);
+      BallisticState sm = dp.interpolate(middle);
+      // verify
+      assertUnit(t1 > t0);
+      assertEquals(s0.x, dp.getPreviousState().x);
+      assertEquals(s1.x, dp.getState().x);
+      assertUnit(fabs(sm.x - cos(middle)) < 1e-5);
+   }  // teardown
+
+   /*********************************************
+    * name:    PROJECTILE adaptive advance lands on the requested time
+    * input:   827m/s at 45 degrees, advance to 0.37 then 0.5
+    * output:  the flight path ends at exactly those times
+    *********************************************/
+   void projectile_adaptiveExactTime()
+   {  // setup
+      Projectile p;
+      p.fire(Position(0.0, 0.0), Angle(45.0), 827.0, 0.0);
+      // exercise
+      p.advanceAdaptive(0.37);
+      double t1 = p.getFlightPath().back().t;
+      p.advanceAdaptive(0.5);
+      double t2 = p.getFlightPath().back().t;
+      // verify
+      assertEquals(t1, 0.37);
+      assertEquals(t2, 0.5);
+      assertUnit(p.isFlying());
+      assertUnit(p.getFlightPath().size() == 3);
+   }  // teardown
+
+   /*********************************************
+    * name:    PROJECTILE adaptive advance is accurate and cheap
+    * input:   827m/s at 45 degrees for 60s in 0.5s frames
+    * output:  within 1m of a 0.01s RK4 reference using a
+    *          fraction of the evaluations
+    *********************************************/
+   void projectile_adaptiveAccuracy()
+   {  // setup
+      Projectile reference;
+      Projectile adaptive;
+      reference.fire(Position(0.0, 10000.0), Angle(45.0), 827.0, 0.0);
+      adaptive.fire(Position(0.0, 10000.0), Angle(45.0), 827.0, 0.0);
+      // exercise
+      for (int i = 1; i <= 6000; i++)
+         reference.advance<RungeKutta4>(i * 0.01);
+      for (int i = 1; i <= 120; i++)
+         adaptive.advanceAdaptive(i * 0.5);
+      // verify
+      double error = adaptive.getPosition().getDistanceTo(reference.getPosition());
+      assertUnit(error < 1.0);
+      assertUnit(adaptive.getStepper().getNumEvaluations() < 6000 * RungeKutta4::EVALUATIONS / 10);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * EVENTS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    HERMITE matches both ends of the step
+    * input:   a kinematic step of 2s, theta 0 and 1
+    * output:  the start and end states
+    *********************************************/
+   void hermite_ends()
+   {  // setup
+      BallisticState s0 = { 0.0, 100.0, 10.0, 20.0 };
+      BallisticState s1 = s0;
+      KinematicIntegrator::step(s1, 2.0, Falling());
+      // exercise
+      BallisticState a = hermite(s0, s1, 2.0, 0.0);
+      BallisticState b = hermite(s0, s1, 2.0, 1.0);
+      BallisticState m = hermite(s0, s1, 2.0, 0.5);
+      // verify
+      assertEquals(a.y, 100.0);
+      assertEquals(b.y, 120.0);
+      assertEquals(b.dy, 0.0);
+      assertEquals(m.y, 115.0);   // 100 + 20*1 - 5*1
+   }  // teardown
+
+   /*********************************************
+    * name:    LOCATE EVENT for a shell falling to the ground
+    * input:   y=100 dy=20 a=-10, one 10s step, g = y
+    * output:  t = 2 + sqrt(24) with y just at or below zero
+    *********************************************/
+   void locateEvent_falling()
+   {  // setup
+      BallisticState s0 = { 0.0, 100.0, 10.0, 20.0 };
+      BallisticState s1 = s0;
+      KinematicIntegrator::step(s1, 10.0, Falling());
+      auto height = [](const BallisticState& s) { return s.y; };
+      auto stateAt = [&](double t) { return hermite(s0, s1, 10.0, t / 10.0); };
+      // exercise
+      double t = locateEvent(0.0, s0.y, 10.0, s1.y, stateAt, height);
+      // verify
+      assertUnit(fabs(t - (2.0 + sqrt(24.0))) < 0.001);
+      assertUnit(stateAt(t).y <= 0.0);
+      assertUnit(stateAt(t).y > -EVENT_TOLERANCE);
+   }  // teardown
+
+   /*********************************************
+    * name:    DORMAND-PRINCE locates an event without restarting
+    * input:   y=100 dy=20 a=-10, steps until y < 0
+    * output:  t = 2 + sqrt(24), step count unchanged
+    *********************************************/
+   void dormandPrince_locate()
+   {  // setup
+      DormandPrince dp;
+      dp.setMaxStep(3.0);
+      dp.start(BallisticState{ 0.0, 100.0, 10.0, 20.0 }, 0.0, Falling());
+      while (dp.getState().y > 0.0)
+         dp.step(Falling());
+      int evaluations = dp.getNumEvaluations();
+      auto height = [](const BallisticState& s) { return s.y; };
+      // exercise
+      double t = dp.locate(dp.getPreviousTime(), dp.getPreviousState().y,
+                           dp.getTime(), dp.getState().y, height);
+      // verify
+      assertUnit(fabs(t - (2.0 + sqrt(24.0))) < 0.001);
+      assertUnit(dp.getNumEvaluations() == evaluations);
+   }  // teardown
+};
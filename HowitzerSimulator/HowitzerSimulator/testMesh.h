@@ -0,0 +1,123 @@
+/***********************************************************************
+ * Header File:
+ *    TEST MESH
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for Mesh
+ ************************************************************************/
+
+
+#pragma once
+
+#include "mesh.h"
+#include "unitTest.h"
+
+
+/*******************************
+ * TEST MESH
+ * A friend class for Mesh which contains its unit tests
+ ********************************/
+class TestMesh : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Building
+      constructor();
+      addLine();
+      addRectangle();
+      clear_keepsMemory();
+
+      report("Mesh");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * BUILDING
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    CONSTRUCTOR
+    * input:   LINES
+    * output:  an empty mesh of lines
+    *********************************************/
+   void constructor()
+   {  // setup
+      // exercise
+      Mesh mesh(Mesh::LINES);
+      // verify
+      assertUnit(mesh.getPrimitive() == Mesh::LINES);
+      assertUnit(mesh.empty());
+      assertUnit(mesh.size() == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD LINE
+    * input:   (1, 2) to (3, 4) in (0.5, 0.25, 0.125)
+    * output:  two vertices with that color
+    *********************************************/
+   void addLine()
+   {  // setup
+      Mesh mesh(Mesh::LINES);
+      // exercise
+      mesh.addLine(PT(1.0, 2.0), PT(3.0, 4.0), 0.5, 0.25, 0.125);
+      // verify
+      assertUnit(mesh.vertices.size() == 2);
+      assertEquals(mesh.vertices[0].x, 1.0);
+      assertEquals(mesh.vertices[0].y, 2.0);
+      assertEquals(mesh.vertices[1].x, 3.0);
+      assertEquals(mesh.vertices[1].y, 4.0);
+      assertEquals(mesh.vertices[1].red, 0.5);
+      assertEquals(mesh.vertices[1].green, 0.25);
+      assertEquals(mesh.vertices[1].blue, 0.125);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD RECTANGLE
+    * input:   (1, 2) to (3, 4)
+    * output:  two triangles covering it:
+    *          (1,2) (1,4) (3,4) and (1,2) (3,4) (3,2)
+    *********************************************/
+   void addRectangle()
+   {  // setup
+      Mesh mesh(Mesh::TRIANGLES);
+      // exercise
+      mesh.addRectangle(PT(1.0, 2.0), PT(3.0, 4.0));
+      // verify
+      assertUnit(mesh.vertices.size() == 6);
+      assertEquals(mesh.vertices[0].x, 1.0);
+      assertEquals(mesh.vertices[0].y, 2.0);
+      assertEquals(mesh.vertices[1].x, 1.0);
+      assertEquals(mesh.vertices[1].y, 4.0);
+      assertEquals(mesh.vertices[2].x, 3.0);
+      assertEquals(mesh.vertices[2].y, 4.0);
+      assertEquals(mesh.vertices[3].x, 1.0);
+      assertEquals(mesh.vertices[3].y, 2.0);
+      assertEquals(mesh.vertices[4].x, 3.0);
+      assertEquals(mesh.vertices[4].y, 4.0);
+      assertEquals(mesh.vertices[5].x, 3.0);
+      assertEquals(mesh.vertices[5].y, 2.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLEAR
+    * input:   a mesh of 100 rectangles
+    * output:  empty, with room for 600 vertices
+    *********************************************/
+   void clear_keepsMemory()
+   {  // setup
+      Mesh mesh(Mesh::TRIANGLES);
+      for (int i = 0; i < 100; i++)
+         mesh.addRectangle(PT(i, 0.0), PT(i + 1.0, 1.0));
+      // exercise
+      mesh.clear();
+      // verify
+      assertUnit(mesh.empty());
+      assertUnit(mesh.vertices.capacity() >= 600);
+      assertUnit(mesh.getPrimitive() == Mesh::TRIANGLES);
+   }  // teardown
+};
@@ -0,0 +1,242 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PERF COUNTERS
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for PerfCounters and PerfCounts
+ ************************************************************************/
+
+
+#pragma once
+
+#include "perfCounters.h"
+#include "benchmark.h"
+#include "unitTest.h"
+#include <cstring>
+
+
+/*******************************
+ * TEST PERF COUNTERS
+ * A friend class for PerfCounters which contains its unit tests
+ ********************************/
+class TestPerfCounters : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Counts
+      counts_default();
+      getIPC();
+      getIPC_notCounted();
+      divide();
+
+      // Ticket 2: Counters
+      getName();
+      constructor();
+      startStop();
+      pauseResume();
+
+      report("PerfCounters");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * COUNTS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    COUNTS DEFAULT
+    * input:   nothing
+    * output:  no event counted
+    *********************************************/
+   void counts_default()
+   {  // setup
+      // exercise
+      PerfCounts counts;
+      // verify
+      for (int i = 0; i < PERF_NUM_EVENTS; i++)
+         assertUnit(!counts.isCounted((PerfEvent)i));
+      assertUnit(!counts.isAnyCounted());
+   }  // teardown
+
+   /*********************************************
+    * name:    GET IPC
+    * input:   3000 instructions in 2000 cycles
+    * output:  1.5
+    *********************************************/
+   void getIPC()
+   {  // setup
+      PerfCounts counts;
+      counts.value[PERF_CYCLES] = 2000.0;
+      counts.value[PERF_INSTRUCTIONS] = 3000.0;
+      // exercise
+      double ipc = counts.getIPC();
+      // verify
+      assertEquals(ipc, 1.5);
+      assertUnit(counts.isAnyCounted());
+   }  // teardown
+
+   /*********************************************
+    * name:    GET IPC without what it needs
+    * input:   only cycles; only instructions; no cycles
+    * output:  not counted each time
+    *********************************************/
+   void getIPC_notCounted()
+   {  // setup
+      PerfCounts cyclesOnly;
+      cyclesOnly.value[PERF_CYCLES] = 2000.0;
+      PerfCounts instructionsOnly;
+      instructionsOnly.value[PERF_INSTRUCTIONS] = 3000.0;
+      PerfCounts noCycles;
+      noCycles.value[PERF_CYCLES] = 0.0;
+      noCycles.value[PERF_INSTRUCTIONS] = 3000.0;
+      // exercise
+      // verify
+      assertEquals(cyclesOnly.getIPC(), PERF_NOT_COUNTED);
+      assertEquals(instructionsOnly.getIPC(), PERF_NOT_COUNTED);
+      assertEquals(noCycles.getIPC(), PERF_NOT_COUNTED);
+   }  // teardown
+
+   /*********************************************
+    * name:    DIVIDE
+    * input:   800 cycles, 40 branch misses, over 8
+    * output:  100 and 5, the rest still not counted
+    *********************************************/
+   void divide()
+   {  // setup
+      PerfCounts counts;
+      counts.value[PERF_CYCLES] = 800.0;
+      counts.value[PERF_BRANCH_MISSES] = 40.0;
+      // exercise
+      PerfCounts perOp = counts / 8.0;
+      // verify
+      assertEquals(perOp.value[PERF_CYCLES], 100.0);
+      assertEquals(perOp.value[PERF_BRANCH_MISSES], 5.0);
+      assertUnit(!perOp.isCounted(PERF_INSTRUCTIONS));
+      assertUnit(!perOp.isCounted(PERF_L1D_MISSES));
+      assertUnit(!perOp.isCounted(PERF_LLC_MISSES));
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * COUNTERS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    GET NAME
+    * input:   every event
+    * output:  a different name for each
+    *********************************************/
+   void getName()
+   {  // setup
+      // exercise
+      // verify
+      assertUnit(strcmp(PerfCounters::getName(PERF_CYCLES), "cycles") == 0);
+      for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      {
+         assertUnit(strlen(PerfCounters::getName((PerfEvent)i)) > 0);
+         for (int j = 0; j < i; j++)
+            assertUnit(strcmp(PerfCounters::getName((PerfEvent)i),
+                              PerfCounters::getName((PerfEvent)j)) != 0);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    CONSTRUCTOR
+    * input:   nothing
+    * output:  available if and only if an event opened
+    *********************************************/
+   void constructor()
+   {  // setup
+      // exercise
+      PerfCounters counters;
+      // verify
+      bool isAnyOpen = false;
+      for (int i = 0; i < PERF_NUM_EVENTS; i++)
+      {
+         assertUnit(counters.isAvailable((PerfEvent)i) == (counters.fd[i] >= 0));
+         isAnyOpen = isAnyOpen || counters.fd[i] >= 0;
+      }
+      assertUnit(counters.isAvailable() == isAnyOpen);
+   }  // teardown
+
+   /*********************************************
+    * name:    START and STOP
+    * input:   a loop of 100000 additions
+    * output:  counted only where available, and then
+    *          at least one instruction each
+    *********************************************/
+   void startStop()
+   {  // setup
+      PerfCounters counters;
+      // exercise
+      counters.start();
+      double sum = 0.0;
+      for (int i = 0; i < 100000; i++)
+      {
+         sum += (double)i;
+         doNotOptimize(sum);
+      }
+      PerfCounts counts = counters.stop();
+      // verify
+      for (int i = 0; i < PERF_NUM_EVENTS; i++)
+         if (!counters.isAvailable((PerfEvent)i))
+            assertUnit(!counts.isCounted((PerfEvent)i));
+      if (counts.isCounted(PERF_INSTRUCTIONS))
+         assertUnit(counts.value[PERF_INSTRUCTIONS] >= 100000.0);
+      if (counts.isCounted(PERF_CYCLES))
+         assertUnit(counts.value[PERF_CYCLES] > 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    PAUSE and RESUME
+    * input:   a loop of 100000 additions counted,
+    *          one not, then one counted again
+    * output:  cycles leads instructions in a group;
+    *          the instructions of two loops, not three
+    *********************************************/
+   void pauseResume()
+   {  // setup
+      PerfCounters counters;
+      counters.start();
+      add(100000);
+      PerfCounts one = counters.stop();
+      // exercise
+      counters.reset();
+      counters.resume();
+      add(100000);
+      counters.pause();
+      add(100000);
+      counters.resume();
+      add(100000);
+      counters.pause();
+      PerfCounts two = counters.read();
+      // verify
+      if (counters.isAvailable(PERF_CYCLES) && counters.isAvailable(PERF_INSTRUCTIONS))
+      {
+         assertUnit(counters.isLeader[PERF_CYCLES]);
+         assertUnit(!counters.isLeader[PERF_INSTRUCTIONS]);
+      }
+      if (one.isCounted(PERF_INSTRUCTIONS) && two.isCounted(PERF_INSTRUCTIONS))
+      {
+         assertUnit(two.value[PERF_INSTRUCTIONS] > 1.5 * one.value[PERF_INSTRUCTIONS]);
+         assertUnit(two.value[PERF_INSTRUCTIONS] < 2.5 * one.value[PERF_INSTRUCTIONS]);
+      }
+   }  // teardown
+
+   // Add up so many numbers the optimizer cannot skip
+   static void add(int num)
+   {
+      double sum = 0.0;
+      for (int i = 0; i < num; i++)
+      {
+         sum += (double)i;
+         doNotOptimize(sum);
+      }
+   }
+};
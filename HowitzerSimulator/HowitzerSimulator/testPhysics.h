@@ -108,6 +108,19 @@ public:
       dragFromMach_010();
       dragFromMach_314();
       
+      // Ticket 8: Uniform lookup tables
+      uniformTable_exact();
+      uniformTable_clamp();
+      uniformTable_coarse();
+      uniformTable_sweep();
+      
+      // Ticket 9: Combined atmosphere lookup
+      atmosphereAt_0();
+      atmosphereAt_5500();
+      atmosphereAt_belowSeaLevel();
+      atmosphereAt_above();
+      atmosphereAt_sweep();
+      
       report("Physics");
    }
 private:
@@ -1492,4 +1505,172 @@ private:
       assertEquals(drag, 0.2347);
    }  // teardown
    
+   /*****************************************************************
+    *****************************************************************
+    * UNIFORM TABLE
+    * UniformTable(const Mapping mapping[], int numMapping, double step)
+    *****************************************************************
+    *****************************************************************/
+   
+   /*******************************************************
+    * UNIFORM TABLE : step divides every gap in the mapping
+    * input:  mapping={(1,5),(3,6),(4,3)} step=0.5 domain=3.5
+    * output: 4.5, no error
+    ********************************************************/
+   void uniformTable_exact()
+   {  // setup
+      const Mapping mapping[] = { {1.0, 5.0}, {3.0, 6.0}, {4.0, 3.0} };
+      // exercise
+      UniformTable table(mapping, 3, 0.5);
+      // verify
+      assertUnit(table.getNumNodes() == 7);
+      assertEquals(table.getMaxError(), 0.0);
+      assertEquals(table(3.5), 4.5);
+      assertEquals(table(2.0), 5.5);
+      assertEquals(table(3.0), 6.0);
+   }  // teardown
+   
+   /*******************************************************
+    * UNIFORM TABLE : outside the mapping
+    * input:  mapping={(1,5),(3,6),(4,3)} domain=0 and 9
+    * output: 5 and 3, same as linearInterpolation()
+    ********************************************************/
+   void uniformTable_clamp()
+   {  // setup
+      const Mapping mapping[] = { {1.0, 5.0}, {3.0, 6.0}, {4.0, 3.0} };
+      UniformTable table(mapping, 3, 0.5);
+      // exercise
+      double below = table(0.0);
+      double above = table(9.0);
+      // verify
+      assertEquals(below, 5.0);
+      assertEquals(above, 3.0);
+   }  // teardown
+   
+   /*******************************************************
+    * UNIFORM TABLE : step misses a point in the mapping
+    * input:  mapping={(0,0),(1,1),(2,0)} step=0.8
+    * output: the peak at 1 is cut off to 0.7, maxError=0.3
+    ********************************************************/
+   void uniformTable_coarse()
+   {  // setup
+      const Mapping mapping[] = { {0.0, 0.0}, {1.0, 1.0}, {2.0, 0.0} };
+      // exercise
+      UniformTable table(mapping, 3, 0.8);
+      // verify
+      assertEquals(table.getMaxError(), 0.3);
+      assertEquals(table(0.8), 0.8);
+      assertEquals(table(1.0), 0.7);
+   }  // teardown
+   
+   /*******************************************************
+    * UNIFORM TABLE : the reported error bounds every lookup
+    * input:  mapping={(0,0),(1,1),(2,0),(3,2)} step=0.7
+    * output: |table - linearInterpolation| <= maxError everywhere
+    ********************************************************/
+   void uniformTable_sweep()
+   {  // setup
+      const Mapping mapping[] = { {0.0, 0.0}, {1.0, 1.0}, {2.0, 0.0}, {3.0, 2.0} };
+      UniformTable table(mapping, 4, 0.7);
+      double worst = 0.0;
+      // exercise
+      for (double d = -0.5; d <= 3.5; d += 0.001)
+         worst = std::max(worst, fabs(table(d) - linearInterpolation(mapping, 4, d)));
+      // verify
+      assertUnit(table.getMaxError() > 0.0);
+      assertUnit(worst <= table.getMaxError() + 1e-12);
+      assertUnit(worst >= table.getMaxError() - 0.01);
+   }  // teardown
+   
+   /*****************************************************************
+    *****************************************************************
+    * ATMOSPHERE AT
+    * AtmosphereSample atmosphereAt(double altitude)
+    *****************************************************************
+    *****************************************************************/
+   
+   /*******************************************************
+    * ATMOSPHERE AT : sea level
+    * input:  altitude=0
+    * output: density=1.225 speedSound=340 gravity=9.807
+    ********************************************************/
+   void atmosphereAt_0()
+   {  // setup
+      double altitude = 0.0;
+      // exercise
+      AtmosphereSample air = atmosphereAt(altitude);
+      // verify
+      assertEquals(air.density, 1.225);
+      assertEquals(air.speedSound, 340.0);
+      assertEquals(air.gravity, 9.807);
+   }  // teardown
+   
+   /*******************************************************
+    * ATMOSPHERE AT : halfway between 5000 and 6000
+    * input:  altitude=5500
+    * output: density=0.69825 speedSound=318 gravity=9.7895
+    ********************************************************/
+   void atmosphereAt_5500()
+   {  // setup
+      double altitude = 5500.0;
+      // exercise
+      AtmosphereSample air = atmosphereAt(altitude);
+      // verify
+      assertEquals(air.density, 0.69825);
+      assertEquals(air.speedSound, 318.0);
+      assertEquals(air.gravity, 9.7895);
+   }  // teardown
+   
+   /*******************************************************
+    * ATMOSPHERE AT : below sea level
+    * input:  altitude=-250
+    * output: same as sea level
+    ********************************************************/
+   void atmosphereAt_belowSeaLevel()
+   {  // setup
+      double altitude = -250.0;
+      // exercise
+      AtmosphereSample air = atmosphereAt(altitude);
+      // verify
+      assertEquals(air.density, 1.225);
+      assertEquals(air.speedSound, 340.0);
+      assertEquals(air.gravity, 9.807);
+   }  // teardown
+   
+   /*******************************************************
+    * ATMOSPHERE AT : above the top of the tables
+    * input:  altitude=95000
+    * output: density=0.0000185 speedSound=269 gravity=9.564
+    ********************************************************/
+   void atmosphereAt_above()
+   {  // setup
+      double altitude = 95000.0;
+      // exercise
+      AtmosphereSample air = atmosphereAt(altitude);
+      // verify
+      assertEquals(air.density, 0.0000185);
+      assertEquals(air.speedSound, 269.0);
+      assertEquals(air.gravity, 9.564);
+   }  // teardown
+   
+   /*******************************************************
+    * ATMOSPHERE AT : agrees with the separate lookups
+    * input:  altitude=-100 to 85000 every 7m
+    * output: each quantity matches its own function
+    ********************************************************/
+   void atmosphereAt_sweep()
+   {  // setup
+      double worst = 0.0;
+      // exercise
+      for (double altitude = -100.0; altitude < 85000.0; altitude += 7.0)
+      {
+         AtmosphereSample air = atmosphereAt(altitude);
+         worst = std::max(worst, fabs(air.density - densityFromAltitude(altitude)));
+         worst = std::max(worst, fabs(air.speedSound - speedSoundFromAltitude(altitude)));
+         worst = std::max(worst, fabs(air.gravity - gravityFromAltitude(altitude)));
+      }
+      // verify
+      assertUnit(worst < 1e-9);
+   }  // teardown
+   
 };
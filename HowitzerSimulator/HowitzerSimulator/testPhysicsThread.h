@@ -0,0 +1,207 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PHYSICS THREAD
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for PhysicsThread and the frames it publishes
+ ************************************************************************/
+
+
+#pragma once
+
+#include "physicsThread.h"
+#include "unitTest.h"
+#include <thread>
+#include <chrono>
+#include <cmath>
+
+
+/*******************************
+ * TEST PHYSICS THREAD
+ * A friend class for PhysicsThread which contains its unit tests
+ ********************************/
+class TestPhysicsThread : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Fixed steps
+      constructor();
+      run_idle();
+      run_fixedStep();
+      destructor_stops();
+
+      // Ticket 2: Interpolated frames
+      at_halfway();
+      at_clamped();
+      at_landed();
+
+      report("PhysicsThread");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * FIXED STEPS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    CONSTRUCTOR
+    * input:   a step of 0.01s at 100 times real time
+    * output:  both kept, the thread running
+    *********************************************/
+   void constructor()
+   {  // setup
+      Simulator sim(Viewport(40.0, 700.0, 500.0), 1);
+      // exercise
+      PhysicsThread physics(sim, 0.01, 100.0);
+      // verify
+      assertEquals(physics.getTimeStep(), 0.01);
+      assertEquals(physics.getTimeScale(), 100.0);
+      assertUnit(physics.thread.joinable());
+   }  // teardown
+
+   /*********************************************
+    * name:    RUN with nothing in the air
+    * input:   20ms at a 0.01s step, 100 times real time
+    * output:  steps are taken and timed, flight time
+    *          stays zero
+    *********************************************/
+   void run_idle()
+   {  // setup
+      Simulator sim(Viewport(40.0, 700.0, 500.0), 1);
+      size_t numSteps;
+      uint64_t updateNanoseconds;
+      // exercise
+      {
+         PhysicsThread physics(sim, 0.01, 100.0);
+         std::this_thread::sleep_for(std::chrono::milliseconds(20));
+         numSteps = physics.getNumSteps();
+         updateNanoseconds = physics.getUpdateNanoseconds();
+      }
+      // verify
+      assertUnit(numSteps > 0);
+      assertUnit(updateNanoseconds > 0);
+      assertEquals(sim.getSimulationTime(), 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    RUN with a shell in the air
+    * input:   fire, then 20ms at a 0.01s step,
+    *          100 times real time
+    * output:  flight time is a whole number of steps
+    *********************************************/
+   void run_fixedStep()
+   {  // setup
+      Simulator sim(Viewport(40.0, 700.0, 500.0), 1);
+      sim.fire();
+      // exercise
+      {
+         PhysicsThread physics(sim, 0.01, 100.0);
+         std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      }
+      // verify
+      double steps = sim.getSimulationTime() / 0.01;
+      assertUnit(steps > 0.5);
+      assertUnit(fabs(steps - round(steps)) < 1e-6);
+   }  // teardown
+
+   /*********************************************
+    * name:    DESTRUCTOR
+    * input:   a shell in the air, the thread destroyed
+    * output:  the flight time no longer moves
+    *********************************************/
+   void destructor_stops()
+   {  // setup
+      Simulator sim(Viewport(40.0, 700.0, 500.0), 1);
+      sim.fire();
+      {
+         PhysicsThread physics(sim, 0.01, 100.0);
+         std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      }
+      double time = sim.getSimulationTime();
+      // exercise
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      // verify
+      assertEquals(sim.getSimulationTime(), time);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * INTERPOLATED FRAMES
+    *****************************************************************
+    *****************************************************************/
+
+   // Two snapshots of one shot in flight, a second apart
+   void setupFlight(SimulatorFrame& frame)
+   {
+      frame.previous.isFiring = true;
+      frame.previous.shotsAttempted = 1;
+      frame.previous.time = 10.0;
+      frame.previous.projectile = Position(1000.0, 2000.0);
+      frame.previous.elevation = 0.5;
+      frame.current = frame.previous;
+      frame.current.time = 11.0;
+      frame.current.projectile = Position(1200.0, 1900.0);
+   }
+
+   /*********************************************
+    * name:    AT halfway
+    * input:   (1000, 2000) at 10s, (1200, 1900) at 11s, 0.5
+    * output:  (1100, 1950) at 10.5s
+    *********************************************/
+   void at_halfway()
+   {  // setup
+      SimulatorFrame frame;
+      setupFlight(frame);
+      // exercise
+      SimulatorSnapshot snapshot = frame.at(0.5);
+      // verify
+      assertEquals(snapshot.time, 10.5);
+      assertEquals(snapshot.projectile.getMetersX(), 1100.0);
+      assertEquals(snapshot.projectile.getMetersY(), 1950.0);
+      assertEquals(snapshot.elevation, 0.5);
+   }  // teardown
+
+   /*********************************************
+    * name:    AT past either end
+    * input:   the same frame, -1 and 3
+    * output:  previous and current
+    *********************************************/
+   void at_clamped()
+   {  // setup
+      SimulatorFrame frame;
+      setupFlight(frame);
+      // exercise
+      SimulatorSnapshot before = frame.at(-1.0);
+      SimulatorSnapshot after = frame.at(3.0);
+      // verify
+      assertEquals(before.time, 10.0);
+      assertEquals(before.projectile.getMetersX(), 1000.0);
+      assertEquals(after.time, 11.0);
+      assertEquals(after.projectile.getMetersX(), 1200.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    AT across a landing
+    * input:   the shell in flight, then landed, 0.5
+    * output:  current, not a blend
+    *********************************************/
+   void at_landed()
+   {  // setup
+      SimulatorFrame frame;
+      setupFlight(frame);
+      frame.current.isFiring = false;
+      frame.current.time = 0.0;
+      frame.current.projectile = Position();
+      // exercise
+      SimulatorSnapshot snapshot = frame.at(0.5);
+      // verify
+      assertEquals(snapshot.time, 0.0);
+      assertEquals(snapshot.projectile.getMetersX(), 0.0);
+      assertUnit(!snapshot.isFiring);
+   }  // teardown
+};
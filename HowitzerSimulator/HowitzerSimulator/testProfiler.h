@@ -0,0 +1,356 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PROFILER
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for Profiler, ProfileBuffer and ProfileZone
+ ************************************************************************/
+
+
+#pragma once
+
+#include "profiler.h"
+#include "unitTest.h"
+#include <sstream>
+#include <thread>
+
+
+/*******************************
+ * TEST PROFILER
+ * A friend class for Profiler which contains its unit tests
+ ********************************/
+class TestProfiler : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Buffer
+      buffer_empty();
+      buffer_push();
+      buffer_wrap();
+      buffer_concurrent();
+
+      // Ticket 2: Zones
+      zone_disabled();
+      zone_enabled();
+      zone_nested();
+      thread_distinct();
+
+      // Ticket 3: Trace
+      writeTrace_structure();
+      writeTrace_escape();
+
+      report("Profiler");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * BUFFER
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    BUFFER EMPTY
+    * input:   a new buffer
+    * output:  nothing to copy
+    *********************************************/
+   void buffer_empty()
+   {  // setup
+      ProfileBuffer buffer(7);
+      std::vector<ProfileEvent> events;
+      // exercise
+      buffer.copy(events);
+      // verify
+      assertUnit(events.empty());
+      assertUnit(buffer.getThreadID() == 7);
+      assertUnit(buffer.getThreadName() == NULL);
+   }  // teardown
+
+   /*********************************************
+    * name:    BUFFER PUSH
+    * input:   three events
+    * output:  the same three, in order
+    *********************************************/
+   void buffer_push()
+   {  // setup
+      ProfileBuffer buffer(1);
+      std::vector<ProfileEvent> events;
+      // exercise
+      buffer.push(ProfileEvent{ "a", 10, 20 });
+      buffer.push(ProfileEvent{ "b", 30, 40 });
+      buffer.push(ProfileEvent{ "c", 50, 60 });
+      buffer.copy(events);
+      // verify
+      assertUnit(events.size() == 3);
+      if (events.size() == 3)
+      {
+         assertUnit(std::string(events[0].name) == "a");
+         assertUnit(events[0].begin == 10 && events[0].end == 20);
+         assertUnit(std::string(events[2].name) == "c");
+         assertUnit(events[2].begin == 50 && events[2].end == 60);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    BUFFER WRAP
+    * input:   ten more events than the ring holds
+    * output:  the last PROFILE_EVENTS_PER_THREAD of them,
+    *          oldest first
+    *********************************************/
+   void buffer_wrap()
+   {  // setup
+      ProfileBuffer buffer(1);
+      std::vector<ProfileEvent> events;
+      // exercise
+      for (int64_t i = 0; i < PROFILE_EVENTS_PER_THREAD + 10; i++)
+         buffer.push(ProfileEvent{ "zone", i, i + 1 });
+      buffer.copy(events);
+      // verify
+      assertUnit(events.size() == PROFILE_EVENTS_PER_THREAD);
+      if (!events.empty())
+      {
+         assertUnit(events.front().begin == 10);
+         assertUnit(events.back().begin == PROFILE_EVENTS_PER_THREAD + 9);
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    BUFFER CONCURRENT
+    * input:   one thread pushing ten rings' worth of
+    *          events while this one copies
+    * output:  every copied event whole: the known
+    *          name, ending after it begins, and each
+    *          the one after the last
+    *********************************************/
+   void buffer_concurrent()
+   {  // setup
+      const char* name = "concurrent";
+      ProfileBuffer buffer(1);
+      std::atomic<bool> isDone(false);
+      bool isWhole = true;
+      int numCopies = 0;
+      // exercise
+      std::thread writer([&]()
+      {
+         for (int64_t i = 0; i < 10 * PROFILE_EVENTS_PER_THREAD; i++)
+            buffer.push(ProfileEvent{ name, 2 * i, 2 * i + 1 });
+         isDone = true;
+      });
+      std::vector<ProfileEvent> events;
+      while (!isDone || numCopies == 0)
+      {
+         events.clear();
+         buffer.copy(events);
+         numCopies++;
+         for (size_t i = 0; i < events.size(); i++)
+            if (events[i].name != name || events[i].end < events[i].begin ||
+                (i > 0 && events[i].begin != events[i - 1].begin + 2))
+               isWhole = false;
+      }
+      writer.join();
+      // verify
+      assertUnit(isWhole);
+      assertUnit(numCopies > 0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * ZONES
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    ZONE DISABLED
+    * input:   a zone while the profiler is off
+    * output:  nothing recorded
+    *********************************************/
+   void zone_disabled()
+   {  // setup
+      bool wasEnabled = Profiler::isEnabled();
+      Profiler::setEnabled(false);
+      Profiler::clear();
+      // exercise
+      {
+         ProfileZone zone("disabled");
+      }
+      // verify
+      assertUnit(countEvents("disabled") == 0);
+      // teardown
+      Profiler::setEnabled(wasEnabled);
+   }
+
+   /*********************************************
+    * name:    ZONE ENABLED
+    * input:   a zone while the profiler is on
+    * output:  one event, ending no sooner than it began
+    *********************************************/
+   void zone_enabled()
+   {  // setup
+      bool wasEnabled = Profiler::isEnabled();
+      Profiler::setEnabled(true);
+      Profiler::clear();
+      int64_t before = Profiler::now();
+      // exercise
+      {
+         ProfileZone zone("enabled");
+      }
+      // verify
+      int64_t after = Profiler::now();
+      std::vector<ProfileEvent> events;
+      Profiler::getBuffer().copy(events);
+      assertUnit(events.size() == 1);
+      if (events.size() == 1)
+      {
+         assertUnit(std::string(events[0].name) == "enabled");
+         assertUnit(before <= events[0].begin);
+         assertUnit(events[0].begin <= events[0].end);
+         assertUnit(events[0].end <= after);
+      }
+      // teardown
+      Profiler::setEnabled(wasEnabled);
+      Profiler::clear();
+   }
+
+   /*********************************************
+    * name:    ZONE NESTED
+    * input:   an inner zone inside an outer zone
+    * output:  the inner is recorded first and lies
+    *          within the outer
+    *********************************************/
+   void zone_nested()
+   {  // setup
+      bool wasEnabled = Profiler::isEnabled();
+      Profiler::setEnabled(true);
+      Profiler::clear();
+      // exercise
+      {
+         ProfileZone outer("outer");
+         {
+            ProfileZone inner("inner");
+         }
+      }
+      // verify
+      std::vector<ProfileEvent> events;
+      Profiler::getBuffer().copy(events);
+      assertUnit(events.size() == 2);
+      if (events.size() == 2)
+      {
+         assertUnit(std::string(events[0].name) == "inner");
+         assertUnit(std::string(events[1].name) == "outer");
+         assertUnit(events[1].begin <= events[0].begin);
+         assertUnit(events[0].end <= events[1].end);
+      }
+      // teardown
+      Profiler::setEnabled(wasEnabled);
+      Profiler::clear();
+   }
+
+   /*********************************************
+    * name:    THREAD DISTINCT
+    * input:   a zone on another thread
+    * output:  recorded in a buffer of its own with
+    *          a different thread ID, under its name
+    *********************************************/
+   void thread_distinct()
+   {  // setup
+      bool wasEnabled = Profiler::isEnabled();
+      Profiler::setEnabled(true);
+      Profiler::clear();
+      const ProfileBuffer* pMine = &Profiler::getBuffer();
+      const ProfileBuffer* pTheirs = NULL;
+      // exercise
+      std::thread other([&]()
+      {
+         Profiler::setThreadName("testProfiler");
+         ProfileZone zone("other");
+         pTheirs = &Profiler::getBuffer();
+      });
+      other.join();
+      // verify
+      assertUnit(pTheirs != NULL);
+      if (pTheirs)
+      {
+         std::vector<ProfileEvent> events;
+         pTheirs->copy(events);
+         assertUnit(pTheirs != pMine);
+         assertUnit(pTheirs->getThreadID() != pMine->getThreadID());
+         assertUnit(std::string(pTheirs->getThreadName()) == "testProfiler");
+         assertUnit(events.size() == 1);
+      }
+      assertUnit(countEvents("other") == 1);
+      // teardown
+      Profiler::setEnabled(wasEnabled);
+      Profiler::clear();
+   }
+
+   /*****************************************************************
+    *****************************************************************
+    * TRACE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    WRITE TRACE STRUCTURE
+    * input:   a zone from 1 us to 3.5 us
+    * output:  a trace-event object with an "X" event
+    *          in microseconds
+    *********************************************/
+   void writeTrace_structure()
+   {  // setup
+      Profiler::clear();
+      Profiler::record("trace", 1000, 3500);
+      std::ostringstream out;
+      // exercise
+      Profiler::writeTrace(out);
+      // verify
+      std::string trace = out.str();
+      assertUnit(trace.find("\"traceEvents\":[") != std::string::npos);
+      assertUnit(trace.find("{\"name\":\"trace\",\"ph\":\"X\",\"pid\":1,\"tid\":") != std::string::npos);
+      assertUnit(trace.find("\"ts\":1.000,\"dur\":2.500}") != std::string::npos);
+      assertUnit(trace.find("\"name\":\"thread_name\",\"ph\":\"M\"") != std::string::npos);
+      assertUnit(trace.size() >= 3 && trace.substr(trace.size() - 3) == "]}\n");
+      assertUnit(trace.find(",\n]") == std::string::npos);
+      // teardown
+      Profiler::clear();
+   }
+
+   /*********************************************
+    * name:    WRITE TRACE ESCAPE
+    * input:   a zone named with a quote and a backslash
+    * output:  both escaped
+    *********************************************/
+   void writeTrace_escape()
+   {  // setup
+      Profiler::clear();
+      Profiler::record("say \"hi\" \\ bye", 0, 1000);
+      std::ostringstream out;
+      // exercise
+      Profiler::writeTrace(out);
+      // verify
+      assertUnit(out.str().find("\"say \\\"hi\\\" \\\\ bye\"") != std::string::npos);
+      // teardown
+      Profiler::clear();
+   }
+
+   /*********************************************
+    * COUNT EVENTS
+    * How many zones of this name every thread has
+    *********************************************/
+   int countEvents(const char* name)
+   {
+      int count = 0;
+      std::vector<ProfileEvent> events;
+      for (ProfileBuffer* p = Profiler::pHead.load(); p; p = p->pNext)
+      {
+         events.clear();
+         p->copy(events);
+         for (const ProfileEvent& event : events)
+            if (std::string(event.name) == name)
+               count++;
+      }
+      return count;
+   }
+};
@@ -41,11 +41,20 @@ public:
       advance_diagonalUp();
       advance_diagonalDown();
       
+      // Ticket 5: Flight path queries
+      getFlightTime_ring();
+      getMaxAltitude_ring();
+      
+      // Ticket 6: Ground impact
+      impact_flat();
+      impact_plateau();
+      impact_leavesGround();
+      impact_adaptive();
+      
       report("Projectile");
    }
    
 private:
-   double metersFromPixels = -1.0;
    
    
    /*****************************************************************
@@ -355,7 +364,6 @@ private:
     *********************************************/
    void advance_diagonalDown()
    {  // setup
-      setupStandardFixture();
       Position pos;
       Projectile p;
       PositionVelocityTime pvt;
@@ -383,30 +391,157 @@ private:
          assertEquals(p.flightPath.back().t, 101.0);
       }
       // teardown
-      teardownStandardFixture();
    }
    
    /*****************************************************************
     *****************************************************************
-    * STANDARD FIXTURE
+    * FLIGHT PATH QUERIES
     *****************************************************************
     *****************************************************************/
    
-   // setup standard fixture - set the zoom to 1100m per pixel
-   void setupStandardFixture()
-   {
-      Position p;
-      metersFromPixels = p.metersFromPixels;
-      p.metersFromPixels = 1.0;
-   }
+   /*********************************************
+    * name:    GET FLIGHT TIME when only the last state is kept
+    * input:   ring of 1, fired at t=10, advanced to t=11,12,13
+    * output:  flightPath.size()=1, flightTime=3
+    *********************************************/
+   void getFlightTime_ring()
+   {  // setup
+      Projectile p;
+      p.setFlightPathCapacity(1, true /*keepLatestOnly*/);
+      p.fire(Position(0.0, 5000.0), Angle(90.0), 100.0, 10.0);
+      // exercise
+      p.advance(11.0);
+      p.advance(12.0);
+      p.advance(13.0);
+      // verify
+      assertUnit(p.flightPath.size() == 1);
+      assertEquals(p.getFlightTime(), 3.0);
+      assertEquals(p.flightPath.back().t, 13.0);
+   }  // teardown
    
-   // teardown the standard fixture - reset the zoom to what it was previously
-   void teardownStandardFixture()
+   /*********************************************
+    * name:    GET MAX ALTITUDE after the apex has been dropped
+    * input:   ring of 2, fired straight up at 100m/s, advanced 20 seconds
+    * output:  maxAltitude is the apex, not the current altitude
+    *********************************************/
+   void getMaxAltitude_ring()
+   {  // setup
+      Projectile full;
+      Projectile ring;
+      ring.setFlightPathCapacity(2, true /*keepLatestOnly*/);
+      full.fire(Position(0.0, 0.0), Angle(0.0), 100.0, 0.0);
+      ring.fire(Position(0.0, 0.0), Angle(0.0), 100.0, 0.0);
+      // exercise
+      for (int i = 1; i <= 20; i++)
+      {
+         full.advance((double)i);
+         ring.advance((double)i);
+      }
+      // verify
+      assertUnit(ring.flightPath.size() == 2);
+      assertUnit(ring.getMaxAltitude() > ring.getCurrentAltitude());
+      assertEquals(ring.getMaxAltitude(), full.getMaxAltitude());
+      assertEquals(ring.getTotalDistance(), full.getTotalDistance());
+   }  // teardown
+   
+   /*****************************************************************
+    *****************************************************************
+    * GROUND IMPACT
+    *****************************************************************
+    *****************************************************************/
+   
+   // level ground at a fixed elevation
+   struct Flat
    {
-      assert(metersFromPixels != -1.0);
-      Position p;
-      p.metersFromPixels = metersFromPixels;
-   }
+      double elevation;
+      double getElevationMeters(const Position&) const { return elevation; }
+   };
+   
+   /*********************************************
+    * name:    IMPACT on flat ground with a large step
+    * input:   827m/s at 45 degrees, kinematic 0.5s steps
+    * output:  stops on the ground (within 1cm) partway through
+    *          the last step, between the last two frames
+    *********************************************/
+   void impact_flat()
+   {  // setup
+      Projectile p;
+      Flat ground = { 0.0 };
+      p.fire(Position(0.0, 0.0), Angle(45.0), 827.0, 0.0);
+      int i = 1;
+      // exercise
+      while (!p.advance((double)i * 0.5, ground))
+         i++;
+      // verify
+      double t = p.flightPath.back().t;
+      assertUnit(!p.isActive);
+      assertUnit(p.getPosition().getMetersY() <= 0.0);
+      assertUnit(p.getPosition().getMetersY() > -0.01);
+      assertUnit(t > (i - 1) * 0.5 && t <= i * 0.5);
+   }  // teardown
    
+   /*********************************************
+    * name:    IMPACT on a plateau above the howitzer
+    * input:   827m/s at 45 degrees, ground at 500m, RK4 5s steps
+    * output:  climbs through 500m without stopping and lands
+    *          on the plateau within 1cm
+    *********************************************/
+   void impact_plateau()
+   {  // setup
+      Projectile p;
+      Flat ground = { 500.0 };
+      p.fire(Position(0.0, 0.0), Angle(45.0), 827.0, 0.0);
+      int i = 1;
+      // exercise
+      while (!p.advance<RungeKutta4>((double)i * 5.0, ground))
+         i++;
+      // verify
+      assertUnit(p.getFlightTime() > 60.0);
+      assertUnit(p.getPosition().getMetersY() <= 500.0);
+      assertUnit(p.getPosition().getMetersY() > 499.99);
+   }  // teardown
+   
+   /*********************************************
+    * name:    IMPACT is not triggered by leaving the ground
+    * input:   fired from ground level, one 0.5s step
+    * output:  still flying
+    *********************************************/
+   void impact_leavesGround()
+   {  // setup
+      Projectile p;
+      Flat ground = { 100.0 };
+      p.fire(Position(0.0, 100.0), Angle(45.0), 827.0, 0.0);
+      // exercise
+      bool isImpact = p.advance(0.5, ground);
+      // verify
+      assertUnit(!isImpact);
+      assertUnit(p.isActive);
+      assertUnit(p.flightPath.size() == 2);
+   }  // teardown
+   
+   /*********************************************
+    * name:    IMPACT with the adaptive integrator
+    * input:   827m/s at 45 degrees in 0.5s frames
+    * output:  within 2m of a 0.01s RK4 reference impact
+    *********************************************/
+   void impact_adaptive()
+   {  // setup
+      Projectile reference;
+      Projectile adaptive;
+      Flat ground = { 0.0 };
+      reference.fire(Position(0.0, 0.0), Angle(45.0), 827.0, 0.0);
+      adaptive.fire(Position(0.0, 0.0), Angle(45.0), 827.0, 0.0);
+      int i = 1;
+      while (!reference.advance<RungeKutta4>((double)i * 0.01, ground))
+         i++;
+      i = 1;
+      // exercise
+      while (!adaptive.advanceAdaptive((double)i * 0.5, ground))
+         i++;
+      // verify
+      assertUnit(adaptive.getPosition().getDistanceTo(reference.getPosition()) < 2.0);
+      assertUnit(adaptive.getPosition().getMetersY() <= 0.0);
+      assertUnit(adaptive.getPosition().getMetersY() > -0.01);
+   }  // teardown
 };
 
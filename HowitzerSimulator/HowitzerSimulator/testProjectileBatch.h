@@ -0,0 +1,270 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PROJECTILE BATCH
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for ProjectileBatch
+ ************************************************************************/
+
+
+#pragma once
+
+#include "projectileBatch.h"
+#include "angle.h"
+#include "unitTest.h"
+
+
+/*******************************
+ * TEST PROJECTILE BATCH
+ * A friend class for ProjectileBatch which contains its unit tests
+ ********************************/
+class TestProjectileBatch : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Setup
+      defaultConstructor();
+      fire_one();
+      fire_two();
+      clear_full();
+
+      // Ticket 2: Advance
+      advance_nothing();
+      advance_fall();
+      advance_horizontal();
+      advance_matchesProjectile();
+      advance_land();
+      advance_skipLanded();
+
+      report("ProjectileBatch");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * SETUP
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    DEFAULT CONSTRUCTOR
+    * input:   nothing
+    * output:  size=0 numActive=0 time=0
+    *********************************************/
+   void defaultConstructor()
+   {  // setup
+      // exercise
+      ProjectileBatch b;
+      // verify
+      assertUnit(b.size() == 0);
+      assertUnit(b.getNumActive() == 0);
+      assertUnit(b.isEmpty());
+      assertUnit(!b.isFlying());
+      assertEquals(b.time, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE one shell straight right
+    * input:   pos=(111,222) angle=90 muzzleVelocity=100
+    * output:  x=111 y=222 dx=100 dy=0 mass=46.7 radius=0.077545
+    *********************************************/
+   void fire_one()
+   {  // setup
+      ProjectileBatch b;
+      Angle a(90.0);
+      // exercise
+      size_t i = b.fire(Position(111.0, 222.0), a, 100.0);
+      // verify
+      assertUnit(i == 0);
+      assertUnit(b.size() == 1);
+      assertUnit(b.getNumActive() == 1);
+      assertEquals(b.x[0], 111.0);
+      assertEquals(b.y[0], 222.0);
+      assertEquals(b.dx[0], 100.0);
+      assertEquals(b.dy[0], 0.0);
+      assertEquals(b.mass[0], 46.7);
+      assertEquals(b.radius[0], 0.077545);
+      assertUnit(b.isFlying(0));
+   }  // teardown
+
+   /*********************************************
+    * name:    FIRE a second, lighter shell straight up
+    * input:   one shell, then pos=(0,0) angle=0 muzzleVelocity=50 mass=40 radius=0.07
+    * output:  two shells, second has dx=0 dy=50 mass=40 radius=0.07
+    *********************************************/
+   void fire_two()
+   {  // setup
+      ProjectileBatch b;
+      b.fire(Position(111.0, 222.0), Angle(90.0), 100.0);
+      // exercise
+      size_t i = b.fire(Position(0.0, 0.0), Angle(0.0), 50.0, 40.0, 0.07);
+      // verify
+      assertUnit(i == 1);
+      assertUnit(b.size() == 2);
+      assertUnit(b.getNumActive() == 2);
+      assertEquals(b.dx[1], 0.0);
+      assertEquals(b.dy[1], 50.0);
+      assertEquals(b.mass[1], 40.0);
+      assertEquals(b.radius[1], 0.07);
+      assertEquals(b.x[0], 111.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CLEAR a batch with shells in it
+    * input:   two shells, time=3
+    * output:  size=0 numActive=0 time=0
+    *********************************************/
+   void clear_full()
+   {  // setup
+      ProjectileBatch b;
+      b.fire(Position(111.0, 222.0), Angle(90.0), 100.0);
+      b.fire(Position(0.0, 0.0), Angle(0.0), 50.0);
+      b.time = 3.0;
+      // exercise
+      b.clear();
+      // verify
+      assertUnit(b.size() == 0);
+      assertUnit(b.getNumActive() == 0);
+      assertEquals(b.time, 0.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * ADVANCE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    ADVANCE an empty batch
+    * input:   nothing, timeStep=1
+    * output:  size=0 time=1
+    *********************************************/
+   void advance_nothing()
+   {  // setup
+      ProjectileBatch b;
+      // exercise
+      b.advance(1.0);
+      // verify
+      assertUnit(b.size() == 0);
+      assertEquals(b.time, 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE : the shell is stationary and falls down
+    * input:   pos=100,200 v=0,0 timeStep=1
+    * output:  pos.x=100      = 100 + 0*1
+    *          pos.y=195.0968 = 200 + 0*1 + .5(-9.806)*1*1
+    *          v.dx =0        = 0 + 0*1
+    *          v.dy =-9.8064  = 0 + (-9.8064)*1
+    *********************************************/
+   void advance_fall()
+   {  // setup
+      ProjectileBatch b;
+      b.fire(Position(100.0, 200.0), Angle(0.0), 0.0);
+      // exercise
+      b.advance(1.0);
+      // verify
+      assertEquals(b.x[0], 100.0);
+      assertEquals(b.y[0], 195.0968);
+      assertEquals(b.dx[0], 0.0);
+      assertEquals(b.dy[0], -9.8064);
+      assertEquals(b.getFlightTime(0), 1.0);
+      assertUnit(b.isFlying(0));
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE : the shell is traveling horizontally
+    * input:   pos=100,200 v=50,0 timeStep=1
+    * output:  pos.x=149.9756 = 100 + 50*1 + .5(-0.0487)*1*1
+    *          pos.y=195.0968 = 200 + 0*1  + .5(-9.8064)*1*1
+    *          v.dx =49.9513  = 50 + (-0.0487)*1
+    *          v.dy =-9.8064  = 0  + (-9.8064)*1
+    *********************************************/
+   void advance_horizontal()
+   {  // setup
+      ProjectileBatch b;
+      b.fire(Position(100.0, 200.0), Angle(90.0), 50.0);
+      // exercise
+      b.advance(1.0);
+      // verify
+      assertEquals(b.x[0], 149.9756);
+      assertEquals(b.y[0], 195.0968);
+      assertEquals(b.dx[0], 49.9513);
+      assertEquals(b.dy[0], -9.8064);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE : a full salvo tracks individual projectiles
+    * input:   three shells at 30, 45, 60 degrees, 827 m/s, 20 steps of 0.5s
+    * output:  every shell matches a Projectile fired the same way
+    *********************************************/
+   void advance_matchesProjectile()
+   {  // setup
+      ProjectileBatch b;
+      Projectile p[3];
+      double degrees[3] = { 30.0, 45.0, 60.0 };
+      for (int i = 0; i < 3; i++)
+      {
+         b.fire(Position(0.0, 500.0), Angle(degrees[i]), 827.0);
+         p[i].fire(Position(0.0, 500.0), Angle(degrees[i]), 827.0, 0.0);
+      }
+      // exercise
+      for (int step = 1; step <= 20; step++)
+      {
+         b.advance(0.5);
+         for (int i = 0; i < 3; i++)
+            p[i].advance(step * 0.5);
+      }
+      // verify
+      for (int i = 0; i < 3; i++)
+      {
+         assertEquals(b.x[i], p[i].getPosition().getMetersX());
+         assertEquals(b.y[i], p[i].getPosition().getMetersY());
+         assertEquals(b.dx[i], p[i].getVelocity().getDX());
+         assertEquals(b.dy[i], p[i].getVelocity().getDY());
+      }
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE : the shell falls below the ground
+    * input:   pos=100,1 v=0,-10 timeStep=1
+    * output:  shell is no longer flying, numActive=0
+    *********************************************/
+   void advance_land()
+   {  // setup
+      ProjectileBatch b;
+      b.fire(Position(100.0, 1.0), Angle(180.0), 10.0);
+      // exercise
+      b.advance(1.0);
+      // verify
+      assertUnit(!b.isFlying(0));
+      assertUnit(b.getNumActive() == 0);
+      assertUnit(b.y[0] < 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADVANCE : a landed shell does not move
+    * input:   one landed shell at 100,-5 and one flying shell
+    * output:  landed shell unchanged, flying shell moved
+    *********************************************/
+   void advance_skipLanded()
+   {  // setup
+      ProjectileBatch b;
+      b.fire(Position(100.0, -5.0), Angle(90.0), 50.0);
+      b.fire(Position(100.0, 200.0), Angle(90.0), 50.0);
+      b.active[0] = 0;
+      b.numActive = 1;
+      // exercise
+      b.advance(1.0);
+      // verify
+      assertEquals(b.x[0], 100.0);
+      assertEquals(b.y[0], -5.0);
+      assertEquals(b.dx[0], 50.0);
+      assertEquals(b.getFlightTime(0), 0.0);
+      assertEquals(b.x[1], 149.9756);
+      assertUnit(b.getNumActive() == 1);
+   }  // teardown
+};
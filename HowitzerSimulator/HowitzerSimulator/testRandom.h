@@ -0,0 +1,327 @@
+/***********************************************************************
+ * Header File:
+ *    TEST RANDOM
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for the random number generators
+ ************************************************************************/
+
+
+#pragma once
+
+#include "random.h"
+#include "unitTest.h"
+#include <vector>
+#include <cmath>
+
+
+/*******************************
+ * TEST RANDOM
+ * A friend class for Xoshiro256 and Philox which contains their
+ * unit tests
+ ********************************/
+class TestRandom : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Xoshiro256
+      xoshiro_reference();
+      xoshiro_seeded();
+      xoshiro_jump();
+
+      // Ticket 2: Philox
+      philox_zero();
+      philox_ones();
+      philox_pi();
+      philox_atMatchesNext();
+      philox_streams();
+
+      // Ticket 3: Distributions
+      uniform_int();
+      fillUniform_mean();
+      fillNormal_moments();
+      fillNormal_odd();
+      random_seeded();
+
+      report("Random");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * XOSHIRO 256
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    XOSHIRO from the reference state
+    * input:   state {1, 2, 3, 4}
+    * output:  11520, 0, 1509978240, 1215971899390074240
+    *          as the reference xoshiro256starstar.c
+    *********************************************/
+   void xoshiro_reference()
+   {  // setup
+      Xoshiro256 g;
+      g.s[0] = 1;
+      g.s[1] = 2;
+      g.s[2] = 3;
+      g.s[3] = 4;
+      // exercise
+      uint64_t a = g.next();
+      uint64_t b = g.next();
+      uint64_t c = g.next();
+      uint64_t d = g.next();
+      // verify
+      assertUnit(a == 11520ull);
+      assertUnit(b == 0ull);
+      assertUnit(c == 1509978240ull);
+      assertUnit(d == 1215971899390074240ull);
+   }  // teardown
+
+   /*********************************************
+    * name:    XOSHIRO seeded twice
+    * input:   seed 99 twice, then seed 100
+    * output:  the same numbers for the same seed only
+    *********************************************/
+   void xoshiro_seeded()
+   {  // setup
+      Xoshiro256 a(99);
+      Xoshiro256 b(99);
+      Xoshiro256 c(100);
+      // exercise
+      bool isSame = true;
+      for (int i = 0; i < 100; i++)
+         isSame = isSame && a.next() == b.next();
+      // verify
+      assertUnit(isSame);
+      assertUnit(a.next() != c.next());
+   }  // teardown
+
+   /*********************************************
+    * name:    XOSHIRO jump
+    * input:   a copy of a generator, jumped
+    * output:  a different stream from the original
+    *********************************************/
+   void xoshiro_jump()
+   {  // setup
+      Xoshiro256 a(5);
+      Xoshiro256 b(a);
+      // exercise
+      b.jump();
+      // verify
+      assertUnit(a.next() != b.next());
+      assertUnit(a.next() != b.next());
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * PHILOX
+    * Known answers from the Random123 kat_vectors file
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    PHILOX all zeros
+    * input:   key 0, counter 0
+    * output:  6627e8d5 e169c58d bc57ac4c 9b00dbd8
+    *********************************************/
+   void philox_zero()
+   {  // setup
+      Philox g(0, 0);
+      uint32_t out[4];
+      // exercise
+      g.block(0, out);
+      // verify
+      assertUnit(out[0] == 0x6627e8d5 && out[1] == 0xe169c58d);
+      assertUnit(out[2] == 0xbc57ac4c && out[3] == 0x9b00dbd8);
+   }  // teardown
+
+   /*********************************************
+    * name:    PHILOX all ones
+    * input:   key, stream and counter all ones
+    * output:  408f276d 41c83b0e a20bc7c6 6d5451fd
+    *********************************************/
+   void philox_ones()
+   {  // setup
+      Philox g(~0ull, ~0ull);
+      uint32_t out[4];
+      // exercise
+      g.block(~0ull, out);
+      // verify
+      assertUnit(out[0] == 0x408f276d && out[1] == 0x41c83b0e);
+      assertUnit(out[2] == 0xa20bc7c6 && out[3] == 0x6d5451fd);
+   }  // teardown
+
+   /*********************************************
+    * name:    PHILOX digits of pi
+    * input:   counter 243f6a88 85a308d3 13198a2e 03707344
+    *          key a4093822 299f31d0
+    * output:  d16cfe09 94fdcceb 5001e420 24126ea1
+    *********************************************/
+   void philox_pi()
+   {  // setup
+      Philox g(0x299f31d0a4093822ull, 0x0370734413198a2eull);
+      uint32_t out[4];
+      // exercise
+      g.block(0x85a308d3243f6a88ull, out);
+      // verify
+      assertUnit(out[0] == 0xd16cfe09 && out[1] == 0x94fdcceb);
+      assertUnit(out[2] == 0x5001e420 && out[3] == 0x24126ea1);
+   }  // teardown
+
+   /*********************************************
+    * name:    PHILOX at() is the stream seen out of order
+    * input:   key 3, stream 4
+    * output:  next() gives at(0), then the other half, then at(1);
+    *          seek(1) goes back to at(1)
+    *********************************************/
+   void philox_atMatchesNext()
+   {  // setup
+      Philox g(3, 4);
+      // exercise
+      uint64_t first = g.next();
+      uint64_t second = g.next();
+      uint64_t third = g.next();
+      g.seek(1);
+      uint64_t again = g.next();
+      // verify
+      assertUnit(first == g.at(0));
+      assertUnit(second != first);
+      assertUnit(third == g.at(1));
+      assertUnit(again == third);
+   }  // teardown
+
+   /*********************************************
+    * name:    PHILOX streams of the same key
+    * input:   key 1, streams 0 and 1
+    * output:  different numbers
+    *********************************************/
+   void philox_streams()
+   {  // setup
+      Philox a(1, 0);
+      Philox b(1, 1);
+      // exercise
+      // verify
+      assertUnit(a.at(0) != b.at(0));
+      assertUnit(a.next() != b.next());
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * DISTRIBUTIONS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    UNIFORM integers
+    * input:   10000 draws from [-3, 4)
+    * output:  all seven values seen, nothing outside
+    *********************************************/
+   void uniform_int()
+   {  // setup
+      Xoshiro256 g(1);
+      int counts[7] = { 0, 0, 0, 0, 0, 0, 0 };
+      bool isInside = true;
+      // exercise
+      for (int i = 0; i < 10000; i++)
+      {
+         int num = uniform(g, -3, 4);
+         isInside = isInside && num >= -3 && num < 4;
+         if (num >= -3 && num < 4)
+            counts[num + 3]++;
+      }
+      // verify
+      assertUnit(isInside);
+      bool isAllSeen = true;
+      for (int count : counts)
+         isAllSeen = isAllSeen && count > 1000;
+      assertUnit(isAllSeen);
+   }  // teardown
+
+   /*********************************************
+    * name:    FILL UNIFORM
+    * input:   100000 values in [10, 20)
+    * output:  all in range, mean about 15
+    *********************************************/
+   void fillUniform_mean()
+   {  // setup
+      Philox g(2);
+      std::vector<double> values(100000);
+      // exercise
+      fillUniform(g, values.data(), values.size(), 10.0, 20.0);
+      // verify
+      double sum = 0.0;
+      bool isInside = true;
+      for (double v : values)
+      {
+         sum += v;
+         isInside = isInside && v >= 10.0 && v < 20.0;
+      }
+      assertUnit(isInside);
+      assertUnit(fabs(sum / values.size() - 15.0) < 0.05);
+   }  // teardown
+
+   /*********************************************
+    * name:    FILL NORMAL
+    * input:   100000 values, mean 5, sigma 2
+    * output:  sample mean about 5, sample sigma about 2
+    *********************************************/
+   void fillNormal_moments()
+   {  // setup
+      Xoshiro256 g(3);
+      std::vector<double> values(100000);
+      // exercise
+      fillNormal(g, values.data(), values.size(), 5.0, 2.0);
+      // verify
+      double sum = 0.0;
+      double sumSquares = 0.0;
+      for (double v : values)
+      {
+         sum += v;
+         sumSquares += v * v;
+      }
+      double mean = sum / values.size();
+      double sigma = sqrt(sumSquares / values.size() - mean * mean);
+      assertUnit(fabs(mean - 5.0) < 0.03);
+      assertUnit(fabs(sigma - 2.0) < 0.03);
+   }  // teardown
+
+   /*********************************************
+    * name:    FILL NORMAL an odd number
+    * input:   3 values into an array of 4 set to -99
+    * output:  the first three are set, the fourth untouched
+    *********************************************/
+   void fillNormal_odd()
+   {  // setup
+      Philox g(4);
+      double values[4] = { -99.0, -99.0, -99.0, -99.0 };
+      // exercise
+      fillNormal(g, values, 3);
+      // verify
+      assertUnit(values[0] != -99.0 && values[1] != -99.0 && values[2] != -99.0);
+      assertEquals(values[3], -99.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    RANDOM after seedRandom
+    * input:   seed 11 twice
+    * output:  the same numbers, inside the bounds
+    *********************************************/
+   void random_seeded()
+   {  // setup
+      seedRandom(11);
+      double a = random(0.0, 1.0);
+      int b = random(5, 10);
+      seedRandom(11);
+      // exercise
+      double c = random(0.0, 1.0);
+      int d = random(5, 10);
+      // verify
+      assertEquals(a, c);
+      assertUnit(b == d);
+      assertUnit(b >= 5 && b < 10);
+   }  // teardown
+};
@@ -0,0 +1,201 @@
+/***********************************************************************
+ * Header File:
+ *    TEST RANGE CURVE
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for RangeCurve
+ ************************************************************************/
+
+
+#pragma once
+
+#include "rangeCurve.h"
+#include "firingTable.h"
+#include "unitTest.h"
+#include <cmath>
+
+
+/*******************************
+ * TEST RANGE CURVE
+ * A friend class for RangeCurve which contains its unit tests
+ ********************************/
+class TestRangeCurve : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Build
+      defaultConstructor();
+      build_cached();
+      build_rebuilt();
+
+      // Ticket 2: Lookup
+      getRange_matchesFire();
+      getRange_outside();
+      getAngles_two();
+      getAngles_tooFar();
+      getAngles_targetAbove();
+
+      report("RangeCurve");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * BUILD
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    DEFAULT CONSTRUCTOR
+    * input:   nothing
+    * output:  empty, built for nothing
+    *********************************************/
+   void defaultConstructor()
+   {  // setup
+      // exercise
+      RangeCurve c;
+      // verify
+      assertUnit(c.ranges.empty());
+      assertUnit(!c.isBuiltFor(827.0, 0.0));
+      assertEquals(c.getMaxRange(), 0.0);
+      assertEquals(c.getRange(45.0), -1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    BUILD twice with the same values
+    * input:   827m/s, 0m, 0 to 85 degrees, twice
+    * output:  the second build flies nothing
+    *********************************************/
+   void build_cached()
+   {  // setup
+      RangeCurve c;
+      c.build(827.0, 0.0, 0.0, 85.0);
+      c.ranges[0] = 12345.0;   // would be overwritten by a rebuild
+      // exercise
+      c.build(827.0, 0.0, 0.0, 85.0);
+      // verify
+      assertUnit(c.isBuiltFor(827.0, 0.0));
+      assertUnit(c.ranges.size() == 341);
+      assertEquals(c.ranges[0], 12345.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    BUILD again with a new muzzle velocity
+    * input:   827m/s then 400m/s
+    * output:  a new, shorter curve
+    *********************************************/
+   void build_rebuilt()
+   {  // setup
+      RangeCurve c;
+      c.build(827.0, 0.0, 0.0, 85.0);
+      double farthest = c.getMaxRange();
+      // exercise
+      c.build(400.0, 0.0, 0.0, 85.0);
+      // verify
+      assertUnit(c.isBuiltFor(400.0, 0.0));
+      assertUnit(!c.isBuiltFor(827.0, 0.0));
+      assertUnit(c.getMaxRange() < farthest);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * LOOKUP
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    GET RANGE agrees with flying the shell
+    * input:   827m/s at 45 and 60.1 degrees
+    * output:  within 10m of FiringTable::fire
+    *********************************************/
+   void getRange_matchesFire()
+   {  // setup
+      RangeCurve c;
+      c.build(827.0, 0.0, 0.0, 85.0);
+      // exercise
+      double range45 = c.getRange(45.0);
+      double range60 = c.getRange(60.1);
+      // verify
+      assertUnit(fabs(range45 - FiringTable::fire(45.0, 827.0).range) < 10.0);
+      assertUnit(fabs(range60 - FiringTable::fire(60.1, 827.0).range) < 10.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET RANGE outside the curve
+    * input:   angles 30 to 60, ask for 20 and 70
+    * output:  -1
+    *********************************************/
+   void getRange_outside()
+   {  // setup
+      RangeCurve c;
+      c.build(827.0, 0.0, 30.0, 60.0);
+      // exercise
+      // verify
+      assertEquals(c.getRange(20.0), -1.0);
+      assertEquals(c.getRange(70.0), -1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET ANGLES for a range with two solutions
+    * input:   827m/s, 15km
+    * output:  a steep and a flat angle on either side of the
+    *          peak, each landing within 10m of 15km
+    *********************************************/
+   void getAngles_two()
+   {  // setup
+      RangeCurve c;
+      c.build(827.0, 0.0, 0.0, 85.0);
+      double low = 0.0;
+      double high = 0.0;
+      // exercise
+      int num = c.getAngles(15000.0, low, high);
+      // verify
+      assertUnit(num == 2);
+      assertUnit(high < c.getMaxRangeAngle());
+      assertUnit(low > c.getMaxRangeAngle());
+      assertUnit(fabs(FiringTable::fire(low, 827.0).range - 15000.0) < 10.0);
+      assertUnit(fabs(FiringTable::fire(high, 827.0).range - 15000.0) < 10.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET ANGLES beyond the maximum range
+    * input:   827m/s, 30km
+    * output:  none
+    *********************************************/
+   void getAngles_tooFar()
+   {  // setup
+      RangeCurve c;
+      c.build(827.0, 0.0, 0.0, 85.0);
+      double low = -1.0;
+      double high = -1.0;
+      // exercise
+      int num = c.getAngles(30000.0, low, high);
+      // verify
+      assertUnit(num == 0);
+      assertEquals(low, -1.0);
+      assertEquals(high, -1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET ANGLES for a target on a mountain
+    * input:   827m/s, target 5000m up, 10km away
+    * output:  flat angles cannot get that high; only
+    *          the steep solution and it lands within 10m
+    *********************************************/
+   void getAngles_targetAbove()
+   {  // setup
+      RangeCurve c;
+      c.build(827.0, 5000.0, 0.0, 85.0);
+      double low = 0.0;
+      double high = 0.0;
+      // exercise
+      int num = c.getAngles(10000.0, low, high);
+      // verify
+      assertUnit(c.ranges.back() < 0.0);
+      assertUnit(num >= 1);
+      assertUnit(fabs(FiringTable::fire(high, 827.0, 5000.0).range - 10000.0) < 10.0);
+   }  // teardown
+};
@@ -0,0 +1,208 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SIMULATOR
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for Simulator
+ ************************************************************************/
+
+
+#pragma once
+
+#include "simulation.h"
+#include "unitTest.h"
+#include <cmath>
+
+
+/*******************************
+ * TEST SIMULATOR
+ * A friend class for Simulator which contains its unit tests
+ ********************************/
+class TestSimulator : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Time warp
+      timeWarp_default();
+      nextTimeWarp_cycle();
+      update_warp();
+      update_fastest();
+      update_sameFlight();
+      trail_downsampled();
+
+      // Ticket 2: Dispersion mode
+      runDispersion_aimed();
+
+      report("Simulator");
+   }
+
+private:
+
+   // Count the points in the trail
+   int numTrail(const Simulator& sim)
+   {
+      int num = 0;
+      for (const Position& pos : sim.projectilePath)
+         if (pos.getMetersX() != 0.0 || pos.getMetersY() != 0.0)
+            num++;
+      return num;
+   }
+
+   /*****************************************************************
+    *****************************************************************
+    * TIME WARP
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    TIME WARP by default
+    * input:   a new simulator
+    * output:  1x
+    *********************************************/
+   void timeWarp_default()
+   {  // setup
+      // exercise
+      Simulator sim(Viewport(40.0, 700.0, 500.0), 1);
+      // verify
+      assertEquals(sim.getTimeWarp(), 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    NEXT TIME WARP all the way around
+    * input:   1x four times
+    * output:  10x, 100x, fastest, 1x
+    *********************************************/
+   void nextTimeWarp_cycle()
+   {  // setup
+      double warp = 1.0;
+      // exercise
+      double warp10 = Simulator::nextTimeWarp(warp);
+      double warp100 = Simulator::nextTimeWarp(warp10);
+      double fastest = Simulator::nextTimeWarp(warp100);
+      double warp1 = Simulator::nextTimeWarp(fastest);
+      // verify
+      assertEquals(warp10, 10.0);
+      assertEquals(warp100, 100.0);
+      assertUnit(std::isinf(fastest));
+      assertEquals(warp1, 1.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    UPDATE at 10x
+    * input:   fire at 45 degrees, 10x, one update of 0.5s
+    * output:  5s of flight, still in the air
+    *********************************************/
+   void update_warp()
+   {  // setup
+      Simulator sim(Viewport(40.0, 700.0, 500.0), 1);
+      sim.setTimeWarp(10.0);
+      sim.fire();
+      // exercise
+      sim.update(0.5);
+      // verify
+      assertEquals(sim.getSimulationTime(), 5.0);
+      assertUnit(sim.isProjectileFlying());
+   }  // teardown
+
+   /*********************************************
+    * name:    UPDATE as fast as possible
+    * input:   fire at 45 degrees, fastest, one update of 0.5s
+    * output:  the shell has landed after a whole
+    *          number of 0.5s steps
+    *********************************************/
+   void update_fastest()
+   {  // setup
+      Simulator sim(Viewport(40.0, 700.0, 500.0), 1);
+      sim.setTimeWarp(Simulator::WARP_FASTEST);
+      sim.fire();
+      // exercise
+      sim.update(0.5);
+      // verify
+      assertUnit(!sim.isProjectileFlying());
+      assertUnit(sim.getSimulationTime() > 10.0);
+      assertEquals(fmod(sim.getSimulationTime(), 0.5), 0.0);
+      assertUnit(sim.getShotsAttempted() == 1);
+   }  // teardown
+
+   /*********************************************
+    * name:    UPDATE at 1x and 100x
+    * input:   the same shot from the same seed
+    * output:  lands at the same time with the same score
+    *********************************************/
+   void update_sameFlight()
+   {  // setup
+      Simulator slow(Viewport(40.0, 700.0, 500.0), 1);
+      Simulator fast(Viewport(40.0, 700.0, 500.0), 1);
+      fast.setTimeWarp(100.0);
+      slow.fire();
+      fast.fire();
+      // exercise
+      int numSlow = 0;
+      int numFast = 0;
+      for (; slow.isProjectileFlying() && numSlow < 10000; numSlow++)
+         slow.update(0.5);
+      for (; fast.isProjectileFlying() && numFast < 10000; numFast++)
+         fast.update(0.5);
+      // verify
+      assertEquals(fast.getSimulationTime(), slow.getSimulationTime());
+      assertUnit(fast.getScore() == slow.getScore());
+      assertUnit(numFast * 50 < numSlow);
+   }  // teardown
+
+   /*********************************************
+    * name:    TRAIL at 10x
+    * input:   10s of flight at 1x, then at 10x
+    * output:  20 points at 1x, 2 at 10x
+    *********************************************/
+   void trail_downsampled()
+   {  // setup
+      Simulator slow(Viewport(40.0, 700.0, 500.0), 1);
+      Simulator fast(Viewport(40.0, 700.0, 500.0), 1);
+      fast.setTimeWarp(10.0);
+      slow.fire();
+      fast.fire();
+      // exercise
+      for (int i = 0; i < 20; i++)
+         slow.update(0.5);
+      for (int i = 0; i < 2; i++)
+         fast.update(0.5);
+      // verify
+      assertEquals(slow.getSimulationTime(), 10.0);
+      assertEquals(fast.getSimulationTime(), 10.0);
+      assertUnit(numTrail(slow) == 20);
+      assertUnit(numTrail(fast) == 2);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * DISPERSION MODE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    RUN DISPERSION with the current aim
+    * input:   a new game, run twice
+    * output:  DISPERSION_SHOTS rounds for this aim
+    *          and round, the same spread both times
+    *********************************************/
+   void runDispersion_aimed()
+   {  // setup
+      Simulator sim(Viewport(40.0, 700.0, 500.0), 1);
+      assertUnit(!sim.hasDispersion());
+      // exercise
+      sim.runDispersion();
+      DispersionResult first = sim.getDispersion();
+      sim.runDispersion();
+      // verify
+      assertUnit(sim.hasDispersion());
+      assertUnit(sim.getDispersion().numShots == DISPERSION_SHOTS);
+      assertUnit(sim.getDispersion().numLanded > 0);
+      assertUnit(0.0 <= sim.getDispersion().hitProbability &&
+                 sim.getDispersion().hitProbability <= 1.0);
+      assertEquals(sim.getDispersion().cep, first.cep);
+      assertEquals(sim.dispersionElevation, sim.getHowitzer().getElevation().getRadians());
+      assertUnit(sim.dispersionRound == sim.getRound());
+   }  // teardown
+};
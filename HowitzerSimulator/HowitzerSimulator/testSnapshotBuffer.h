@@ -0,0 +1,193 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SNAPSHOT BUFFER
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for SnapshotBuffer
+ ************************************************************************/
+
+
+#pragma once
+
+#include "snapshotBuffer.h"
+#include "unitTest.h"
+#include <thread>
+#include <atomic>
+
+
+/*******************************
+ * TEST SNAPSHOT BUFFER
+ * A friend class for SnapshotBuffer which contains its unit tests
+ ********************************/
+class TestSnapshotBuffer : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: One thread
+      constructor();
+      acquire_nothing();
+      acquire_one();
+      acquire_newest();
+      publish_neverFront();
+
+      // Ticket 2: Two threads
+      threads_neverTorn();
+
+      report("SnapshotBuffer");
+   }
+
+private:
+
+   // Something too big to copy in one instruction
+   struct Pair
+   {
+      int a = 0;
+      int b = 0;
+   };
+
+   /*****************************************************************
+    *****************************************************************
+    * ONE THREAD
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    CONSTRUCTOR
+    * input:   nothing
+    * output:  three different slots, nothing fresh
+    *********************************************/
+   void constructor()
+   {  // setup
+      // exercise
+      SnapshotBuffer<int> buffer;
+      // verify
+      assertUnit(buffer.iFront == 0);
+      assertUnit(buffer.middle == 1);
+      assertUnit(buffer.iBack == 2);
+   }  // teardown
+
+   /*********************************************
+    * name:    ACQUIRE with nothing published
+    * input:   an empty buffer
+    * output:  false, and front stays put
+    *********************************************/
+   void acquire_nothing()
+   {  // setup
+      SnapshotBuffer<int> buffer;
+      buffer.slots[0] = 7;
+      // exercise
+      bool isNew = buffer.acquire();
+      // verify
+      assertUnit(!isNew);
+      assertUnit(buffer.front() == 7);
+   }  // teardown
+
+   /*********************************************
+    * name:    ACQUIRE one value
+    * input:   publish 42
+    * output:  front is 42, then nothing new
+    *********************************************/
+   void acquire_one()
+   {  // setup
+      SnapshotBuffer<int> buffer;
+      buffer.back() = 42;
+      buffer.publish();
+      // exercise
+      bool isNew = buffer.acquire();
+      bool isNewAgain = buffer.acquire();
+      // verify
+      assertUnit(isNew);
+      assertUnit(!isNewAgain);
+      assertUnit(buffer.front() == 42);
+   }  // teardown
+
+   /*********************************************
+    * name:    ACQUIRE after several publishes
+    * input:   publish 1, 2, 3
+    * output:  front is 3
+    *********************************************/
+   void acquire_newest()
+   {  // setup
+      SnapshotBuffer<int> buffer;
+      for (int i = 1; i <= 3; i++)
+      {
+         buffer.back() = i;
+         buffer.publish();
+      }
+      // exercise
+      buffer.acquire();
+      // verify
+      assertUnit(buffer.front() == 3);
+   }  // teardown
+
+   /*********************************************
+    * name:    PUBLISH never hands the writer the front
+    * input:   acquire between every publish
+    * output:  back is never the slot the reader has
+    *********************************************/
+   void publish_neverFront()
+   {  // setup
+      SnapshotBuffer<int> buffer;
+      bool isApart = true;
+      // exercise
+      for (int i = 0; i < 10; i++)
+      {
+         buffer.publish();
+         isApart = isApart && buffer.iBack != buffer.iFront;
+         if (i % 3 == 0)
+            buffer.acquire();
+         isApart = isApart && buffer.iBack != buffer.iFront;
+      }
+      // verify
+      assertUnit(isApart);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * TWO THREADS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    THREADS never see a torn value
+    * input:   a writer publishing (i, -i) 100000 times
+    * output:  the reader always sees a == -b, and
+    *          never goes backwards
+    *********************************************/
+   void threads_neverTorn()
+   {  // setup
+      SnapshotBuffer<Pair> buffer;
+      std::atomic<bool> isDone(false);
+      bool isWhole = true;
+      bool isForward = true;
+      // exercise
+      std::thread writer([&]()
+      {
+         for (int i = 1; i <= 100000; i++)
+         {
+            buffer.back().a = i;
+            buffer.back().b = -i;
+            buffer.publish();
+         }
+         isDone = true;
+      });
+      int last = 0;
+      bool isFinished = false;
+      while (!isFinished)
+      {
+         isFinished = isDone;   // before acquire(), so the last publish is seen
+         buffer.acquire();
+         const Pair& pair = buffer.front();
+         isWhole = isWhole && pair.a == -pair.b;
+         isForward = isForward && pair.a >= last;
+         last = pair.a;
+      }
+      writer.join();
+      // verify
+      assertUnit(isWhole);
+      assertUnit(isForward);
+      assertUnit(last == 100000);
+   }  // teardown
+};
@@ -0,0 +1,189 @@
+/***********************************************************************
+ * Header File:
+ *    TEST THREAD POOL
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    All the unit tests for ThreadPool
+ ************************************************************************/
+
+
+#pragma once
+
+#include "threadPool.h"
+#include "unitTest.h"
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+
+/*******************************
+ * TEST THREAD POOL
+ * A friend class for ThreadPool which contains its unit tests
+ ********************************/
+class TestThreadPool : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Setup
+      constructor_one();
+      constructor_four();
+
+      // Ticket 2: Parallel for
+      parallelFor_empty();
+      parallelFor_everyIndexOnce();
+      parallelFor_chunks();
+      parallelFor_uneven();
+      parallelFor_again();
+
+      report("ThreadPool");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * SETUP
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    CONSTRUCTOR with one thread
+    * input:   1
+    * output:  one queue and no worker threads
+    *********************************************/
+   void constructor_one()
+   {  // setup
+      // exercise
+      ThreadPool pool(1);
+      // verify
+      assertUnit(pool.getNumThreads() == 1);
+      assertUnit(pool.threads.empty());
+      assertUnit(pool.getNumSteals() == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CONSTRUCTOR with four threads
+    * input:   4
+    * output:  four queues, three workers beside the caller
+    *********************************************/
+   void constructor_four()
+   {  // setup
+      // exercise
+      ThreadPool pool(4);
+      // verify
+      assertUnit(pool.getNumThreads() == 4);
+      assertUnit(pool.threads.size() == 3);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * PARALLEL FOR
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    PARALLEL FOR nothing
+    * input:   count=0
+    * output:  the body is never called
+    *********************************************/
+   void parallelFor_empty()
+   {  // setup
+      ThreadPool pool(4);
+      int numCalls = 0;
+      // exercise
+      pool.parallelFor(0, 10, [&](size_t, size_t) { numCalls++; });
+      // verify
+      assertUnit(numCalls == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    PARALLEL FOR visits every index once
+    * input:   10000 indices, grain 7, 4 threads
+    * output:  each index counted exactly once
+    *********************************************/
+   void parallelFor_everyIndexOnce()
+   {  // setup
+      ThreadPool pool(4);
+      std::vector<std::atomic<int>> counts(10000);
+      // exercise
+      pool.parallelFor(counts.size(), 7, [&](size_t begin, size_t end)
+      {
+         for (size_t i = begin; i < end; i++)
+            counts[i]++;
+      });
+      // verify
+      bool isOnce = true;
+      for (const std::atomic<int>& count : counts)
+         isOnce = isOnce && count == 1;
+      assertUnit(isOnce);
+      assertUnit(pool.numRemaining == 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    PARALLEL FOR chunk sizes
+    * input:   10 indices, grain 4, one thread
+    * output:  chunks [0,4) [4,8) [8,10) in order
+    *********************************************/
+   void parallelFor_chunks()
+   {  // setup
+      ThreadPool pool(1);
+      std::vector<size_t> bounds;
+      // exercise
+      pool.parallelFor(10, 4, [&](size_t begin, size_t end)
+      {
+         bounds.push_back(begin);
+         bounds.push_back(end);
+      });
+      // verify
+      assertUnit(bounds == std::vector<size_t>({ 0, 4, 4, 8, 8, 10 }));
+   }  // teardown
+
+   /*********************************************
+    * name:    PARALLEL FOR with all the work in one queue
+    * input:   64 chunks, the first 16 (thread 0's share) slow
+    * output:  everything done; idle threads stole some of
+    *          thread 0's chunks
+    *********************************************/
+   void parallelFor_uneven()
+   {  // setup
+      ThreadPool pool(4);
+      std::atomic<int> numDone(0);
+      // exercise
+      pool.parallelFor(64, 1, [&](size_t begin, size_t)
+      {
+         if (begin < 16)
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+         numDone++;
+      });
+      // verify
+      assertUnit(numDone == 64);
+      assertUnit(pool.getNumSteals() > 0);
+   }  // teardown
+
+   /*********************************************
+    * name:    PARALLEL FOR many times on the same pool
+    * input:   100 loops of 1000 indices
+    * output:  every loop finishes with the full sum
+    *********************************************/
+   void parallelFor_again()
+   {  // setup
+      ThreadPool pool(4);
+      bool isComplete = true;
+      // exercise
+      for (int loop = 0; loop < 100; loop++)
+      {
+         std::atomic<size_t> sum(0);
+         pool.parallelFor(1000, 16, [&](size_t begin, size_t end)
+         {
+            for (size_t i = begin; i < end; i++)
+               sum += i;
+         });
+         isComplete = isComplete && sum == 999 * 1000 / 2;
+      }
+      // verify
+      assertUnit(isComplete);
+   }  // teardown
+};
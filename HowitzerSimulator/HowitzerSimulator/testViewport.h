@@ -0,0 +1,328 @@
+/***********************************************************************
+ * Header File:
+ *    TEST VIEWPORT
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Unit tests for the Viewport class: zoom, size and the conversions
+ *    between meters and pixels
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+#include "viewport.h"
+#include "position.h"
+
+/*******************************
+ * TEST VIEWPORT
+ * A friend class for Viewport which contains the Viewport unit tests
+ ********************************/
+class TestViewport : public UnitTest
+{
+public:
+   void run()
+   {
+      // Ticket 1: Zoom and size
+      construct_default();
+      construct_nonDefault();
+      setZoom();
+      setZoom_independent();
+      getUpperRight();
+
+      // Ticket 2: Meters to pixels
+      toPixelsX_noZoom();
+      toPixelsX_zoom();
+      toPixelsY_noZoom();
+      toPixelsY_zoom();
+      toPixels_point();
+
+      // Ticket 3: Pixels to meters
+      toMeters_zoom();
+      toPosition_zoom();
+      addPixels_noZoom();
+      addPixels_zoom();
+      contains_inside();
+      contains_outside();
+
+      report("Viewport");
+   }
+
+private:
+
+   /*****************************************************************
+    *****************************************************************
+    * ZOOM AND SIZE
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    DEFAULT CONSTRUCTOR
+    * input:   nothing
+    * output:  40 meters a pixel, no size
+    *********************************************/
+   void construct_default()
+   {  // setup
+      // exercise
+      Viewport viewport;
+      // verify
+      assertEquals(viewport.metersFromPixels, 40.0);
+      assertEquals(viewport.pixelsFromMeters, 0.025);
+      assertEquals(viewport.widthPixels, 0.0);
+      assertEquals(viewport.heightPixels, 0.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    NON-DEFAULT CONSTRUCTOR
+    * input:   zoom 100, 700 x 500 pixels
+    * output:  the inverse of the zoom is kept
+    *********************************************/
+   void construct_nonDefault()
+   {  // setup
+      // exercise
+      Viewport viewport(100.0, 700.0, 500.0);
+      // verify
+      assertEquals(viewport.metersFromPixels, 100.0);
+      assertEquals(viewport.pixelsFromMeters, 0.01);
+      assertEquals(viewport.getWidthPixels(), 700.0);
+      assertEquals(viewport.getHeightPixels(), 500.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    SET ZOOM
+    * input:   zoom 99.9, setZoom(123.4)
+    * output:  zoom 123.4 and its inverse
+    *********************************************/
+   void setZoom()
+   {  // setup
+      Viewport viewport(99.9);
+      // exercise
+      viewport.setZoom(123.4);
+      // verify
+      assertEquals(viewport.getZoom(), 123.4);
+      assertEquals(viewport.pixelsFromMeters, 1.0 / 123.4);
+   }  // teardown
+
+   /*********************************************
+    * name:    SET ZOOM on one viewport of two
+    *          There is no static zoom any more
+    * input:   viewport1 zoom 99.9, viewport2 zoom 88.9,
+    *          viewport2.setZoom(123.4)
+    * output:  viewport1 zoom 99.9, viewport2 zoom 123.4
+    *********************************************/
+   void setZoom_independent()
+   {  // setup
+      Viewport viewport1(99.9);
+      Viewport viewport2(88.9);
+      // exercise
+      viewport2.setZoom(123.4);
+      // verify
+      assertEquals(viewport1.getZoom(), 99.9);
+      assertEquals(viewport2.getZoom(), 123.4);
+   }  // teardown
+
+   /*********************************************
+    * name:    GET UPPER RIGHT
+    * input:   zoom 40, 700 x 500 pixels
+    * output:  (28000, 20000) meters
+    *********************************************/
+   void getUpperRight()
+   {  // setup
+      Viewport viewport(40.0, 700.0, 500.0);
+      // exercise
+      Position pos = viewport.getUpperRight();
+      // verify
+      assertEquals(pos.getMetersX(), 28000.0);
+      assertEquals(pos.getMetersY(), 20000.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * METERS TO PIXELS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    TO PIXELS X NO ZOOM
+    * input:   pos=(123.4, 567.8) zoom 1
+    * output:  x=123.4
+    *********************************************/
+   void toPixelsX_noZoom()
+   {  // setup
+      Viewport viewport(1.0);
+      Position pos(123.4, 567.8);
+      // exercise
+      double x = viewport.toPixelsX(pos);
+      // verify
+      assertEquals(x, 123.4);
+      assertEquals(pos.getMetersX(), 123.4);
+      assertEquals(pos.getMetersY(), 567.8);
+   }  // teardown
+
+   /*********************************************
+    * name:    TO PIXELS X ZOOM
+    *          pixels = meters / metersFromPixels
+    * input:   pos=(123.4, 567.8) zoom 100
+    * output:  x=1.234
+    *********************************************/
+   void toPixelsX_zoom()
+   {  // setup
+      Viewport viewport(100.0);
+      Position pos(123.4, 567.8);
+      // exercise
+      double x = viewport.toPixelsX(pos);
+      // verify
+      assertEquals(x, 1.234);
+      assertEquals(pos.getMetersX(), 123.4);
+   }  // teardown
+
+   /*********************************************
+    * name:    TO PIXELS Y NO ZOOM
+    * input:   pos=(123.4, 567.8) zoom 1
+    * output:  y=567.8
+    *********************************************/
+   void toPixelsY_noZoom()
+   {  // setup
+      Viewport viewport(1.0);
+      Position pos(123.4, 567.8);
+      // exercise
+      double y = viewport.toPixelsY(pos);
+      // verify
+      assertEquals(y, 567.8);
+      assertEquals(pos.getMetersY(), 567.8);
+   }  // teardown
+
+   /*********************************************
+    * name:    TO PIXELS Y ZOOM
+    * input:   pos=(123.4, 567.8) zoom 100
+    * output:  y=5.678
+    *********************************************/
+   void toPixelsY_zoom()
+   {  // setup
+      Viewport viewport(100.0);
+      Position pos(123.4, 567.8);
+      // exercise
+      double y = viewport.toPixelsY(pos);
+      // verify
+      assertEquals(y, 5.678);
+      assertEquals(pos.getMetersY(), 567.8);
+   }  // teardown
+
+   /*********************************************
+    * name:    TO PIXELS a whole point
+    * input:   pos=(4000, 2000) zoom 40
+    * output:  (100, 50)
+    *********************************************/
+   void toPixels_point()
+   {  // setup
+      Viewport viewport(40.0);
+      Position pos(4000.0, 2000.0);
+      // exercise
+      PT pt = viewport.toPixels(pos);
+      // verify
+      assertEquals(pt.x, 100.0);
+      assertEquals(pt.y, 50.0);
+   }  // teardown
+
+   /*****************************************************************
+    *****************************************************************
+    * PIXELS TO METERS
+    *****************************************************************
+    *****************************************************************/
+
+   /*********************************************
+    * name:    TO METERS ZOOM
+    *          meters = pixels * metersFromPixels
+    * input:   123.4 pixels, zoom 100
+    * output:  12340 meters
+    *********************************************/
+   void toMeters_zoom()
+   {  // setup
+      Viewport viewport(100.0);
+      // exercise
+      double meters = viewport.toMeters(123.4);
+      // verify
+      assertEquals(meters, 12340.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    TO POSITION ZOOM
+    * input:   (123.4, 5.0) pixels, zoom 100
+    * output:  pos=(12340, 500)
+    *********************************************/
+   void toPosition_zoom()
+   {  // setup
+      Viewport viewport(100.0);
+      // exercise
+      Position pos = viewport.toPosition(123.4, 5.0);
+      // verify
+      assertEquals(pos.getMetersX(), 12340.0);
+      assertEquals(pos.getMetersY(), 500.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD PIXELS NO ZOOM
+    * input:   pos=(4500,2500) x=3 y=-2 pixels zoom 1
+    * output:  pos=(4503,2498)
+    *********************************************/
+   void addPixels_noZoom()
+   {  // setup
+      Viewport viewport(1.0);
+      Position pos(4500.0, 2500.0);
+      // exercise
+      viewport.addPixels(pos, 3.0, -2.0);
+      // verify
+      assertEquals(pos.getMetersX(), 4503.0);
+      assertEquals(pos.getMetersY(), 2498.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    ADD PIXELS ZOOM
+    * input:   pos=(4500,2500) x=3 y=-2 pixels zoom 50
+    * output:  pos=(4650,2400)
+    *********************************************/
+   void addPixels_zoom()
+   {  // setup
+      Viewport viewport(50.0);
+      Position pos(4500.0, 2500.0);
+      // exercise
+      viewport.addPixels(pos, 3.0, -2.0);
+      // verify
+      assertEquals(pos.getMetersX(), 4650.0);
+      assertEquals(pos.getMetersY(), 2400.0);
+   }  // teardown
+
+   /*********************************************
+    * name:    CONTAINS a point on the screen
+    * input:   zoom 10, 100 x 50 pixels, pos=(990, 0)
+    * output:  true
+    *********************************************/
+   void contains_inside()
+   {  // setup
+      Viewport viewport(10.0, 100.0, 50.0);
+      Position pos(990.0, 0.0);
+      // exercise
+      bool isInside = viewport.contains(pos);
+      // verify
+      assertUnit(isInside);
+   }  // teardown
+
+   /*********************************************
+    * name:    CONTAINS points off the screen
+    * input:   zoom 10, 100 x 50 pixels,
+    *          pos=(1000, 10), (10, 500), (-1, 10)
+    * output:  false for all three
+    *********************************************/
+   void contains_outside()
+   {  // setup
+      Viewport viewport(10.0, 100.0, 50.0);
+      // exercise
+      bool isRight = viewport.contains(Position(1000.0, 10.0));
+      bool isAbove = viewport.contains(Position(10.0, 500.0));
+      bool isLeft = viewport.contains(Position(-1.0, 10.0));
+      // verify
+      assertUnit(!isRight);
+      assertUnit(!isAbove);
+      assertUnit(!isLeft);
+   }  // teardown
+};
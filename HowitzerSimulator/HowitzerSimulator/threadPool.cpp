@@ -0,0 +1,165 @@
+/***********************************************************************
+ * Source File:
+ *    THREAD POOL
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    A fixed set of worker threads that split a loop between them,
+ *    each stealing from the others when it runs out of work
+ ************************************************************************/
+
+#include "threadPool.h"
+#include "profiler.h"
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+/*********************************************
+ * THREAD POOL : CONSTRUCTOR
+ * The workers start right away and sleep until
+ * there is a loop to run
+ *********************************************/
+ThreadPool::ThreadPool(unsigned int numThreads) :
+   body(nullptr), generation(0), isStopping(false),
+   numRemaining(0), numSteals(0)
+{
+   if (numThreads == 0)
+      numThreads = max(1u, thread::hardware_concurrency());
+
+   for (unsigned int i = 0; i < numThreads; i++)
+      queues.push_back(make_unique<Queue>());
+   for (unsigned int i = 1; i < numThreads; i++)
+      threads.emplace_back(&ThreadPool::workerMain, this, i);
+}
+
+/*********************************************
+ * THREAD POOL : DESTRUCTOR
+ *********************************************/
+ThreadPool::~ThreadPool()
+{
+   {
+      lock_guard<std::mutex> lock(mutex);
+      isStopping = true;
+   }
+   wake.notify_all();
+   for (thread& t : threads)
+      t.join();
+}
+
+/*********************************************
+ * THREAD POOL : PARALLEL FOR
+ * Thread i gets the i-th contiguous run of chunks,
+ * so with even work nobody needs to steal
+ *********************************************/
+void ThreadPool::parallelFor(size_t count, size_t grain,
+                             const function<void(size_t, size_t)>& body)
+{
+   if (count == 0)
+      return;
+   grain = max((size_t)1, grain);
+
+   size_t numChunks = (count + grain - 1) / grain;
+   size_t numQueues = queues.size();
+   assert(numRemaining == 0);
+   this->body = &body;
+   numRemaining = numChunks;
+
+   for (size_t q = 0; q < numQueues; q++)
+   {
+      size_t first = numChunks * q / numQueues;
+      size_t last = numChunks * (q + 1) / numQueues;
+      lock_guard<std::mutex> lock(queues[q]->mutex);
+      for (size_t c = first; c < last; c++)
+         queues[q]->chunks.push_back(Chunk{ c * grain, min(count, (c + 1) * grain) });
+   }
+
+   {
+      lock_guard<std::mutex> lock(mutex);
+      generation++;
+   }
+   wake.notify_all();
+
+   // do our share, then wait for the chunks others are still running
+   work(0);
+   unique_lock<std::mutex> lock(mutex);
+   done.wait(lock, [this]() { return numRemaining == 0; });
+   this->body = nullptr;
+}
+
+/*********************************************
+ * THREAD POOL : POP
+ *********************************************/
+bool ThreadPool::pop(unsigned int self, Chunk& chunk)
+{
+   Queue& queue = *queues[self];
+   lock_guard<std::mutex> lock(queue.mutex);
+   if (queue.chunks.empty())
+      return false;
+   chunk = queue.chunks.front();
+   queue.chunks.pop_front();
+   return true;
+}
+
+/*********************************************
+ * THREAD POOL : STEAL
+ * Visit the others starting with our neighbor so
+ * that thieves spread out over the victims
+ *********************************************/
+bool ThreadPool::steal(unsigned int self, Chunk& chunk)
+{
+   size_t numQueues = queues.size();
+   for (size_t i = 1; i < numQueues; i++)
+   {
+      Queue& victim = *queues[(self + i) % numQueues];
+      lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.chunks.empty())
+      {
+         chunk = victim.chunks.back();
+         victim.chunks.pop_back();
+         numSteals++;
+         return true;
+      }
+   }
+   return false;
+}
+
+/*********************************************
+ * THREAD POOL : WORK
+ * No chunk is ever added once a loop starts, so
+ * finding every queue empty means we are done
+ *********************************************/
+void ThreadPool::work(unsigned int self)
+{
+   Chunk chunk;
+   while (pop(self, chunk) || steal(self, chunk))
+   {
+      (*body)(chunk.begin, chunk.end);
+      if (--numRemaining == 0)
+      {
+         // take the lock so the caller cannot miss the notify
+         lock_guard<std::mutex> lock(mutex);
+         done.notify_all();
+      }
+   }
+}
+
+/*********************************************
+ * THREAD POOL : WORKER MAIN
+ *********************************************/
+void ThreadPool::workerMain(unsigned int self)
+{
+   Profiler::setThreadName("worker");
+   size_t seen = 0;
+   while (true)
+   {
+      {
+         unique_lock<std::mutex> lock(mutex);
+         wake.wait(lock, [&]() { return isStopping || generation != seen; });
+         if (isStopping)
+            return;
+         seen = generation;
+      }
+      work(self);
+   }
+}
@@ -0,0 +1,94 @@
+/***********************************************************************
+ * Header File:
+ *    THREAD POOL
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    A fixed set of worker threads that split a loop between them,
+ *    each stealing from the others when it runs out of work
+ ************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <cstddef>
+
+// Forward declaration for the unit tests
+class TestThreadPool;
+
+/*********************************************
+ * THREAD POOL
+ * parallelFor() cuts [0, count) into chunks and
+ * deals a contiguous run of them to each thread's
+ * own queue. A thread takes from the front of its
+ * own queue; when that is empty it steals from
+ * the back of someone else's. Threads that finish
+ * early help the slow ones instead of waiting, so
+ * uneven work still keeps every core busy. The
+ * calling thread is one of the workers
+ *********************************************/
+class ThreadPool
+{
+public:
+   friend ::TestThreadPool;
+
+   // Zero threads means one per core
+   ThreadPool(unsigned int numThreads = 0);
+   ~ThreadPool();
+
+   ThreadPool(const ThreadPool&) = delete;
+   ThreadPool& operator=(const ThreadPool&) = delete;
+
+   // Call body(begin, end) on chunks of at most grain indices until
+   // all of [0, count) is done. Only one loop may run at a time
+   void parallelFor(size_t count, size_t grain,
+                    const std::function<void(size_t, size_t)>& body);
+
+   unsigned int getNumThreads() const { return (unsigned int)queues.size(); }
+
+   // Chunks taken from another thread's queue, since the pool was made
+   size_t getNumSteals() const { return numSteals; }
+
+private:
+   struct Chunk
+   {
+      size_t begin;
+      size_t end;
+   };
+
+   struct Queue
+   {
+      std::mutex mutex;
+      std::deque<Chunk> chunks;
+   };
+
+   // Take from our own queue, or failing that from someone else's
+   bool pop(unsigned int self, Chunk& chunk);
+   bool steal(unsigned int self, Chunk& chunk);
+
+   // Run chunks until every queue is empty
+   void work(unsigned int self);
+
+   // What each worker thread does between loops
+   void workerMain(unsigned int self);
+
+   std::vector<std::unique_ptr<Queue>> queues;   // one per thread, 0 is the caller
+   std::vector<std::thread> threads;             // the workers, 1 and up
+   const std::function<void(size_t, size_t)>* body;   // the loop being run
+
+   std::mutex mutex;                 // guards generation and isStopping
+   std::condition_variable wake;     // a loop has started or we are stopping
+   std::condition_variable done;     // the last chunk has finished
+   size_t generation;                // loops started so far
+   bool isStopping;
+
+   std::atomic<size_t> numRemaining; // chunks of this loop not yet finished
+   std::atomic<size_t> numSteals;
+};
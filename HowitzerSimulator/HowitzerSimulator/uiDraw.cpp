@@ -14,6 +14,8 @@
 #include <sstream>    // convert an integer into text
 #include <cassert>    // I feel the need... the need for asserts
 #include <time.h>     // for clock
+#include <vector>     // for the glyphs of a frame
+#include <cmath>      // for floor()
 
 
 #ifdef __APPLE__
@@ -40,26 +42,12 @@
 
 #include "position.h"
 #include "uiDraw.h"
+#include "glyphAtlas.h"
+#include "profiler.h"
 
 using namespace std;
 
-Position rotatePosition(const Position& origin, double x, double y, double rotation);
-
-
-/*************************************************************************
- * QUAD
- * Four points and a color
- *************************************************************************/
-struct Quad
-{
-   PT pt1;
-   PT pt2;
-   PT pt3;
-   PT pt4;
-   GLfloat r;
-   GLfloat g;
-   GLfloat b;
-};
+#define TARGET_SIZE 10.0   // pixels on a side
 
 /*************************************************************************
  * GL RESET COLOR
@@ -73,61 +61,193 @@ inline void glResetColor()
 
 /*************************************************************************
  * GL VERTEXT POINT
- * Just a more convenient format of glVertext2f
+ * Just a more convenient format of glVertext2f. The point is in pixels
  *************************************************************************/
-inline void glVertexPoint(const Position & pos)
+inline void glVertexPoint(const PT & pt)
 {
-   glVertex2f((GLfloat)pos.getPixelsX(), (GLfloat)pos.getPixelsY());
+   glVertex2f((GLfloat)pt.x, (GLfloat)pt.y);
 }
 
 /*************************************************************************
- * DISPLAY the results on the screen
+ * FONT
+ * The bitmap font, baked into a texture the first time it is needed, and
+ * the glyphs of the text waiting to be drawn from it
  *************************************************************************/
-void ogstream :: flush()
+static GlyphAtlas atlas;
+static GLuint textureFont = 0;
+static vector<GlyphVertex> glyphs;
+
+// glBegin() and glDrawArrays() calls since the program started
+static uint64_t numDrawCalls = 0;
+
+/*************************************************************************
+ * GL BAKE FONT
+ * Draw every character of the font, white on black, into its cell in the
+ * corner of the back buffer, and read that back as the alpha of a
+ * texture. This clears the back buffer, so do it before the frame is
+ * drawn: see ogstream::bakeFont()
+ *************************************************************************/
+static void glBakeFont()
 {
-   string sOut;
-   string sIn = str();
+   if (textureFont != 0)
+      return;
 
-   // copy everything but the newlines
-   for (string::iterator it = sIn.begin(); it != sIn.end(); ++it)
-      // newline triggers an buffer flush and a move down
-      if (*it == '\n')
-      {
-         drawText(pos, sOut.c_str());
-         sOut.clear();
-         pos.addPixelsY(-18);
-      }
-      // othewise append
-      else
-         sOut += *it;
-
-   // put the text on the screen
-   if (!sOut.empty())
+   void *pFont = GLUT_TEXT;
+   int width = GlyphAtlas::getWidth();
+   int height = GlyphAtlas::getHeight();
+
+   // every character in its cell
+   GLfloat clearColor[4];
+   glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+   glClearColor(0.0, 0.0, 0.0, 0.0);
+   glClear(GL_COLOR_BUFFER_BIT);
+   glColor3f(1.0 /* red % */, 1.0 /* green % */, 1.0 /* blue % */);
+   for (int c = GLYPH_FIRST; c <= GLYPH_LAST; c++)
    {
-      drawText(pos, sOut.c_str());
-      pos.addPixelsY(-18);
+      PT origin = GlyphAtlas::getOrigin((unsigned char)c);
+      glRasterPos2f((GLfloat)origin.x, (GLfloat)origin.y);
+      glutBitmapCharacter(pFont, c);
+      atlas.setAdvance((unsigned char)c, glutBitmapWidth(pFont, c));
    }
+
+   // read it back: how white the pixel is, is how opaque
+   vector<GLubyte> pixels(width * height);
+   glPixelStorei(GL_PACK_ALIGNMENT, 1);
+   glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+   glReadBuffer(GL_BACK);
+   glReadPixels(0, 0, width, height, GL_LUMINANCE, GL_UNSIGNED_BYTE, pixels.data());
+
+   glGenTextures(1, &textureFont);
+   glBindTexture(GL_TEXTURE_2D, textureFont);
+   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0,
+                GL_ALPHA, GL_UNSIGNED_BYTE, pixels.data());
+
+   // put the window back the way it was
+   glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+   glClear(GL_COLOR_BUFFER_BIT);
+   glResetColor();
+}
+
+/*************************************************************************
+ * GL ADD TEXT
+ * Queue up a string to be drawn by glDrawGlyphs(). The point is in
+ * pixels, and is snapped to one so the characters stay sharp
+ *************************************************************************/
+static void glAddText(const PT & pt, const char * text)
+{
+   atlas.addText(glyphs, PT(floor(pt.x + 0.5), floor(pt.y + 0.5)), text);
+}
+
+/*************************************************************************
+ * GL DRAW GLYPHS
+ * Draw all the queued text in one call, in the current color, and empty
+ * the queue
+ *************************************************************************/
+static void glDrawGlyphs()
+{
+   if (glyphs.empty())
+      return;
+   assert(textureFont != 0);   // ogstream::bakeFont() comes first
+
+   // the atlas, with its alpha blended over what is already there
+   glEnable(GL_TEXTURE_2D);
+   glBindTexture(GL_TEXTURE_2D, textureFont);
+   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+   glEnable(GL_BLEND);
+   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+   // all of it at once
+   glEnableClientState(GL_VERTEX_ARRAY);
+   glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+   glVertexPointer(2, GL_FLOAT, sizeof(GlyphVertex), &glyphs.data()->x);
+   glTexCoordPointer(2, GL_FLOAT, sizeof(GlyphVertex), &glyphs.data()->u);
+   glDrawArrays(GL_TRIANGLES, 0, (GLsizei)glyphs.size());
+   numDrawCalls++;
+
+   // put things back the way glBegin() expects them
+   glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+   glDisableClientState(GL_VERTEX_ARRAY);
+   glDisable(GL_BLEND);
+   glDisable(GL_TEXTURE_2D);
+   glyphs.clear();
+}
+
+/*************************************************************************
+ * GET NUM DRAW CALLS
+ * Every call that sent geometry to the card, so far. The difference
+ * between two frames is the calls one frame took
+ *************************************************************************/
+uint64_t ogstream :: getNumDrawCalls()
+{
+   return numDrawCalls;
+}
+
+/*************************************************************************
+ * BAKE FONT
+ * The font texture, made once. Never from a draw call: baking clears
+ * the back buffer, and with it anything drawn so far this frame
+ *************************************************************************/
+void ogstream :: bakeFont()
+{
+   glBakeFont();
+}
+
+/*************************************************************************
+ * DISPLAY the results on the screen
+ *************************************************************************/
+void ogstream :: flush()
+{
+   string sIn = str();
+   if (sIn.empty())
+      return;
+   PROFILE_ZONE("ogstream::flush");
    
    // reset the buffer
    str("");
+
+   // each newline ends a line: terminate it there and draw it in place
+   size_t iBegin = 0;
+   for (size_t iEnd = sIn.find('\n'); iEnd != string::npos; iEnd = sIn.find('\n', iBegin))
+   {
+      sIn[iEnd] = '\0';
+      drawTextLine(sIn.c_str() + iBegin);
+      iBegin = iEnd + 1;
+   }
+
+   // put the rest on the screen
+   if (iBegin < sIn.size())
+      drawTextLine(sIn.c_str() + iBegin);
+}
+
+/*************************************************************************
+ * DRAW TEXT LINE
+ * Draw one line of text where the next one goes, then move down. This
+ * skips the stream, so text that is already formatted costs nothing
+ * more than drawing it
+ *   INPUT  text      The text to be displayed, without a newline
+ ************************************************************************/
+void ogstream :: drawTextLine(const char * text)
+{
+   // anything streamed so far goes first
+   if (tellp() > 0)
+      flush();
+
+   drawText(pos, text);
+   viewport.addPixels(pos, 0.0, -18.0);
 }
 
 /*************************************************************************
  * DRAW TEXT
- * Draw text using a simple bitmap font
+ * Draw text from the font atlas, in one call
  *   INPUT  topLeft   The top left corner of the text
  *          text      The text to be displayed
  ************************************************************************/
 void ogstream :: drawText(const Position & topLeft, const char * text)
 {
-   void *pFont = GLUT_TEXT;
-
-   // prepare to draw the text from the top-left corner
-   glRasterPos2f((GLfloat)topLeft.getPixelsX(), (GLfloat)topLeft.getPixelsY());
-
-   // loop through the text
-   for (const char *p = text; *p; p++)
-      glutBitmapCharacter(pFont, *p);
+   glAddText(viewport.toPixels(topLeft), text);
+   glDrawGlyphs();
 }
 
 /************************************************************************
@@ -142,12 +262,10 @@ void ogstream :: drawProjectile(const Position& pos, double age)
 
    GLfloat color = (GLfloat)(age / tailLength);
    
-   Position posBegin;
-   Position posEnd;
-   posBegin.setPixelsX(pos.getPixelsX() - 1.5);
-   posBegin.setPixelsY(pos.getPixelsY() - 1.5);
-   posEnd.setPixelsX(pos.getPixelsX() + 1.5);
-   posEnd.setPixelsY(pos.getPixelsY() + 1.5);
+   Position posBegin(pos);
+   Position posEnd(pos);
+   viewport.addPixels(posBegin, -1.5, -1.5);
+   viewport.addPixels(posEnd, 1.5, 1.5);
    drawRectangle(posBegin, posEnd, color /* red % */, color /* green % */, color /* blue % */);
 }
 
@@ -163,11 +281,12 @@ void ogstream :: drawLine(const Position & begin, const Position & end,
 {
    // Get ready...
    glBegin(GL_LINES);
+   numDrawCalls++;
    glColor3f((GLfloat)red, (GLfloat)green, (GLfloat)blue);
 
    // Draw the actual line
-   glVertexPoint(begin);
-   glVertexPoint(end);
+   glVertexPoint(viewport.toPixels(begin));
+   glVertexPoint(viewport.toPixels(end));
 
    // Complete drawing
    glResetColor();
@@ -175,21 +294,28 @@ void ogstream :: drawLine(const Position & begin, const Position & end,
 }
 
 /************************************************************************
-* DRAW QUAD
-* Draw a quad on the screen from the beginning to the end.
-*   INPUT QUAD
+* DRAW RECTRANGLE
+* Draw a rectangle on the screen from the beginning to the end.
+*   INPUT  begin     The position of the beginning of the line
+*          end       The position of the end of the line
+*          r/g/b     The color of the line to be drawn
 *************************************************************************/
-void drawQuad(const Quad & quad)
+void ogstream :: drawRectangle(const Position & begin, const Position & end,
+              double red, double green, double blue)
 {
+   PT ptBegin = viewport.toPixels(begin);
+   PT ptEnd = viewport.toPixels(end);
+
    // Get ready...
    glBegin(GL_QUADS);
-   glColor3f(quad.r, quad.g, quad.b);
+   numDrawCalls++;
+   glColor3f((GLfloat)red, (GLfloat)green, (GLfloat)blue);
 
-   // Draw the actual line
-   glVertex2f((GLfloat)quad.pt1.x, (GLfloat)quad.pt1.y);
-   glVertex2f((GLfloat)quad.pt2.x, (GLfloat)quad.pt2.y);
-   glVertex2f((GLfloat)quad.pt3.x, (GLfloat)quad.pt3.y);
-   glVertex2f((GLfloat)quad.pt4.x, (GLfloat)quad.pt4.y);
+   // Draw the actual rectangle
+   glVertex2f((GLfloat)ptBegin.x, (GLfloat)ptBegin.y);
+   glVertex2f((GLfloat)ptBegin.x, (GLfloat)ptEnd.y);
+   glVertex2f((GLfloat)ptEnd.x,   (GLfloat)ptEnd.y);
+   glVertex2f((GLfloat)ptEnd.x,   (GLfloat)ptBegin.y);
 
    // Complete drawing
    glResetColor();
@@ -197,49 +323,33 @@ void drawQuad(const Quad & quad)
 }
 
 /************************************************************************
-* DRAW QUAD
-* Draw a quad on the screen from the beginning to the end.
-*   INPUT QUAD
-*         posRotate
-*         angle
+* DRAW MESH
+* Draw every vertex of a mesh with one glDrawArrays() call. The
+* vertices are already in pixels and already colored
+*   INPUT  mesh      The lines or triangles to be drawn
 *************************************************************************/
-void drawQuad(const Quad& quad, const Position posRotate, double angle)
+void ogstream :: drawMesh(const Mesh & mesh)
 {
-   // Get ready...
-   glBegin(GL_QUADS);
-   glColor3f(quad.r, quad.g, quad.b);
+   if (mesh.empty())
+      return;
 
-   // Draw the actual line
-   glVertexPoint(rotatePosition(posRotate, quad.pt1.x, quad.pt1.y, angle));
-   glVertexPoint(rotatePosition(posRotate, quad.pt2.x, quad.pt2.y, angle));
-   glVertexPoint(rotatePosition(posRotate, quad.pt3.x, quad.pt3.y, angle));
-   glVertexPoint(rotatePosition(posRotate, quad.pt4.x, quad.pt4.y, angle));
+   const Vertex * pVertices = mesh.getVertices().data();
 
-   // Complete drawing
-   glResetColor();
-   glEnd();
-}
+   // point OpenGL at the interleaved positions and colors
+   glEnableClientState(GL_VERTEX_ARRAY);
+   glEnableClientState(GL_COLOR_ARRAY);
+   glVertexPointer(2, GL_FLOAT, sizeof(Vertex), &pVertices->x);
+   glColorPointer(3, GL_FLOAT, sizeof(Vertex), &pVertices->red);
 
-/************************************************************************
-* DRAW RECTRANGLE
-* Draw a rectangle on the screen from the beginning to the end.
-*   INPUT  begin     The position of the beginning of the line
-*          end       The position of the end of the line
-*          r/g/b     The color of the line to be drawn
-*************************************************************************/
-void ogstream :: drawRectangle(const Position & begin, const Position & end,
-              double red, double green, double blue)
-{
-   Quad quad =
-   {
-      {(GLfloat)begin.getPixelsX(), (GLfloat)begin.getPixelsY()},
-      {(GLfloat)begin.getPixelsX(), (GLfloat)end.getPixelsY()},
-      {(GLfloat)end.getPixelsX(),   (GLfloat)end.getPixelsY()},
-      {(GLfloat)end.getPixelsX(),   (GLfloat)begin.getPixelsY()},
-      (GLfloat)red, (GLfloat)green, (GLfloat)blue
-   };
-
-   drawQuad(quad);
+   // all of it at once
+   glDrawArrays(mesh.getPrimitive() == Mesh::LINES ? GL_LINES : GL_TRIANGLES,
+                0, (GLsizei)mesh.size());
+   numDrawCalls++;
+
+   // put things back the way glBegin() expects them
+   glDisableClientState(GL_COLOR_ARRAY);
+   glDisableClientState(GL_VERTEX_ARRAY);
+   glResetColor();
 }
 
 
@@ -250,17 +360,19 @@ void ogstream :: drawRectangle(const Position & begin, const Position & end,
  ***********************************************************************/
 void ogstream :: drawTarget(const Position& pos)
 {
-   double size = 10.0;
+   double size = TARGET_SIZE;
+   PT pt = viewport.toPixels(pos);
 
    // set up to draw a solid rectangle
    glBegin(GL_QUADS);
+   numDrawCalls++;
    glColor3f((GLfloat)0.2 /* red % */, (GLfloat)0.75 /* green % */, (GLfloat)0.2 /* blue % */);
 
    // specify the corners
-   glVertex2f((GLfloat)(pos.getPixelsX() - size/2.0), (GLfloat)(pos.getPixelsY() - size/2.0));
-   glVertex2f((GLfloat)(pos.getPixelsX() - size/2.0), (GLfloat)(pos.getPixelsY() + size/2.0));
-   glVertex2f((GLfloat)(pos.getPixelsX() + size/2.0), (GLfloat)(pos.getPixelsY() + size/2.0));
-   glVertex2f((GLfloat)(pos.getPixelsX() + size/2.0), (GLfloat)(pos.getPixelsY() - size/2.0));
+   glVertex2f((GLfloat)(pt.x - size/2.0), (GLfloat)(pt.y - size/2.0));
+   glVertex2f((GLfloat)(pt.x - size/2.0), (GLfloat)(pt.y + size/2.0));
+   glVertex2f((GLfloat)(pt.x + size/2.0), (GLfloat)(pt.y + size/2.0));
+   glVertex2f((GLfloat)(pt.x + size/2.0), (GLfloat)(pt.y - size/2.0));
 
    // done
    glResetColor();
@@ -276,133 +388,86 @@ void ogstream :: drawTarget(const Position& pos)
  ***********************************************************************/
 void ogstream :: drawHowitzer(const Position & pos, double angle, double age)
 {
-   // outline for the Muzzle, the Base, and the muzzle flash
-   Quad muzzle[] =
-   {
-      { {-2.0, 8.0}, {2.0, 8.0}, {2.0, 6.5}, {-2.0, 6.5},
-        (GLfloat)0.07, (GLfloat)0.08, (GLfloat)0.03},    // aiming stuff
-      { {-0.5, 0.0}, {0.5, 0.0}, {0.5, 18.0}, {-0.8, 18.0},
-        (GLfloat)0.14, (GLfloat)0.16, (GLfloat)0.06},    // barrel
-      { {-1.5, 0.0}, {1.5, 0.0}, {1.5, 10.0}, {-1.5, 10.0},
-        (GLfloat)0.29, (GLfloat)0.32, (GLfloat)0.12},    // recoil
-   };
-
-   Quad baseLeft[] =
-   {
-      {{-10.0, 0.0}, {3.0, 0.0}, {3.0, 2.0}, {-7.0, 2.0},
-        (GLfloat)0.29, (GLfloat)0.32, (GLfloat)0.12},      // footing
-      {{-5.0, 0.0}, {-4.0, 0.0}, {-1.0, 5.0}, {-1.0, 5.0},
-        (GLfloat)0.29, (GLfloat)0.32, (GLfloat)0.12},      // muzzle brace
-      {{3.0, 0.0}, {3.0, 3.0}, {2.0, 3.0}, {2.0, 0.0},
-        (GLfloat)0.0, (GLfloat)0.0, (GLfloat)0.0}          // rear brace
-   };
-   Quad baseRight[] =
-   {
-      {{ 10.0, 0.0}, {-3.0, 0.0}, {-3.0, 2.0}, {7.0, 2.0},
-        (GLfloat)0.29, (GLfloat)0.32, (GLfloat)0.12},      // footing
-      {{5.0, 0.0}, {4.0, 0.0}, {1.0, 5.0}, {1.0, 5.0},
-        (GLfloat)0.29, (GLfloat)0.32, (GLfloat)0.12},      // muzzle brace
-      {{-3.0, 0.0}, {-3.0, 3.0}, {-2.0, 3.0}, {-2.0, 0.0},
-        (GLfloat)0.0, (GLfloat)0.0, (GLfloat)0.0}          // rear brace
-   };
-   PT pointsMuzzleFlash[10][2] =
-   {
-      { {-11,21}, {11,21} },      // least intense
-      { {-11,19}, {11,19} },
-      { {-15,20}, {15,20} },
-      { { -7,21}, { 7,21} },
-      { { -7,19}, { 7,19} },
-      { {-10,20}, {10,20} },
-      { { -2,21}, { 2,21} },
-      { { -2,19}, { 2,19} },
-      { { -5,20}, { 5,20} },
-      { { -2,20}, { 2,20} }      // most intense
-   };
-
-   // Draw the base - Since howitzer only rotates from 0° (up) to 85° (right), always use right base
-   for (int i = 0; i < sizeof(baseLeft) / sizeof(Quad); i++)
-      drawQuad(baseRight[i], pos, 0.0);  // Always use right base for 0°-85° range
-
-   // Draw the muzzle
-   for (int i = 0; i < sizeof(muzzle) / sizeof(Quad); i++)
-      drawQuad(muzzle[i], pos, angle);
-
-   // Now for the muzzle flash
-   if (age >= 0.0 && age < 2.0) // flash duration in seconds
-   {
-      // draw the muzzle flash
-      glBegin(GL_LINES);
-
-      for (int i = 0; i < 10; i++)
-      {
-         GLfloat color = (GLfloat)((10.0 - (double)i) / 10.0);
-         glColor3f(1.0 /* red % */, (GLfloat)color /* green % */, (GLfloat)color /* blue % */);
-         glVertexPoint(rotatePosition(pos, pointsMuzzleFlash[i][0].x,
-                                           pointsMuzzleFlash[i][0].y, angle));
-         glVertexPoint(rotatePosition(pos, pointsMuzzleFlash[i][1].x,
-                                           pointsMuzzleFlash[i][1].y, angle));
-      }
-
-      // complete drawing of the muzzle flash
-      glResetColor();
-      glEnd();
-   }
+   Mesh triangles(Mesh::TRIANGLES);
+   Mesh lines(Mesh::LINES);
+   tessellateHowitzer(triangles, lines, viewport.toPixels(pos), angle, age);
+   drawMesh(triangles);
+   drawMesh(lines);
 }
 
-/************************************************************************
- * ROTATE
- * Rotate a given point (point) around a given origin (center) by a given
- * number of degrees (angle).
- *    INPUT  origin   The center point we will rotate around
- *           x,y      Offset from center that we will be rotating
- *           rotation Rotation in degrees
- *    OUTPUT point    The new position
+/*************************************************************************
+ * RECORDER : DRAW LINE
  *************************************************************************/
-Position rotatePosition(const Position& origin, double x, double y, double rotation)
+void ogstreamRecorder :: drawLine(const Position & begin, const Position & end,
+                                  double red, double green, double blue)
 {
-   // because sine and cosine are expensive, we want to call them only once
-   double cosA = cos(rotation);
-   double sinA = sin(rotation);
+   const Viewport & viewport = getViewport();
+   drawList.addLine(viewport.toPixels(begin), viewport.toPixels(end), red, green, blue);
+}
 
-   // start with our original point
-   Position posReturn(origin);
-   
-   // find the new values
-   posReturn.addPixelsX(x * cosA + y * sinA);
-   posReturn.addPixelsY(y * cosA - x * sinA);
+/*************************************************************************
+ * RECORDER : DRAW RECTANGLE
+ *************************************************************************/
+void ogstreamRecorder :: drawRectangle(const Position & begin, const Position & end,
+                                       double red, double green, double blue)
+{
+   const Viewport & viewport = getViewport();
+   drawList.addRectangle(viewport.toPixels(begin), viewport.toPixels(end), red, green, blue);
+}
 
-   return posReturn;
+/*************************************************************************
+ * RECORDER : DRAW MESH
+ *************************************************************************/
+void ogstreamRecorder :: drawMesh(const Mesh & mesh)
+{
+   drawList.addMesh(mesh);
 }
 
-/******************************************************************
- * RANDOM
- * This function generates a random number.
- *
- *    INPUT:   min, max : The number of values (min <= num <= max)
- *    OUTPUT   <return> : Return the integer
- ****************************************************************/
-int random(int min, int max)
+/*************************************************************************
+ * RECORDER : DRAW HOWITZER
+ *************************************************************************/
+void ogstreamRecorder :: drawHowitzer(const Position & pos, double angle, double age)
 {
-   assert(min < max);
-   int num = (rand() % (max - min)) + min;
-   assert(min <= num && num <= max);
+   drawList.addHowitzer(getViewport().toPixels(pos), angle, age);
+}
 
-   return num;
+/*************************************************************************
+ * RECORDER : DRAW TARGET
+ * The same square ogstream::drawTarget() draws
+ *************************************************************************/
+void ogstreamRecorder :: drawTarget(const Position & pos)
+{
+   PT pt = getViewport().toPixels(pos);
+   drawList.addRectangle(PT(pt.x - TARGET_SIZE / 2.0, pt.y - TARGET_SIZE / 2.0),
+                         PT(pt.x + TARGET_SIZE / 2.0, pt.y + TARGET_SIZE / 2.0),
+                         0.2 /* red % */, 0.75 /* green % */, 0.2 /* blue % */);
 }
 
-/******************************************************************
- * RANDOM
- * This function generates a random number.
- *
- *    INPUT:   min, max : The number of values (min <= num <= max)
- *    OUTPUT   <return> : Return the double
- ****************************************************************/
-double random(double min, double max)
+/*************************************************************************
+ * RECORDER : DRAW TEXT
+ *************************************************************************/
+void ogstreamRecorder :: drawText(const Position & topLeft, const char * text)
 {
-   assert(min <= max);
-   double num = min + ((double)rand() / (double)RAND_MAX * (max - min));
-   
-   assert(min <= num && num <= max);
+   drawList.addText(getViewport().toPixels(topLeft), text);
+}
+
+/*************************************************************************
+ * RECORDER : SUBMIT
+ * Draw the frame: every batch of triangles and lines as one vertex
+ * array, then all the text on top of it as one more. Then start the
+ * next frame
+ *************************************************************************/
+void ogstreamRecorder :: submit()
+{
+   flush();
+
+   for (const Mesh * pMesh : drawList.build())
+      ogstream::drawMesh(*pMesh);
+
+   for (const DrawCommand & command : drawList.getCommands())
+      if (command.kind == DRAW_TEXT)
+         glAddText(PT(command.x, command.y), drawList.getText(command));
+   glDrawGlyphs();
 
-   return num;
+   drawList.clear();
 }
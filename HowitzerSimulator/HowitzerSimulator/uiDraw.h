@@ -13,9 +13,13 @@
 #pragma once
 
 #include <string>     // To display text on the screen
+#include <cstring>    // for strlen()
 #include <cmath>      // for M_PI, sin() and cos()
 #include <algorithm>  // used for min() and max()
 #include "position.h" // Where things are drawn
+#include "viewport.h" // How meters become pixels
+#include "mesh.h"     // Geometry drawn in one call
+#include "drawList.h" // A frame recorded rather than drawn
 using std::string;
 using std::min;
 using std::max;
@@ -35,13 +39,16 @@ using std::max;
 class ogstream : public std::ostringstream
 {
 public:
-   ogstream()                    : pos()    {          }
-   ogstream(const Position& pos) : pos(pos) {          }
-   ~ogstream()                              { flush(); }
+   ogstream() : viewport(), pos() {}
+   ogstream(const Viewport& viewport, const Position& pos) :
+      viewport(viewport), pos(pos) {}
+   ~ogstream() { flush(); }
    
    // Methods specific to drawing text on the screen
    virtual void flush();
+   void drawTextLine(const char * text);
    void setPosition(const Position& pos) { flush(); this->pos = pos; }
+   const Viewport& getViewport() const { return viewport; }
    ogstream& operator = (const Position& pos)
    {
       setPosition(pos);
@@ -53,44 +60,122 @@ public:
                  double red = 0.0, double green = 0.0, double blue = 0.0);
    virtual void drawRectangle(const Position & begin, const Position & end,
                       double red = 0.0, double green = 0.0, double blue = 0.0);
+   virtual void drawMesh(const Mesh & mesh);
    virtual void drawProjectile(const Position& pos, double age = 0.0);
    virtual void drawHowitzer(const Position & pos, double angle, double age);
    virtual void drawTarget(const Position& pos);
    virtual void drawText(const Position & topLeft, const char * text);
+
+   // glBegin() and glDrawArrays() calls since the program started
+   static uint64_t getNumDrawCalls();
+
+   // Build the font texture the first time. It clears the back buffer,
+   // so drawCallback() does it before anything of the frame is drawn
+   static void bakeFont();
 private:
    
-   Position pos;
+   Viewport viewport;   // where on the screen the field is
+   Position pos;        // where the next text goes
 };
 
 
-/******************************************************************
- * RANDOM
- * This function generates a random number.  The user specifies
- * The parameters 
- *    INPUT:   min, max : The number of values (min <= num <= max)
- *    OUTPUT   <return> : Return the integer/double
- ****************************************************************/
-int    random(int    min, int    max);
-double random(double min, double max);
-
-#include <cassert>
+// random() moved to random.h; kept here for code that expects it
+#include "random.h"
 
 /*************************************************************************
- * GRAPHICS STREAM DUMMY
- * A dummy graphics scream provided for the purpose of creating unit tests
+ * GRAPHICS STREAM RECORDER
+ * A graphics stream that records what is drawn into a DrawList rather
+ * than drawing it. submit() draws the whole frame as a few vertex arrays.
+ * A unit test or a benchmark can look at getDrawList() instead, and
+ * nothing calls OpenGL
  *************************************************************************/
-class ogstreamDummy : public ogstream
+class ogstreamRecorder : public ogstream
 {
 public:
-   ogstreamDummy()  {          }
-   ~ogstreamDummy() { str(""); }
-   void flush()                                                              { assert(false); }
+   ogstreamRecorder() {}
+   ogstreamRecorder(const Viewport& viewport, const Position& pos) :
+      ogstream(viewport, pos) {}
+   ~ogstreamRecorder() { flush(); }   // while drawText() still records
+
    void drawLine(const Position& begin, const Position& end,
-      double red = 0.0, double green = 0.0, double blue = 0.0)               { assert(false); }
+                 double red = 0.0, double green = 0.0, double blue = 0.0) override;
    void drawRectangle(const Position& begin, const Position& end,
-      double red = 0.0, double green = 0.0, double blue = 0.0)               { assert(false); }
-   void drawProjectile(const Position& pos, double age = 0.0)                { assert(false); }
-   void drawHowitzer(const Position& pos, double angle, double age)          { assert(false); }
-   void drawTarget(const Position& pos)                                      { assert(false); }
-   void drawText(const Position& topLeft, const char* text)                  { assert(false); }
-};
\ No newline at end of file
+                      double red = 0.0, double green = 0.0, double blue = 0.0) override;
+   void drawMesh(const Mesh& mesh) override;
+   void drawHowitzer(const Position& pos, double angle, double age) override;
+   void drawTarget(const Position& pos) override;
+   void drawText(const Position& topLeft, const char* text) override;
+
+   // Draw what was recorded and start the next frame
+   void submit();
+
+   // What was recorded. Text is only recorded on flush()
+   const DrawList& getDrawList() const { return drawList; }
+
+private:
+   DrawList drawList;
+};
+
+/*************************************************************************
+ * DRAW COUNTS
+ * How much a frame asked to have drawn
+ *************************************************************************/
+struct DrawCounts
+{
+   uint64_t lines = 0;
+   uint64_t rectangles = 0;
+   uint64_t meshes = 0;
+   uint64_t vertices = 0;       // in all the meshes
+   uint64_t howitzers = 0;
+   uint64_t projectiles = 0;
+   uint64_t targets = 0;
+   uint64_t texts = 0;          // lines of text
+   uint64_t textBytes = 0;      // characters in them
+};
+
+/*************************************************************************
+ * GRAPHICS STREAM COUNTER
+ * A graphics stream that draws nothing and calls nothing, but counts
+ * what it was asked to draw. Drawing a frame into it costs only what
+ * the simulator itself spends, so a benchmark can time that without a
+ * window
+ *************************************************************************/
+class ogstreamCounter : public ogstream
+{
+public:
+   ogstreamCounter() {}
+   ogstreamCounter(const Viewport& viewport, const Position& pos) :
+      ogstream(viewport, pos) {}
+   ~ogstreamCounter() { flush(); }   // while drawText() still counts
+
+   void drawLine(const Position&, const Position&,
+                 double = 0.0, double = 0.0, double = 0.0) override
+   {
+      counts.lines++;
+   }
+   void drawRectangle(const Position&, const Position&,
+                      double = 0.0, double = 0.0, double = 0.0) override
+   {
+      counts.rectangles++;
+   }
+   void drawMesh(const Mesh& mesh) override
+   {
+      counts.meshes++;
+      counts.vertices += mesh.size();
+   }
+   void drawProjectile(const Position&, double = 0.0) override { counts.projectiles++; }
+   void drawHowitzer(const Position&, double, double) override { counts.howitzers++; }
+   void drawTarget(const Position&) override { counts.targets++; }
+   void drawText(const Position&, const char* text) override
+   {
+      counts.texts++;
+      counts.textBytes += strlen(text);
+   }
+
+   // What was asked for since the last reset
+   const DrawCounts& getCounts() const { return counts; }
+   void resetCounts() { counts = DrawCounts(); }
+
+private:
+   DrawCounts counts;
+};
@@ -13,7 +13,6 @@
 #include <string>     // need you ask?
 #include <sstream>    // convert an integer into text
 #include <cassert>    // I feel the need... the need for asserts
-#include <time.h>     // for clock
 #include <cstdlib>    // for rand()
 
 
@@ -40,39 +39,12 @@
 #endif // _WIN32
 
 #include "uiInteract.h"
+#include "uiDraw.h"
 #include "position.h"
 
 using namespace std;
 
 
-/*********************************************************************
- * SLEEP
- * Pause for a while.  We want to put the program to sleep until it
- * is time to draw again.  Note that this requires us to tell the OS
- * that we are idle.  the nanosleep function performs this task for us
- *   INPUT: msSleep: sleep time in milliseconds
- *********************************************************************/
-void sleep(unsigned long msSleep)
-{
-   // Windows handles sleep one way
-#ifdef _WIN32
-   ::Sleep(msSleep + 35);
-
-   // Unix-based operating systems (OS-X, Linux) do it another
-#else // LINUX, XCODE
-   timespec req = {};
-   time_t sec = (int)(msSleep / 1000);
-   msSleep -= (sec * 1000);
-
-   req.tv_sec = sec;
-   req.tv_nsec = msSleep * 1000000L;
-
-   while (nanosleep(&req, &req) == -1)
-      ;
-#endif // LINUX, XCODE
-   return;
-}
-
 /************************************************************************
  * DRAW CALLBACK
  * This is the main callback from OpenGL. It gets called constantly by
@@ -87,6 +59,9 @@ void drawCallback()
 {
    // even though this is a local variable, all the members are static
    Interface ui;
+   // The font texture is baked in the back buffer, so before anything else
+   ogstream::bakeFont();
+   
    // Prepare the background buffer for drawing
    glClear(GL_COLOR_BUFFER_BIT); //clear the screen
    glColor3f((GLfloat)0.0 /* red % */, (GLfloat)0.0 /* green % */, (GLfloat)0.0 /* blue % */);
@@ -95,15 +70,12 @@ void drawCallback()
    assert(ui.callBack != NULL);
    ui.callBack(&ui, ui.p);
    
-   //loop until the timer runs out
-   if (!ui.isTimeToDraw())
-      sleep((unsigned long)((ui.getNextTick() - clock()) / 1000));
-
-   // from this point, set the next draw time
-   ui.setNextDrawTime();
+   // wait until the frame is due, by the wall clock
+   ui.waitForFrame();
 
    // bring forth the background buffer
    glutSwapBuffers();
+   ui.frameDone();
 
    // clear the space at the end
    ui.keyEvent();
@@ -122,6 +94,7 @@ void keyDownCallback(int key, int x, int y)
    // so we are actually getting the same version as in the constructor.
    Interface ui;
    ui.keyEvent(key, true /*fDown*/);
+   ui.wake();
 }
 
 /************************************************************************
@@ -136,6 +109,7 @@ void keyUpCallback(int key, int x, int y)
    // so we are actually getting the same version as in the constructor.
    Interface ui;
    ui.keyEvent(key, false /*fDown*/);
+   ui.wake();
 }
 
 /***************************************************************
@@ -149,6 +123,7 @@ void keyboardCallback(unsigned char key, int x, int y)
    // so we are actually getting the same version as in the constructor.
    Interface ui;
    ui.keyEvent(key, true /*fDown*/);
+   ui.wake();
 }
 
 /************************************************************************
@@ -189,6 +164,15 @@ void Interface::keyEvent(int key, bool fDown)
       case 'q':
          isQPress = fDown;
          break;
+      case 'w':
+         isWPress = fDown;
+         break;
+      case 'p':
+         isPPress = fDown;
+         break;
+      case 'm':
+         isMPress = fDown;
+         break;
    }
 }
 
@@ -210,26 +194,44 @@ void Interface::keyEvent()
       isRightPress++;
    isSpacePress = false;
    isQPress = false;
+   isWPress = false;
+   isPPress = false;
+   isMPress = false;
 }
 
 /************************************************************************
- * INTEFACE : IS TIME TO DRAW
- * Have we waited long enough to draw swap the background buffer with
- * the foreground buffer?
+ * INTERFACE : FRAME DONE
+ * Account for the frame just put on the screen. Once nothing has moved
+ * and no key has been down for a while, stop the idle callback: GLUT
+ * then blocks until there is an event, rather than drawing the same
+ * frame over and over
  *************************************************************************/
-bool Interface::isTimeToDraw()
+void Interface::frameDone()
 {
-   return ((unsigned int)clock() >= nextTick);
+   bool isAnimating = isAnimatingClient ||
+      isDownPress || isUpPress || isLeftPress || isRightPress;
+   scheduler.frameDone(FrameScheduler::Clock::now(), isAnimating);
+
+   if (scheduler.isIdle() && !isBlocked)
+   {
+      glutIdleFunc(NULL);
+      isBlocked = true;
+   }
 }
 
 /************************************************************************
- * INTERFACE : SET NEXT DRAW TIME
- * What time should we draw the buffer again?  This is a function of
- * the current time and the frames per second.
+ * INTERFACE : WAKE
+ * A key or something else happened. If we were blocked, start drawing
+ * again, beginning now
  *************************************************************************/
-void Interface::setNextDrawTime()
+void Interface::wake()
 {
-   nextTick = (unsigned int)clock() + static_cast<unsigned int> (timePeriod * CLOCKS_PER_SEC);
+   if (!isBlocked)
+      return;
+
+   scheduler.wake(FrameScheduler::Clock::now());
+   glutIdleFunc(drawCallback);
+   isBlocked = false;
 }
 
 /************************************************************************
@@ -241,7 +243,7 @@ void Interface::setNextDrawTime()
  *************************************************************************/
 void Interface::setFramesPerSecond(double value)
 {
-    timePeriod = (1 / value);
+   scheduler.setFramesPerSecond(value);
 }
 
 /***************************************************
@@ -255,9 +257,13 @@ int          Interface::isLeftPress  = 0;
 int          Interface::isRightPress = 0;
 bool         Interface::isSpacePress = false;
 bool         Interface::isQPress     = false;
+bool         Interface::isWPress     = false;
+bool         Interface::isPPress     = false;
+bool         Interface::isMPress     = false;
 bool         Interface::initialized  = false;
-double       Interface::timePeriod   = 1.0 / 30; // default to 30 frames/second
-unsigned int Interface::nextTick     = 0;        // redraw now please
+FrameScheduler Interface::scheduler(30.0);       // default to 30 frames/second
+bool         Interface::isAnimatingClient = true; // until the client says otherwise
+bool         Interface::isBlocked    = false;
 void *       Interface::p            = NULL;
 void (*Interface::callBack)(const Interface *, void *) = NULL;
 
@@ -270,19 +276,17 @@ void (*Interface::callBack)(const Interface *, void *) = NULL;
  *           argv:       The actual command-line parameters
  *           title:      The text for the titlebar of the window
  *************************************************************************/
-void Interface::initialize(const char * title, const Position & posUpperRight)
+void Interface::initialize(const char * title, const Viewport & viewport)
 {
    if (initialized)
       return;
    
-   // set up the random number generator
-   srand((unsigned int)time(NULL));
-
    // create the window
    int argc = 0;
    glutInit(&argc, nullptr /*argv*/);
-   glutInitWindowSize((int)posUpperRight.getPixelsX()-1,
-                      (int)posUpperRight.getPixelsY()-1);   // size of the window
+   int width = (int)viewport.getWidthPixels();
+   int height = (int)viewport.getHeightPixels();
+   glutInitWindowSize(width - 1, height - 1);      // size of the window
             
    glutInitWindowPosition( 10, 10);                // initial position 
    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB);    // double buffering
@@ -291,9 +295,9 @@ void Interface::initialize(const char * title, const Position & posUpperRight)
    
    // set up the drawing style: B/W and 2D
    glClearColor(1.0, 1.0, 1.0, 0);            // White is the background color
-   gluOrtho2D(0, (int)posUpperRight.getPixelsX(),    // range of x values: (0, width)
-              0, (int)posUpperRight.getPixelsY());   // range of y values: (0, height)
-   glutReshapeWindow((int)posUpperRight.getPixelsX(), (int)posUpperRight.getPixelsY());
+   gluOrtho2D(0, width,                       // range of x values: (0, width)
+              0, height);                     // range of y values: (0, height)
+   glutReshapeWindow(width, height);
 
    // register the callbacks so OpenGL knows how to call us
    glutDisplayFunc(   drawCallback    );
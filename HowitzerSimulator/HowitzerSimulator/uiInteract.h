@@ -16,7 +16,8 @@
 
 #pragma once
 
-#include "position.h"
+#include "viewport.h"
+#include "frameScheduler.h"
 #include <algorithm> // used for min() and max() (specifically required by Visual Studio)
 using std::min;
 using std::max;
@@ -33,25 +34,32 @@ public:
 
    // Constructor if you want to set up the window with anything but
    // the default parameters
-   Interface(const char * title, const Position & posUpperRight)
+   Interface(const char * title, const Viewport & viewport)
    {
-      initialize(title, posUpperRight);
+      initialize(title, viewport);
    }
    
    // This will set the game in motion
    void run(void (*callBack)(const Interface *, void *), void *p);
 
-   // Is it time to redraw the screen
-   bool isTimeToDraw();
+   // Hold the frame until it is due
+   void waitForFrame() const { scheduler.waitForDeadline(); }
 
-   // Set the next draw time based on current time and time period
-   void setNextDrawTime();
+   // The frame is on the screen. Stop drawing if nothing has moved
+   // for a while
+   void frameDone();
 
-   // Retrieve the next tick time... the time of the next draw.
-   unsigned int getNextTick() { return nextTick; };
+   // Something happened: start drawing again
+   void wake();
+
+   // The client tells us whether anything is moving
+   static void setAnimating(bool value) { isAnimatingClient = value; }
 
    // How many frames per second are we configured for?
    void setFramesPerSecond(double value);
+
+   // Frames drawn and missed
+   static const FrameScheduler & getScheduler() { return scheduler; }
    
    // Key event indicating a key has been pressed or not.  The callbacks
    // should be the only onces to call this
@@ -59,7 +67,7 @@ public:
    void keyEvent();
 
    // Current frame rate
-   double frameRate() const { return timePeriod;   }
+   double frameRate() const { return scheduler.getPeriod(); }
    
    // Get various key events
    int  isDown()      const { return isDownPress;  }
@@ -68,16 +76,20 @@ public:
    int  isRight()     const { return isRightPress; }
    bool isSpace()     const { return isSpacePress; }
    bool isQ()         const { return isQPress;     }
+   bool isW()         const { return isWPress;     }
+   bool isP()         const { return isPPress;     }
+   bool isM()         const { return isMPress;     }
 
    static void *p;                   // for client
    static void (*callBack)(const Interface *, void *);
 
 private:
-   void initialize(const char * title, const Position & posUpperRight);
+   void initialize(const char * title, const Viewport & viewport);
 
    static bool         initialized;  // only run the constructor once!
-   static double       timePeriod;   // interval between frame draws
-   static unsigned int nextTick;     // time (from clock()) of our next draw
+   static FrameScheduler scheduler;  // when the next frame is due
+   static bool isAnimatingClient;    // is anything moving?
+   static bool isBlocked;            // waiting for an event, not drawing
 
    static int  isDownPress;          // is the down arrow currently pressed?
    static int  isUpPress;            //    "   up         "
@@ -85,6 +97,9 @@ private:
    static int  isRightPress;         //    "   right      "
    static bool isSpacePress;         //    "   space      "
    static bool isQPress;             //    "   space      "
+   static bool isWPress;             //    "   w          "
+   static bool isPPress;             //    "   p          "
+   static bool isMPress;             //    "   m          "
 };
 
 
@@ -0,0 +1,354 @@
+/***********************************************************************
+ * Source File:
+ *    UI SIMULATION
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    Drawing and keyboard handling for the simulation. This is the only
+ *    part of Simulator, Ground, Howitzer and Projectile that needs
+ *    OpenGL, so it is built with the GLUT front end and not the core
+ *    library
+ ************************************************************************/
+
+#include "simulation.h"
+#include "uiDraw.h"
+#include "uiInteract.h"
+#include "profiler.h"
+#include <cassert>
+#include <chrono>
+#include <cmath>
+
+/*****************************************************************
+ * GROUND :: DRAW
+ * Draw the ground on the screen: three vertex arrays built by
+ * reset(), the target, and the labels
+ ****************************************************************/
+void Ground::draw(ogstream & gout) const
+{
+   PROFILE_ZONE("Ground::draw");
+   if (ground == nullptr)
+      return;
+
+   gout.drawMesh(grid);
+   gout.drawMesh(terrain);
+   gout.drawTarget(getTarget());
+   gout.drawMesh(ticks);
+
+   for (const GroundLabel& label : labels)
+      gout.drawText(label.pos, label.text.c_str());
+}
+
+/*********************************************
+ * HOWITZER : DRAW
+ * Draw the barrel at its current elevation
+ *********************************************/
+void Howitzer::draw(ogstream& gout, double flightTime) const
+{
+   gout.drawHowitzer(position, elevation.getRadians(), flightTime);
+}
+
+/*********************************************
+ * PROJECTILE : DRAW
+ * Draw the projectile and its trail
+ *********************************************/
+void Projectile::draw(ogstream& gout, double flightTime) const
+{
+   if (!isActive || flightPath.empty())
+      return;
+   
+   // Draw current projectile position
+   gout.drawProjectile(flightPath.back().pos, flightTime);
+}
+
+/*********************************************
+ * SIMULATOR : HANDLE INPUT
+ * Process user input for controlling the simulation
+ *********************************************/
+void Simulator::handleInput(const Interface* pUI)
+{
+   PROFILE_ZONE("Simulator::handleInput");
+   assert(pUI != nullptr);
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      
+      // Process movement input
+      processMovementInput(pUI);
+      
+      // Process firing input
+      processFireInput(pUI);
+   }
+   
+   // P shows or hides the performance overlay
+   if (pUI->isP())
+      isShowingPerformance = !isShowingPerformance;
+   
+   // M fires a dispersion run with the current aim
+   if (pUI->isM())
+      runDispersion();
+}
+
+/*********************************************
+ * SIMULATOR : PROCESS MOVEMENT INPUT
+ * Handle howitzer movement controls with angle limits (0° to 90°)
+ *********************************************/
+void Simulator::processMovementInput(const Interface* pUI)
+{
+   // Get current angle in degrees for limit checking
+   double currentAngle = howitzer.getElevation().getDegrees();
+   
+   // Rotation controls with limits (0° to 90° range only)
+   if (pUI->isRight() && currentAngle < MAX_ELEVATION_ANGLE)
+      howitzer.rotate(0.05);
+   if (pUI->isLeft() && currentAngle > 0.0)  // Changed from MIN_ELEVATION_ANGLE to 0.0
+      howitzer.rotate(-0.05);
+   
+   // Elevation controls (kept for backward compatibility but with limits)
+   if (pUI->isUp() && currentAngle < MAX_ELEVATION_ANGLE)
+      howitzer.raise(0.003);
+   if (pUI->isDown() && currentAngle > 0.0)  // Changed from MIN_ELEVATION_ANGLE to 0.0
+      howitzer.raise(-0.003);
+}
+
+/*********************************************
+ * SIMULATOR : PROCESS FIRE INPUT
+ * Handle firing controls
+ *********************************************/
+void Simulator::processFireInput(const Interface* pUI)
+{
+   // Fire projectile when space is pressed and not currently firing
+   if (pUI->isSpace())
+      launch();
+   
+   // W steps through the time warps
+   if (pUI->isW())
+      timeWarp = nextTimeWarp(timeWarp);
+}
+
+/*********************************************
+ * SIMULATOR : DRAW
+ * Render the entire simulation from the newest
+ * published frame. The physics runs at its own
+ * rate, so draw where things are between the
+ * last two steps at this instant, not where they
+ * were at the last step
+ *********************************************/
+void Simulator::draw(ogstream& gout) const
+{
+   frames.acquire();
+   const SimulatorFrame& frame = frames.front();
+   double alpha = 1.0;
+   if (frame.interval > 0.0)
+      alpha = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                            frame.published).count() / frame.interval;
+   SimulatorSnapshot snapshot = frame.at(alpha);
+   
+   // Draw ground and target
+   frame.ground.draw(gout);
+   
+   // Draw howitzer
+   gout.drawHowitzer(snapshot.howitzer, snapshot.elevation, snapshot.time);
+   
+   // Draw projectile trail
+   for (int i = 0; i < TRAIL_LENGTH; ++i)
+   {
+      if (snapshot.trail[i].getMetersX() != 0.0 || snapshot.trail[i].getMetersY() != 0.0)
+      {
+         gout.drawProjectile(snapshot.trail[i], i * TRAIL_INTERVAL);
+      }
+   }
+   if (snapshot.isFiring)
+      gout.drawProjectile(snapshot.projectile, 0.0);
+   
+   // Display game information
+   displayGameStats(gout, snapshot);
+   displayHitStatus(gout, snapshot);
+   displayDispersion(gout, frame);
+}
+
+/*********************************************
+ * SIMULATOR : DISPLAY GAME STATS
+ * Display current game statistics with ANGLE instead of ELEVATION.
+ * Each line is only formatted again when what it shows has changed,
+ * and never through a stream, so a frame allocates nothing here
+ *********************************************/
+void Simulator::displayGameStats(ogstream& gout, const SimulatorSnapshot& snapshot) const
+{
+   // Display flight time
+   HudLine& lineTime = hud[HUD_TIME];
+   if (lineTime.isStale(snapshot.time))
+      lineTime.clear().pad(85).append("Flight time: ").append(snapshot.time, 1).append("s");
+   gout.drawTextLine(lineTime.c_str());
+   
+   // Display howitzer angle (CHANGED FROM "Elevation" TO "Angle")
+   HudLine& lineAngle = hud[HUD_ANGLE];
+   if (lineAngle.isStale(snapshot.elevation))
+      lineAngle.clear().pad(95).append("Angle: ")
+               .append(snapshot.elevation * 180.0 / M_PI, 1).append("°");
+   gout.drawTextLine(lineAngle.c_str());
+   
+   // Display the time warp when fast forwarding
+   if (snapshot.timeWarp > 1.0)
+   {
+      HudLine& lineWarp = hud[HUD_WARP];
+      if (lineWarp.isStale(snapshot.timeWarp))
+      {
+         lineWarp.clear().pad(95).append("Warp: ");
+         if (std::isinf(snapshot.timeWarp))
+            lineWarp.append("fastest");
+         else
+            lineWarp.append(snapshot.timeWarp, 0).append("x");
+      }
+      gout.drawTextLine(lineWarp.c_str());
+   }
+   
+   // Display score and accuracy
+   HudLine& lineScore = hud[HUD_SCORE];
+   if (lineScore.isStale(snapshot.score, snapshot.shotsAttempted))
+   {
+      lineScore.clear().pad(85).append("Score: ").append(snapshot.score)
+               .append("/").append(snapshot.shotsAttempted);
+      if (snapshot.shotsAttempted > 0)
+      {
+         double hitRate = (double)snapshot.score / snapshot.shotsAttempted;
+         lineScore.append(" (").append(hitRate * 100.0, 0).append("%)");
+      }
+   }
+   gout.drawTextLine(lineScore.c_str());
+}
+
+/*********************************************
+ * SIMULATOR : DISPLAY HIT STATUS
+ * Display hit/miss status
+ *********************************************/
+void Simulator::displayHitStatus(ogstream& gout, const SimulatorSnapshot& snapshot) const
+{
+   HudLine& lineStatus = hud[HUD_STATUS];
+   if (lineStatus.isStale(snapshot.isFiring, snapshot.isHit + 2 * (snapshot.shotsAttempted > 0)))
+   {
+      lineStatus.clear();
+      if (!snapshot.isFiring)
+      {
+         lineStatus.pad(95);
+         
+         if (snapshot.shotsAttempted > 0)
+         {
+            if (snapshot.isHit)
+               lineStatus.append("Target: HIT!");
+            else
+               lineStatus.append("Target: Miss");
+         }
+         else
+         {
+            lineStatus.append("Press SPACE to fire");
+         }
+      }
+      else
+      {
+         lineStatus.pad(100).append("Projectile in flight...");
+      }
+   }
+   gout.drawTextLine(lineStatus.c_str());
+}
+
+/*********************************************
+ * SIMULATOR : DISPLAY DISPERSION
+ * The spread of the last dispersion run, under
+ * the hit status, while the howitzer is still
+ * aimed as it was on the same round
+ *********************************************/
+void Simulator::displayDispersion(ogstream& gout, const SimulatorFrame& frame) const
+{
+   if (!isShowingDispersion || frame.round != dispersionRound ||
+       frame.current.elevation != dispersionElevation)
+      return;
+   
+   HudLine& lineSpread = hud[HUD_SPREAD];
+   if (lineSpread.isStale(dispersion.cep, dispersion.rangeErrorProbable))
+      lineSpread.clear().pad(85).append("CEP ").append(dispersion.cep, 0)
+                .append("m  REP ").append(dispersion.rangeErrorProbable, 0)
+                .append("m  DEP ").append(dispersion.deflectionErrorProbable, 0).append("m");
+   gout.drawTextLine(lineSpread.c_str());
+   
+   HudLine& lineChance = hud[HUD_CHANCE];
+   if (lineChance.isStale(dispersion.hitProbability))
+      lineChance.clear().pad(85).append("Hit chance: ")
+                .append(dispersion.hitProbability * 100.0, 1).append("%");
+   gout.drawTextLine(lineChance.c_str());
+}
+
+/*********************************************
+ * SIMULATOR : DRAW PERFORMANCE
+ * The overlay in the top left corner: the frame
+ * time, the physics time, the steps and the draw
+ * calls over the last few seconds, then a bar
+ * for each bucket of frame times, greener for
+ * the quick ones and redder for the slow. Every
+ * figure comes from the running sums in stats,
+ * and a line is only built again when the text
+ * it shows would change
+ *********************************************/
+void Simulator::drawPerformance(ogstream& gout, const FrameStats& stats) const
+{
+   if (!isShowingPerformance)
+      return;
+   
+   const double lineHeight = 18.0;       // pixels, as drawTextLine() moves down
+   const double barWidth = 10.0;
+   const double barGap = 2.0;
+   const double barHeight = 40.0;        // a bucket with every frame in it
+   const Viewport& viewport = gout.getViewport();
+   double top = viewport.getHeightPixels() - 20.0;
+   gout.setPosition(viewport.toPosition(10.0, top));
+   
+   // Rounded to what is shown
+   double frameMs = std::round(stats.getFrameSeconds() * 1.0e4) / 10.0;
+   double fps = std::round(stats.getFramesPerSecond());
+   HudLine& lineFrame = hud[HUD_FRAME];
+   if (lineFrame.isStale(frameMs, fps))
+      lineFrame.clear().append("Frame: ").append(frameMs, 1).append(" ms (")
+               .append(fps, 0).append(" fps)");
+   gout.drawTextLine(lineFrame.c_str());
+   
+   double physicsMs = std::round(stats.getUpdateSecondsPerFrame() * 1.0e5) / 100.0;
+   HudLine& linePhysics = hud[HUD_PHYSICS];
+   if (linePhysics.isStale(physicsMs))
+      linePhysics.clear().append("Physics: ").append(physicsMs, 2).append(" ms/frame");
+   gout.drawTextLine(linePhysics.c_str());
+   
+   double steps = std::round(stats.getStepsPerSecond());
+   HudLine& lineSteps = hud[HUD_STEPS];
+   if (lineSteps.isStale(steps))
+      lineSteps.clear().append("Steps: ").append(steps, 0).append("/s");
+   gout.drawTextLine(lineSteps.c_str());
+   
+   double draws = std::round(stats.getDrawCallsPerFrame() * 10.0) / 10.0;
+   HudLine& lineDraws = hud[HUD_DRAWS];
+   if (lineDraws.isStale(draws))
+      lineDraws.clear().append("Draw calls: ").append(draws, 1).append("/frame");
+   gout.drawTextLine(lineDraws.c_str());
+   
+   // Each bucket as tall as its share of the window, fastest first
+   double bottom = top - lineHeight * 4.0 - barHeight - 4.0;
+   int numFrames = stats.getNumFrames();
+   for (int i = 0; numFrames > 0 && i < FRAME_STATS_BUCKETS; i++)
+   {
+      if (stats.getBucket(i) == 0)
+         continue;
+      double left = 10.0 + i * (barWidth + barGap);
+      double height = std::max(1.0, barHeight * stats.getBucket(i) / numFrames);
+      double red = (double)i / (FRAME_STATS_BUCKETS - 1);
+      gout.drawRectangle(viewport.toPosition(left, bottom),
+                         viewport.toPosition(left + barWidth, bottom + height),
+                         red, 1.0 - red, 0.0);
+   }
+   
+   // What the bars span, to their right. The buckets never change, so
+   // neither does the text once it is made
+   HudLine& lineLegend = hud[HUD_LEGEND];
+   if (lineLegend.isStale(FRAME_STATS_BUCKETS))
+      lineLegend.clear().append(FrameStats::getBucketName(0)).append(" to ")
+                .append(FrameStats::getBucketName(FRAME_STATS_BUCKETS - 1)).append(" ms");
+   gout.drawText(viewport.toPosition(10.0 + FRAME_STATS_BUCKETS * (barWidth + barGap) + 4.0,
+                                     bottom + lineHeight),
+                 lineLegend.c_str());
+}
@@ -0,0 +1,98 @@
+/***********************************************************************
+ * Header File:
+ *    VIEWPORT
+ * Author:
+ *    Gary Sibanda
+ * Summary:
+ *    How the field, measured in meters, maps onto the screen,
+ *    measured in pixels
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include "position.h"
+
+// Forward declaration for the unit tests
+class TestViewport;
+
+#define DEFAULT_METERS_FROM_PIXELS 40.0   // one pixel is 40 meters
+
+/*********************************************
+ * VIEWPORT
+ * The zoom and size of one window onto the field.
+ * Position knows nothing about pixels; anything
+ * that draws, or that stores the field a pixel
+ * at a time like Ground, keeps a Viewport. Each
+ * has its own, so two simulations or a physics
+ * thread beside the renderer share nothing. The
+ * inverse of the zoom is kept so that going from
+ * meters to pixels is a multiply, not a divide
+ *********************************************/
+class Viewport
+{
+public:
+   friend ::TestViewport;
+
+   Viewport(double metersFromPixels = DEFAULT_METERS_FROM_PIXELS,
+            double widthPixels = 0.0, double heightPixels = 0.0) :
+      widthPixels(widthPixels), heightPixels(heightPixels)
+   {
+      setZoom(metersFromPixels);
+   }
+
+   // Zoom: meters in one pixel
+   double getZoom() const { return metersFromPixels; }
+   void setZoom(double metersFromPixels)
+   {
+      assert(metersFromPixels > 0.0);
+      this->metersFromPixels = metersFromPixels;
+      pixelsFromMeters = 1.0 / metersFromPixels;
+   }
+
+   // Size of the window
+   double getWidthPixels() const { return widthPixels; }
+   double getHeightPixels() const { return heightPixels; }
+   void setSize(double widthPixels, double heightPixels)
+   {
+      this->widthPixels = widthPixels;
+      this->heightPixels = heightPixels;
+   }
+   Position getUpperRight() const
+   {
+      return Position(toMeters(widthPixels), toMeters(heightPixels));
+   }
+
+   // Meters to pixels
+   double toPixels(double meters) const { return meters * pixelsFromMeters; }
+   double toPixelsX(const Position& pos) const { return pos.getMetersX() * pixelsFromMeters; }
+   double toPixelsY(const Position& pos) const { return pos.getMetersY() * pixelsFromMeters; }
+   PT toPixels(const Position& pos) const { return PT(toPixelsX(pos), toPixelsY(pos)); }
+
+   // Pixels to meters
+   double toMeters(double pixels) const { return pixels * metersFromPixels; }
+   Position toPosition(double xPixels, double yPixels) const
+   {
+      return Position(toMeters(xPixels), toMeters(yPixels));
+   }
+
+   // Move a position some number of pixels
+   void addPixels(Position& pos, double xPixels, double yPixels) const
+   {
+      pos.addMeters(toMeters(xPixels), toMeters(yPixels));
+   }
+
+   // Is the position inside the window?
+   bool contains(const Position& pos) const
+   {
+      double x = toPixelsX(pos);
+      double y = toPixelsY(pos);
+      return x >= 0.0 && x < widthPixels && y >= 0.0 && y < heightPixels;
+   }
+
+private:
+   double metersFromPixels;   // the zoom
+   double pixelsFromMeters;   // 1 / the zoom
+   double widthPixels;        // size of the window
+   double heightPixels;
+};